@@ -1,4 +1,4 @@
-cbuffer ConstantBuffer
+cbuffer ConstantBuffer : register(b2)
 {
     float4x4 worldViewProjectionMatrix;
 }
@@ -1,12 +1,12 @@
 struct vertex_output
 {
     float4 position : SV_POSITION;
-    float2 texcoord : TEXCOORD;
+    float3 texcoord : TEXCOORD; // z is the slice
 };
-Texture2D myTexture2D;
+Texture2DArray myTexture2DArray;
 SamplerState mySamplerState;
 float4 main(vertex_output input) : SV_TARGET
 {
-    float4 color = myTexture2D.Sample(mySamplerState, input.texcoord);
+    float4 color = myTexture2DArray.Sample(mySamplerState, input.texcoord);
     return color;
 }
\ No newline at end of file
@@ -1,13 +1,13 @@
-cbuffer ConstantBuffer
+cbuffer ConstantBuffer : register(b2)
 {
     float4x4 worldViewProjectionMatrix;
 }
 struct vertex_output
 {
     float4 position : SV_POSITION;
-    float2 texcoord : TEXCOORD;
+    float3 texcoord : TEXCOORD; // z is the slice
 };
-vertex_output main(float4 pos : POSITION, float2 tex : TEXCOORD)
+vertex_output main(float4 pos : POSITION, float3 tex : TEXCOORD)
 {
     vertex_output output;
     output.position = mul(worldViewProjectionMatrix, pos);
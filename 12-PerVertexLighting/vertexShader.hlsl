@@ -1,8 +1,15 @@
-cbuffer ConstantBuffer
+cbuffer ViewBuffer : register(b1)
 {
-    float4x4 worldMatrix;
     float4x4 viewMatrix;
     float4x4 projectionMatrix;
+}
+cbuffer ObjectBuffer : register(b2)
+{
+    float4x4 worldMatrix;
+}
+#ifdef LIGHTING
+cbuffer LightingBuffer : register(b0)
+{
     float4 lightAmbient;
     float4 lightDiffuse;
     float4 lightSpecular;
@@ -11,8 +18,8 @@ cbuffer ConstantBuffer
     float4 materialDiffuse;
     float4 materialSpecular;
     float materialShininess;
-    uint keyPressed;
 }
+#endif
 struct vertex_output
 {
     float4 position : SV_POSITION;
@@ -21,23 +28,20 @@ struct vertex_output
 vertex_output main(float4 pos : POSITION, float3 norm : NORMAL)
 {
     vertex_output output;
-    if (keyPressed == 1)
-    {
-        float4 iCoordinates = mul(viewMatrix, mul(worldMatrix, pos));
-        float3 transformedNormals = normalize(mul((float3x3)worldMatrix, norm));
-        float3 lightDirection = normalize((float3)(lightPosition - iCoordinates));
-        float3 reflectionVector = reflect(-lightDirection, transformedNormals);
-        float3 viewerVector = normalize(-iCoordinates.xyz);
-        float3 ambientLight = lightAmbient * materialAmbient;
-        float3 diffuseLight = lightDiffuse * materialDiffuse * max(dot(lightDirection, transformedNormals), 0.0);
-        float3 specularLight = lightSpecular * materialSpecular * pow(max(dot(reflectionVector, viewerVector), 0.0), materialShininess);
-        output.phongADSLight = ambientLight + diffuseLight + specularLight;
-    }
-    else
-    {
-        output.phongADSLight = float3(1.0, 1.0, 1.0);
-    }
+#ifdef LIGHTING
+    float4 iCoordinates = mul(viewMatrix, mul(worldMatrix, pos));
+    float3 transformedNormals = normalize(mul((float3x3)worldMatrix, norm));
+    float3 lightDirection = normalize((float3)(lightPosition - iCoordinates));
+    float3 reflectionVector = reflect(-lightDirection, transformedNormals);
+    float3 viewerVector = normalize(-iCoordinates.xyz);
+    float3 ambientLight = lightAmbient * materialAmbient;
+    float3 diffuseLight = lightDiffuse * materialDiffuse * max(dot(lightDirection, transformedNormals), 0.0);
+    float3 specularLight = lightSpecular * materialSpecular * pow(max(dot(reflectionVector, viewerVector), 0.0), materialShininess);
+    output.phongADSLight = ambientLight + diffuseLight + specularLight;
+#else
+    output.phongADSLight = float3(1.0, 1.0, 1.0);
+#endif
     float4 position = mul(projectionMatrix, mul(viewMatrix, mul(worldMatrix, pos)));
     output.position = position;
     return output;
-}
\ No newline at end of file
+}
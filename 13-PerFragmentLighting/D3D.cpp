@@ -1,1128 +1,604 @@
-// Windows header files
-#include <windows.h>
-#include <stdio.h> // File I/O
-#include <fstream>
-#include <sstream>
-#include <stdlib.h> // For Exit
-
-// D3D11 Related header file
-#include <d3d11.h>
-#include <d3dcompiler.h>
-
-#include "D3D.h"
-#pragma warning(disable : 4838)
-#include "XNAMath_204/xnamath.h"
+// 13-PerFragmentLighting
+// Sphere with Phong lighting evaluated per fragment, 'L' switches between the
+// lit and unlit shader variants; --lit starts with the lit one
+//
+// Instanced field: 'I' (or --instances N) draws 1, 10, ... 100000 spheres with
+// one DrawIndexedInstanced, world matrix and diffuse color per instance in
+// vertex buffer slot 1. 'D' (or --no-instancing) draws the same field with a
+// world matrix upload and DrawIndexed per sphere. --stress [max] steps through
+// the counts up to max and reports frame time and CPU submission cost.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "ConstantBlock.h"
+#include "Log.h"
+#include "MeshOptimizer.h"
+#include "Platform.h"
+#include "Profiler.h"
+#include "Scene.h"
+#include "ShaderMath.h"
 #include "Sphere.h"
+#include "VertexEncoding.h"
+#include "VertexLayout.h"
+#include "XMath.h"
 
-// d3d Related
-#pragma comment(lib, "d3d11.lib")
-#pragma comment(lib, "d3dcompiler.lib")
-#pragma comment(lib, "Sphere.lib")
-
-using namespace std;
-
-// Macros
-#define WIN_WIDTH 800
-#define WIN_HEIGHT 600
-
-class D3D11App
+// Same layout as ObjectBuffer in vertexShader.hlsl
+struct OBJECT_CBUFFER
 {
-private:
-    HWND ghwnd;                                       // Handle to the window
-    HDC ghdc;                                         // Handle to the device context
-    HGLRC ghrc;                                       // Handle to the rendering context
-    BOOL gbFullscreen;                                // Fullscreen toggle flag
-    BOOL gbActive;                                    // Active window flag
-    DWORD dwStyle;                                    // Window style
-    WINDOWPLACEMENT wpPrev;                           // Previous window placement
-    IDXGISwapChain *gpIDXGISwapChain;                 // Swap chain interface
-    ID3D11Device *gpID3D11Device;                     // Device interface
-    ID3D11RenderTargetView *gpID3D11RenderTargetView; // Render target view interface
-    ID3D11DepthStencilView *gpID3D11DepthStencilView; // Depth stencil view interface
-    ID3D11VertexShader *gpID3D11VertexShader;         // Vertex shader interface
-    ID3D11PixelShader *gpID3D11PixelShader;           // Pixel shader interface
-    ID3D11InputLayout *gpID3D11InputLayout;           // Input layout interface
-    ID3D11Buffer *gpID3D11Buffer_PositionBuffer;      // Vertex buffer interface
-    ID3D11Buffer *gpID3D11Buffer_ColorBuffer;         // Color buffer interface
-    ID3D11Buffer *gpID3D11Buffer_IndexBuffer;         // Index buffer interface
-    ID3D11Buffer *gpID3D11Buffer_NormalBuffer;        // Normal buffer interface
-    ID3D11Buffer *gpID3D11Buffer_TexcoordBuffer;      // Texture coordinate buffer interface
-    ID3D11Buffer *gpID3D11Buffer_ConstantBuffer;      // Constant buffer interface
-    ID3D11RasterizerState *gpID3D11RasterizerState;   // Rasterizer state interface
-    float gClearColor[4];                             // Clear color array
-    float sphere_vertices[1146];
-    float sphere_normals[1146];
-    float sphere_textures[764];
-    unsigned short sphere_elements[2280];
-    unsigned int gNumElements;
-    unsigned int gNumVertices;
-    // float tangle = 0.0f; // Angle for rotation
-
-    struct CBUFFER
-    {
-        XMMATRIX WorldMatrix;
-        XMMATRIX ViewMatrix;
-        XMMATRIX ProjectionMatrix;
-
-        XMVECTOR LightAmbient;
-        XMVECTOR LightDiffuse;
-        XMVECTOR LightSpecular;
-        XMVECTOR LightPosition;
-
-        XMVECTOR MaterialAmbient;
-        XMVECTOR MaterialDiffuse;
-        XMVECTOR MaterialSpecular;
-        float MaterialShininess;
-
-        unsigned int KeyPressed;
-    };
-
-    XMMATRIX perspectiveProjectionMatrix; // Orthographic projection matrix
-
-    float lightAmbient[4] = {0.0f, 0.0f, 0.0f, 1.0f};
-    float lightDiffuse[4] = {1.0f, 1.0f, 1.0f, 1.0f}; // White Diffuse Light
-    float lightSpecular[4] = {1.0f, 1.0f, 1.0f, 1.0f};
-    float lightPosition[4] = {100.0f, 100.0f, -100.0f, 1.0f};
-
-    float materialAmbient[4] = {0.0f, 0.0f, 0.0f, 1.0f};
-    float materialDiffuse[4] = {0.5f, 0.2f, 0.7f, 1.0f};
-    float materialSpecular[4] = {0.7f, 0.7f, 0.7f, 1.0f};
-    float materialShininess = 128.0f;
-
-public:
-    FILE *gpFile;                               // Log file pointer
-    ID3D11DeviceContext *gpID3D11DeviceContext; // Device context interface
-    char gszLogFileName[256];
-    BOOL bLightingEnabled; // Lighting toggle flag
-
-public:
-    D3D11App();
-    ~D3D11App();
-    void setActive(BOOL active);           // Set active state
-    BOOL isActive() const;                 // Check if active
-    int Initialize(HWND hwnd);             // Initialize the application
-    HRESULT Resize(int width, int height); // Resize the window
-    void Render();                         // Render function
-    void Update();                         // Update function
-    void ToggleFullscreen();               // Toggle fullscreen mode
-    void Cleanup();                        // Cleanup function
-
-private:
-    string readShaderSource(const char *filePath); // Read shader source code from file
-    HRESULT setupShaders();                        // Setup shaders
-    HRESULT setupBuffers();                        // Setup vertex buffers
+    XMMATRIX WorldMatrix;
+    XMVECTOR MaterialDiffuse;
 };
 
-D3D11App app; // Global instance of D3D11App
+#define MAX_INSTANCES 100000
+#define INSTANCE_SPACING 1.25f  // Between sphere centers, the sphere is 1 across
+#define STRESS_FRAMES_PER_STEP 10 // Frames drawn at every instance count ...
+#define STRESS_WARMUP_FRAMES 2    // ... the first ones are not measured
 
-// Window Procedure
-// Handles window messages
-LRESULT CALLBACK WndProc(HWND hwnd, UINT iMsg, WPARAM wParam, LPARAM lParam)
+// One element of the per-instance vertex buffer, WORLD0..3 and COLOR
+struct INSTANCE_DATA
 {
-    HRESULT hr = S_OK;
-    switch (iMsg)
-    {
-    case WM_SETFOCUS:
-        app.setActive(TRUE); // Set app as active when window gains focus
-        break;
-    case WM_KILLFOCUS:
-        app.setActive(FALSE); // Set app as inactive when window loses focus
-        break;
-    case WM_SIZE:
-        if (app.gpID3D11DeviceContext)
-        {
-            hr = app.Resize(LOWORD(lParam), HIWORD(lParam)); // Handle window resizing
-            if (FAILED(hr))
-            {
-                app.gpFile = fopen(app.gszLogFileName, "a+");
-                fprintf(app.gpFile, "Resize Failed\n");
-                fclose(app.gpFile);
-                return hr;
-            }
-        }
-        break;
-    case WM_KEYDOWN:
-        if (wParam == VK_ESCAPE) // Exit on ESC key press
-        {
-            DestroyWindow(hwnd);
-        }
-        else if (wParam == 'F' || wParam == 'f') // Toggle fullscreen on 'F' key press
-        {
-            app.ToggleFullscreen();
-        }
-        else if (wParam == 'L' || wParam == 'l') // Toggle fullscreen on 'F' key press
-        {
-            app.bLightingEnabled = !app.bLightingEnabled; // Toggle lighting
-        }
-        break;
-    case WM_CLOSE:
-        DestroyWindow(hwnd); // Destroy window on close
-        break;
-    case WM_DESTROY:
-        PostQuitMessage(0); // Post quit message
-        break;
-    default:
-        return DefWindowProc(hwnd, iMsg, wParam, lParam); // Default message handling
-    }
-    return 0;
-}
+    float WorldMatrix[16]; // Rows of an XMMATRIX
+    float MaterialDiffuse[4];
+};
 
-// Entry Point
-// Main function for the application
-int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpszCmdLine, int iCmdShow)
+// Same layout as ViewBuffer, changes on resize
+struct VIEW_CBUFFER
 {
-    // Define and register the window class
-    WNDCLASSEX wndclass = {sizeof(WNDCLASSEX)};
-    wndclass.style = CS_HREDRAW | CS_VREDRAW | CS_OWNDC;
-    wndclass.cbClsExtra = 0;
-    wndclass.cbWndExtra = 0;
-    wndclass.lpfnWndProc = WndProc;
-    wndclass.hInstance = hInstance;
-    wndclass.hbrBackground = NULL;
-    wndclass.hIcon = LoadIcon(hInstance, MAKEINTRESOURCE(MYICON));
-    wndclass.hCursor = LoadCursor(NULL, IDC_ARROW);
-    wndclass.lpszClassName = TEXT("D3D11App");
-    wndclass.lpszMenuName = NULL;
-    wndclass.hIconSm = LoadIcon(hInstance, MAKEINTRESOURCE(MYICON));
-
-    RegisterClassEx(&wndclass);
-
-    // Create the application window
-    HWND hwnd = CreateWindow(TEXT("D3D11App"), TEXT("D3D11 Application"),
-                             WS_OVERLAPPEDWINDOW, CW_USEDEFAULT, CW_USEDEFAULT,
-                             WIN_WIDTH, WIN_HEIGHT, NULL, NULL, hInstance, NULL);
-
-    ShowWindow(hwnd, iCmdShow);
-    UpdateWindow(hwnd);
-
-    // Initialize the OpenGL application
-    if (app.Initialize(hwnd) != 0)
-    {
-        MessageBox(hwnd, TEXT("Initialization failed"), TEXT("Error"), MB_OK | MB_ICONERROR);
-        return 0;
-    }
-
-    // Main message loop
-    MSG msg;
-    BOOL bDone = FALSE;
-    while (!bDone)
-    {
-        if (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE))
-        {
-            if (msg.message == WM_QUIT)
-            {
-                bDone = TRUE; // Exit loop on quit message
-            }
-            else
-            {
-                TranslateMessage(&msg);
-                DispatchMessage(&msg);
-            }
-        }
-        else
-        {
-            if (app.isActive()) // Render and update only if the app is active
-            {
-                app.Render();
-                app.Update();
-            }
-        }
-    }
-
-    return (int)msg.wParam;
-}
-
-// D3D11App Class Implementation
-// Constructor
-D3D11App::D3D11App() : ghwnd(NULL),
-                       ghdc(NULL),
-                       ghrc(NULL),
-                       gbFullscreen(FALSE),
-                       gbActive(FALSE),
-                       dwStyle(0),
-                       wpPrev({sizeof(WINDOWPLACEMENT)}),
-                       gpIDXGISwapChain(NULL),
-                       gpID3D11Device(NULL),
-                       gpID3D11DeviceContext(NULL),
-                       gpID3D11RenderTargetView(NULL),
-                       gpID3D11DepthStencilView(NULL),
-                       gpID3D11VertexShader(NULL),
-                       gpID3D11PixelShader(NULL),
-                       gpID3D11InputLayout(NULL),
-                       gpID3D11Buffer_PositionBuffer(NULL),
-                       gpID3D11Buffer_ColorBuffer(NULL),
-                       gpID3D11Buffer_ConstantBuffer(NULL),
-                       gpID3D11RasterizerState(NULL),
-                       gpFile(NULL),
-                       bLightingEnabled(FALSE)
+    XMMATRIX ViewMatrix;
+    XMMATRIX ProjectionMatrix;
+};
 
+// Same layout as LightingBuffer, the per-frame block, only the lit variant reads it
+// The diffuse material is per object, in ObjectBuffer or the instance data
+struct LIGHTING_CBUFFER
 {
-    strcpy_s(gszLogFileName, "Log.txt");
-    gpFile = fopen(gszLogFileName, "w");
-    if (gpFile == NULL)
-    {
-        MessageBox(NULL, TEXT("Log File Cannot be Opened"),
-                   TEXT("Error"), MB_OK | MB_ICONERROR);
-        return;
-    }
-    else
-    {
-        fprintf(gpFile, "Log File Created Successfully\n");
-        fclose(gpFile);
-    }
-}
+    XMVECTOR LightAmbient;
+    XMVECTOR LightDiffuse;
+    XMVECTOR LightSpecular;
+    XMVECTOR LightPosition;
+
+    XMVECTOR MaterialAmbient;
+    XMVECTOR MaterialSpecular;
+    float MaterialShininess;
+};
 
-// Destructor
-D3D11App::~D3D11App()
+// Phong ADS from the shaders, inputs are not normalized yet
+static void phongADSLight(const LIGHTING_CBUFFER *pLighting, const float materialDiffuse[3], const float normal[3], const float lightDirection[3], const float viewerVector[3], float result[3])
 {
-    Cleanup(); // Cleanup resources
+    const float *lightAmbient = (const float *)&pLighting->LightAmbient;
+    const float *lightDiffuse = (const float *)&pLighting->LightDiffuse;
+    const float *lightSpecular = (const float *)&pLighting->LightSpecular;
+    const float *materialAmbient = (const float *)&pLighting->MaterialAmbient;
+    const float *materialSpecular = (const float *)&pLighting->MaterialSpecular;
+
+    float n[3] = {normal[0], normal[1], normal[2]};
+    float l[3] = {lightDirection[0], lightDirection[1], lightDirection[2]};
+    float v[3] = {viewerVector[0], viewerVector[1], viewerVector[2]};
+    Normalize3(n);
+    Normalize3(l);
+    Normalize3(v);
+
+    float minusL[3] = {-l[0], -l[1], -l[2]};
+    float reflectionVector[3];
+    Reflect3(reflectionVector, minusL, n);
+
+    float diffuseFactor = fmaxf(Dot3(l, n), 0.0f);
+    float specularFactor = powf(fmaxf(Dot3(reflectionVector, v), 0.0f), pLighting->MaterialShininess);
+    for (int i = 0; i < 3; i++)
+    {
+        result[i] = lightAmbient[i] * materialAmbient[i] +
+                    lightDiffuse[i] * materialDiffuse[i] * diffuseFactor +
+                    lightSpecular[i] * materialSpecular[i] * specularFactor;
+    }
 }
 
-// Set active state
-void D3D11App::setActive(BOOL active)
+// SV_POSITION plus the eye space position iCoordinates
+static void transformPosition(const void *pWorldMatrix, const VIEW_CBUFFER *pView, const SRVertexInput &input, SRVertexOutput &output, float iCoordinates[4])
 {
-    gbActive = active; // Set the active state
+    float worldCoordinates[4];
+    MulPosition(worldCoordinates, input.attributes[0], pWorldMatrix);
+    MulVector4(iCoordinates, worldCoordinates, &pView->ViewMatrix);
+    MulVector4(output.position, iCoordinates, &pView->ProjectionMatrix);
 }
 
-// Check if the application is active
-BOOL D3D11App::isActive() const
+// C++ port of vertexShader.hlsl for the software renderer, FEATURES is the
+// variant key like the defines the HLSL is compiled with
+template <unsigned int FEATURES>
+static void vertexShader(const SRShaderContext &context, const SRVertexInput &input, SRVertexOutput &output)
 {
-    return gbActive; // Return the active state
-}
+    const VIEW_CBUFFER *pView = (const VIEW_CBUFFER *)context.pConstants[CONSTANT_FREQUENCY_VIEW];
 
-// Toggle fullscreen mode
-void D3D11App::ToggleFullscreen()
-{
-    MONITORINFO mi = {sizeof(MONITORINFO)};
-    if (!gbFullscreen)
+    // WORLD0..3 are the matrix rows in the instanced variant
+    float instanceWorld[16];
+    const void *pWorldMatrix;
+    const float *materialDiffuse;
+    if (FEATURES & SHADER_FEATURE_INSTANCING)
     {
-        dwStyle = GetWindowLong(ghwnd, GWL_STYLE);
-        if (dwStyle & WS_OVERLAPPEDWINDOW)
-        {
-            if (GetWindowPlacement(ghwnd, &wpPrev) && GetMonitorInfo(MonitorFromWindow(ghwnd, MONITORINFOF_PRIMARY), &mi))
-            {
-                SetWindowLong(ghwnd, GWL_STYLE, dwStyle & ~WS_OVERLAPPEDWINDOW);
-                SetWindowPos(ghwnd, HWND_TOP, mi.rcMonitor.left, mi.rcMonitor.top,
-                             mi.rcMonitor.right - mi.rcMonitor.left, mi.rcMonitor.bottom - mi.rcMonitor.top,
-                             SWP_NOZORDER | SWP_FRAMECHANGED);
-            }
-        }
-        ShowCursor(FALSE);
-        gbFullscreen = TRUE;
+        for (int row = 0; row < 4; row++)
+            memcpy(&instanceWorld[row * 4], input.attributes[2 + row], sizeof(float) * 4);
+        pWorldMatrix = instanceWorld;
+        materialDiffuse = input.attributes[6];
     }
     else
     {
-        SetWindowPlacement(ghwnd, &wpPrev);
-        SetWindowLong(ghwnd, GWL_STYLE, dwStyle | WS_OVERLAPPEDWINDOW);
-        SetWindowPos(ghwnd, HWND_TOP, 0, 0, 0, 0,
-                     SWP_NOMOVE | SWP_NOSIZE | SWP_NOZORDER | SWP_FRAMECHANGED);
-        ShowCursor(TRUE);
-        gbFullscreen = FALSE;
+        const OBJECT_CBUFFER *pObject = (const OBJECT_CBUFFER *)context.pConstants[CONSTANT_FREQUENCY_OBJECT];
+        pWorldMatrix = &pObject->WorldMatrix;
+        materialDiffuse = (const float *)&pObject->MaterialDiffuse;
     }
-}
 
-// Initialize D3D11 and create swap chain, device, and render target view
-int D3D11App::Initialize(HWND hwnd)
-{
-    HRESULT hr = S_OK;
-
-    ghwnd = hwnd;
-
-    // Initialize swap chain description
-    DXGI_SWAP_CHAIN_DESC dxgiSwapChainDesc;
-    ZeroMemory((void *)&dxgiSwapChainDesc, sizeof(DXGI_SWAP_CHAIN_DESC));
-    dxgiSwapChainDesc.BufferDesc.Width = WIN_WIDTH;
-    dxgiSwapChainDesc.BufferDesc.Height = WIN_HEIGHT;
-    dxgiSwapChainDesc.BufferDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-    dxgiSwapChainDesc.BufferDesc.RefreshRate.Numerator = 60;
-    dxgiSwapChainDesc.BufferDesc.RefreshRate.Denominator = 1;
-    dxgiSwapChainDesc.SampleDesc.Count = 1;
-    dxgiSwapChainDesc.SampleDesc.Quality = 0;
-    dxgiSwapChainDesc.BufferCount = 1;
-    dxgiSwapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
-    dxgiSwapChainDesc.OutputWindow = ghwnd;
-    dxgiSwapChainDesc.Windowed = TRUE;
-
-    // Create swap chain, device, device context and render target view
-    D3D_DRIVER_TYPE d3dDriverType;
-    D3D_DRIVER_TYPE d3dDriverTypes[] = {D3D_DRIVER_TYPE_HARDWARE,
-                                        D3D_DRIVER_TYPE_WARP,
-                                        D3D_DRIVER_TYPE_SOFTWARE,
-                                        D3D_DRIVER_TYPE_REFERENCE,
-                                        D3D_DRIVER_TYPE_NULL,
-                                        D3D_DRIVER_TYPE_UNKNOWN};
-    D3D_FEATURE_LEVEL d3dFeatureLevel_required = D3D_FEATURE_LEVEL_11_0;
-    D3D_FEATURE_LEVEL d3dFeatureLevel_acquired = D3D_FEATURE_LEVEL_10_0;
-    UINT numDriverTypes;
-    UINT numFeatureLevels = 1;
-
-    numDriverTypes = sizeof(d3dDriverTypes) / sizeof(d3dDriverTypes[0]);
-
-    for (UINT i = 0; i < numDriverTypes; i++)
-    {
-        d3dDriverType = d3dDriverTypes[i];
-        hr = D3D11CreateDeviceAndSwapChain(NULL,
-                                           d3dDriverType,
-                                           NULL,
-                                           0,
-                                           &d3dFeatureLevel_required,
-                                           numFeatureLevels,
-                                           D3D11_SDK_VERSION,
-                                           &dxgiSwapChainDesc,
-                                           &gpIDXGISwapChain,
-                                           &gpID3D11Device,
-                                           &d3dFeatureLevel_acquired,
-                                           &gpID3D11DeviceContext);
-        if (SUCCEEDED(hr))
-            break;
-    }
+    float iCoordinates[4];
+    transformPosition(pWorldMatrix, pView, input, output, iCoordinates);
 
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "D3D11CreateDeviceAndSwapChain Failed\n");
-        fclose(gpFile);
-        return hr;
-    }
-    else
+    if (FEATURES & SHADER_FEATURE_LIGHTING)
     {
-        // print which driver we found
-        gpFile = fopen(gszLogFileName, "a+");
-        if (d3dDriverType == D3D_DRIVER_TYPE_HARDWARE)
-        {
-            fprintf(gpFile, "D3D11CreateDeviceAndSwapChain Succeeded with Hardware Driver\n");
-        }
-        else if (d3dDriverType == D3D_DRIVER_TYPE_WARP)
-        {
-            fprintf(gpFile, "D3D11CreateDeviceAndSwapChain Succeeded with WARP\n");
-        }
-        else if (d3dDriverType == D3D_DRIVER_TYPE_SOFTWARE)
-        {
-            fprintf(gpFile, "D3D11CreateDeviceAndSwapChain Succeeded with SOFTWARE\n");
-        }
-        else if (d3dDriverType == D3D_DRIVER_TYPE_REFERENCE)
-        {
-            fprintf(gpFile, "D3D11CreateDeviceAndSwapChain Succeeded with REFERENCE\n");
-        }
-        else if (d3dDriverType == D3D_DRIVER_TYPE_NULL)
-        {
-            fprintf(gpFile, "D3D11CreateDeviceAndSwapChain Succeeded with NULL\n");
-        }
-        else if (d3dDriverType == D3D_DRIVER_TYPE_UNKNOWN)
-        {
-            fprintf(gpFile, "D3D11CreateDeviceAndSwapChain Succeeded with UNKNOWN\n");
-        }
-        else
-        {
-            fprintf(gpFile, "D3D11CreateDeviceAndSwapChain Succeeded with Undefined Driver\n");
-        }
+        const LIGHTING_CBUFFER *pLighting = (const LIGHTING_CBUFFER *)context.pConstants[CONSTANT_FREQUENCY_FRAME];
+        const float *lightPosition = (const float *)&pLighting->LightPosition;
 
-        // which feature level we found
-        if (d3dFeatureLevel_acquired == D3D_FEATURE_LEVEL_11_0)
-        {
-            fprintf(gpFile, "D3D11CreateDeviceAndSwapChain Succeeded with Feature Level 11.0\n");
-        }
-        else if (d3dFeatureLevel_acquired == D3D_FEATURE_LEVEL_10_1)
-        {
-            fprintf(gpFile, "D3D11CreateDeviceAndSwapChain Succeeded with Feature Level 10.1\n");
-        }
-        else if (d3dFeatureLevel_acquired == D3D_FEATURE_LEVEL_10_0)
-        {
-            fprintf(gpFile, "D3D11CreateDeviceAndSwapChain Succeeded with Feature Level 10.0\n");
-        }
-        else
+        // transformedNormals, lightDirection, viewerVector
+        float normal[3];
+        OctahedralDecode(input.attributes[1], normal);
+        MulVector3(&output.varyings[0], normal, pWorldMatrix);
+        for (int i = 0; i < 3; i++)
         {
-            fprintf(gpFile, "D3D11CreateDeviceAndSwapChain Succeeded with Feature Level UNKNOWN\n");
+            output.varyings[3 + i] = lightPosition[i] - iCoordinates[i];
+            output.varyings[6 + i] = -iCoordinates[i];
         }
 
-        fclose(gpFile);
-    }
-
-    // Set up shaders
-    setupShaders();
-
-    // Set up buffers
-    setupBuffers();
-
-    // create and set rasterizer state to off back face culling
-    D3D11_RASTERIZER_DESC d3dRasterizerDesc;
-    ZeroMemory((void *)&d3dRasterizerDesc, sizeof(D3D11_RASTERIZER_DESC));
-    d3dRasterizerDesc.CullMode = D3D11_CULL_NONE;
-    d3dRasterizerDesc.FillMode = D3D11_FILL_SOLID;
-    d3dRasterizerDesc.MultisampleEnable = FALSE;
-    d3dRasterizerDesc.DepthBias = 0;
-    d3dRasterizerDesc.DepthBiasClamp = 0.0f;
-    d3dRasterizerDesc.SlopeScaledDepthBias = 0;
-    d3dRasterizerDesc.DepthClipEnable = TRUE;
-    d3dRasterizerDesc.AntialiasedLineEnable = FALSE;
-    d3dRasterizerDesc.FrontCounterClockwise = FALSE;
-    d3dRasterizerDesc.ScissorEnable = FALSE;
-
-    hr = gpID3D11Device->CreateRasterizerState(&d3dRasterizerDesc, &gpID3D11RasterizerState);
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateRasterizerState Failed for Constant Buffer\n");
-        fclose(gpFile);
-        return hr;
-    }
-    else
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateRasterizerState Successful for Constant Buffer\n");
-        fclose(gpFile);
-    }
-
-    // set above structure into pipeline
-    gpID3D11DeviceContext->RSSetState(gpID3D11RasterizerState);
-
-    gClearColor[0] = 0.0f;
-    gClearColor[1] = 0.0f;
-    gClearColor[2] = 0.0f;
-    gClearColor[3] = 1.0f;
-
-    perspectiveProjectionMatrix = XMMatrixIdentity();
-
-    // warmup resize
-    hr = Resize(WIN_WIDTH, WIN_HEIGHT);
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "Resize Failed\n");
-        fclose(gpFile);
-        return hr;
+        // diffuseMaterial
+        memcpy(&output.varyings[9], materialDiffuse, sizeof(float) * 3);
     }
-    else
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "Resized Successfully\n");
-        fclose(gpFile);
-    }
-
-    return hr;
 }
 
-HRESULT D3D11App::setupShaders()
+// C++ port of pixelShader.hlsl
+template <unsigned int FEATURES>
+static void pixelShader(const SRShaderContext &context, const float *varyings, float color[4])
 {
-    HRESULT hr = S_OK;
-    // Vertex Shader
-    std::string vertexShaderSourceCode = readShaderSource("vertexShader.hlsl");
-
-    ID3DBlob *pID3DBlob_VertexShaderSourceCode = NULL;
-    ID3DBlob *pID3DBlob_Error = NULL;
-
-    // Compile above Shader
-    hr = D3DCompile(vertexShaderSourceCode.c_str(),
-                    vertexShaderSourceCode.length(),
-                    "VS",
-                    NULL,
-                    D3D_COMPILE_STANDARD_FILE_INCLUDE,
-                    "main",
-                    "vs_5_0",
-                    0,
-                    0,
-                    &pID3DBlob_VertexShaderSourceCode,
-                    &pID3DBlob_Error);
-
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "Vertex Shader Compiling Error = %s\n", (char *)pID3DBlob_Error->GetBufferPointer());
-        fclose(gpFile);
-        return hr;
-    }
-    else
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "Vertex Shader Compiling Successful\n");
-        fclose(gpFile);
-    }
-
-    // create the vertex shader from above code
-    hr = gpID3D11Device->CreateVertexShader(pID3DBlob_VertexShaderSourceCode->GetBufferPointer(),
-                                            pID3DBlob_VertexShaderSourceCode->GetBufferSize(),
-                                            NULL,
-                                            &gpID3D11VertexShader);
-
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateVertexShader Failed\n");
-        fclose(gpFile);
-        return hr;
-    }
-    else
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateVertexShader Successful\n");
-        fclose(gpFile);
-    }
-
-    // set above created vertex shader in pipeline
-    gpID3D11DeviceContext->VSSetShader(gpID3D11VertexShader, NULL, 0);
-
-    // Pixel Shader
-    string pixelShaderSourceCode = readShaderSource("pixelShader.hlsl");
-
-    ID3DBlob *pID3DBlob_PixelShaderSourceCode = NULL;
-    pID3DBlob_Error = NULL;
-
-    // Compile above Shader
-    hr = D3DCompile(pixelShaderSourceCode.c_str(),
-                    pixelShaderSourceCode.length(),
-                    "PS",
-                    NULL,
-                    D3D_COMPILE_STANDARD_FILE_INCLUDE,
-                    "main",
-                    "ps_5_0",
-                    0,
-                    0,
-                    &pID3DBlob_PixelShaderSourceCode,
-                    &pID3DBlob_Error);
-
-    if (FAILED(hr))
+    if (FEATURES & SHADER_FEATURE_LIGHTING)
     {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "Pixel Shader Compiling Error = %s\n", (char *)pID3DBlob_Error->GetBufferPointer());
-        fclose(gpFile);
-        return hr;
+        const LIGHTING_CBUFFER *pLighting = (const LIGHTING_CBUFFER *)context.pConstants[CONSTANT_FREQUENCY_FRAME];
+        phongADSLight(pLighting, &varyings[9], &varyings[0], &varyings[3], &varyings[6], color);
     }
     else
     {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "Pixel Shader Compiling Successful\n");
-        fclose(gpFile);
+        color[0] = color[1] = color[2] = 1.0f;
     }
+    color[3] = 1.0f;
+}
 
-    // create the Pixel shader from above code
-    hr = gpID3D11Device->CreatePixelShader(pID3DBlob_PixelShaderSourceCode->GetBufferPointer(),
-                                           pID3DBlob_PixelShaderSourceCode->GetBufferSize(),
-                                           NULL,
-                                           &gpID3D11PixelShader);
-
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreatePixelShader Failed\n");
-        fclose(gpFile);
-        return hr;
-    }
-    else
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreatePixelShader Successful\n");
-        fclose(gpFile);
-    }
+class PerFragmentLightingScene : public Scene
+{
+private:
+    ShaderHandle shaders[SHADER_PERMUTATION_COUNT]; // Indexed by SHADER_FEATURE_* mask
+    BufferHandle vertexBuffer; // Half position and octahedral normal, 12 bytes per vertex
+    BufferHandle indexBuffer;
+    ConstantBlock frameConstants;  // Light and material, uploaded once
+    ConstantBlock viewConstants;   // View and projection, uploaded again after a resize
+    ConstantBlock objectConstants; // World matrix and diffuse material of the sphere
+    VertexLayout vertexLayout;
+    float gClearColor[4];                 // Clear color array
+    XMMATRIX perspectiveProjectionMatrix; // Perspective projection matrix
+    float aspectRatio;
+    unsigned int gNumElements;
+    IndexFormat gIndexFormat; // 16 bit unless the sphere has more than 65536 vertices
+    unsigned int shaderFeatures; // Variant drawn with, 'L' toggles SHADER_FEATURE_LIGHTING
+
+    // instanced field, instanceCount 0 is the single sphere
+    BufferHandle instanceBuffer; // MAX_INSTANCES spiralling out from the center, created on first use
+    std::vector<INSTANCE_DATA> instances;
+    unsigned int instanceCount;
+    bool bInstancing; // false draws the field one DrawIndexed per sphere
+
+    // stress mode, STRESS_FRAMES_PER_STEP frames at every power of ten up to stressMaxInstances
+    bool bStress;
+    unsigned int stressMaxInstances;
+    unsigned int stressFrame;
+    double stressFrameMilliseconds;
+    double stressSubmitMilliseconds;
+    std::chrono::steady_clock::time_point lastFrameStart;
+    bool bHaveLastFrame;
+
+    float lightAmbient[4];
+    float lightDiffuse[4];
+    float lightSpecular[4];
+    float lightPosition[4];
+
+    float materialAmbient[4];
+    float materialDiffuse[4];
+    float materialSpecular[4];
+    float materialShininess;
 
-    // set above created Pixel shader in pipeline
-    gpID3D11DeviceContext->PSSetShader(gpID3D11PixelShader, NULL, 0);
+public:
+    PerFragmentLightingScene();
+    int Initialize(Renderer *pRenderer);
+    void Resize(int width, int height);
+    void Render(Renderer *pRenderer);
+    void OnKeyDown(unsigned int key);
+    bool SetOption(const char *name, const char *value);
 
-    // release Error Blob
-    if (pID3DBlob_Error)
-    {
-        pID3DBlob_Error->Release();
-        pID3DBlob_Error = NULL;
-    }
+private:
+    bool createInstanceBuffer(Renderer *pRenderer);
+    void renderField(Renderer *pRenderer);
+    void setInstanceCount(unsigned int count);
+    void updateStress(double frameMilliseconds, double submitMilliseconds);
+};
 
-    // release pixel blob
-    if (pID3DBlob_PixelShaderSourceCode)
-    {
-        pID3DBlob_PixelShaderSourceCode->Release();
-        pID3DBlob_PixelShaderSourceCode = NULL;
-    }
+Scene *CreateScene()
+{
+    return new PerFragmentLightingScene();
+}
 
-    // initialise input element structure
-    D3D11_INPUT_ELEMENT_DESC d3dInputElementDesc[2];
-    ZeroMemory((void *)d3dInputElementDesc, sizeof(D3D11_INPUT_ELEMENT_DESC) * _ARRAYSIZE(d3dInputElementDesc));
-
-    d3dInputElementDesc[0].SemanticName = "POSITION";
-    d3dInputElementDesc[0].SemanticIndex = 0;
-    d3dInputElementDesc[0].Format = DXGI_FORMAT_R32G32B32_FLOAT;
-    d3dInputElementDesc[0].InputSlot = 0;
-    d3dInputElementDesc[0].AlignedByteOffset = 0;
-    d3dInputElementDesc[0].InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
-    d3dInputElementDesc[0].InstanceDataStepRate = 0;
-
-    d3dInputElementDesc[1].SemanticName = "NORMAL";
-    d3dInputElementDesc[1].SemanticIndex = 0;
-    d3dInputElementDesc[1].Format = DXGI_FORMAT_R32G32B32_FLOAT;
-    d3dInputElementDesc[1].InputSlot = 1;
-    d3dInputElementDesc[1].AlignedByteOffset = 0;
-    d3dInputElementDesc[1].InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
-    d3dInputElementDesc[1].InstanceDataStepRate = 0;
-
-    // using above structure create input layout
-    hr = gpID3D11Device->CreateInputLayout(d3dInputElementDesc,
-                                           _ARRAYSIZE(d3dInputElementDesc),
-                                           pID3DBlob_VertexShaderSourceCode->GetBufferPointer(),
-                                           pID3DBlob_VertexShaderSourceCode->GetBufferSize(),
-                                           &gpID3D11InputLayout);
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateInputLayout Failed\n");
-        fclose(gpFile);
-        return hr;
-    }
-    else
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateInputLayout Successful\n");
-        fclose(gpFile);
-    }
+// Constructor
+PerFragmentLightingScene::PerFragmentLightingScene() : vertexBuffer(0),
+                                                       indexBuffer(0),
+                                                       frameConstants(CONSTANT_FREQUENCY_FRAME, sizeof(LIGHTING_CBUFFER)),
+                                                       viewConstants(CONSTANT_FREQUENCY_VIEW, sizeof(VIEW_CBUFFER)),
+                                                       objectConstants(CONSTANT_FREQUENCY_OBJECT, sizeof(OBJECT_CBUFFER)),
+                                                       aspectRatio(1.0f),
+                                                       gNumElements(0),
+                                                       gIndexFormat(INDEX_FORMAT_UINT16),
+                                                       shaderFeatures(0),
+                                                       instanceBuffer(0),
+                                                       instanceCount(0),
+                                                       bInstancing(true),
+                                                       bStress(false),
+                                                       stressMaxInstances(MAX_INSTANCES),
+                                                       stressFrame(0),
+                                                       stressFrameMilliseconds(0.0),
+                                                       stressSubmitMilliseconds(0.0),
+                                                       bHaveLastFrame(false)
+{
+    for (int i = 0; i < SHADER_PERMUTATION_COUNT; i++)
+        shaders[i] = 0;
 
-    // set above input layout into pipeline
-    gpID3D11DeviceContext->IASetInputLayout(gpID3D11InputLayout);
+    gClearColor[0] = 0.0f;
+    gClearColor[1] = 0.0f;
+    gClearColor[2] = 0.0f;
+    gClearColor[3] = 1.0f;
 
-    // now we can release vertex shader blob
-    if (pID3DBlob_VertexShaderSourceCode)
-    {
-        pID3DBlob_VertexShaderSourceCode->Release();
-        pID3DBlob_VertexShaderSourceCode = NULL;
-    }
+    perspectiveProjectionMatrix = XMMatrixIdentity();
 
-    return hr;
+    const float initialLightAmbient[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+    const float initialLightDiffuse[4] = {1.0f, 1.0f, 1.0f, 1.0f}; // White Diffuse Light
+    const float initialLightSpecular[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    const float initialLightPosition[4] = {100.0f, 100.0f, -100.0f, 1.0f};
+
+    const float initialMaterialAmbient[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+    const float initialMaterialDiffuse[4] = {0.5f, 0.2f, 0.7f, 1.0f};
+    const float initialMaterialSpecular[4] = {0.7f, 0.7f, 0.7f, 1.0f};
+
+    memcpy(lightAmbient, initialLightAmbient, sizeof(lightAmbient));
+    memcpy(lightDiffuse, initialLightDiffuse, sizeof(lightDiffuse));
+    memcpy(lightSpecular, initialLightSpecular, sizeof(lightSpecular));
+    memcpy(lightPosition, initialLightPosition, sizeof(lightPosition));
+    memcpy(materialAmbient, initialMaterialAmbient, sizeof(materialAmbient));
+    memcpy(materialDiffuse, initialMaterialDiffuse, sizeof(materialDiffuse));
+    memcpy(materialSpecular, initialMaterialSpecular, sizeof(materialSpecular));
+    materialShininess = 128.0f;
 }
 
-// Function to set up buffers
-HRESULT D3D11App::setupBuffers()
+int PerFragmentLightingScene::Initialize(Renderer *pRenderer)
 {
-    HRESULT hr = S_OK;
+    // shaders and input layout, the vertex shader decodes the normal
+    vertexLayout.Add("POSITION", 0, VERTEX_ENCODING_HALF);
+    vertexLayout.Add("NORMAL", 0, VERTEX_ENCODING_OCTAHEDRAL);
+
+    ShaderDesc shaderDesc;
+    memset(&shaderDesc, 0, sizeof(ShaderDesc));
+    shaderDesc.vertexShaderFile = "vertexShader.hlsl";
+    shaderDesc.pixelShaderFile = "pixelShader.hlsl";
+    shaderDesc.pElements = vertexLayout.GetElements();
+    shaderDesc.numElements = vertexLayout.GetElementCount();
+
+    // unlit variant passes no varyings, the lit one normal, light and viewer vectors and the diffuse material
+    shaderDesc.softwareVertexShader = vertexShader<0>;
+    shaderDesc.softwarePixelShader = pixelShader<0>;
+    shaderDesc.numVaryings = 0;
+    shaders[0] = CreateShaderPermutation(pRenderer, shaderDesc, 0);
+    shaderDesc.softwareVertexShader = vertexShader<SHADER_FEATURE_LIGHTING>;
+    shaderDesc.softwarePixelShader = pixelShader<SHADER_FEATURE_LIGHTING>;
+    shaderDesc.numVaryings = 12;
+    shaders[SHADER_FEATURE_LIGHTING] = CreateShaderPermutation(pRenderer, shaderDesc, SHADER_FEATURE_LIGHTING);
+    if (shaders[0] == 0 || shaders[SHADER_FEATURE_LIGHTING] == 0)
+        return -1;
+
+    // instanced variants add the per-instance world matrix rows and diffuse color in slot 1
+    VertexLayout instanceLayout(1);
+    instanceLayout.Add("WORLD", 0, VERTEX_ENCODING_FLOAT4);
+    instanceLayout.Add("WORLD", 1, VERTEX_ENCODING_FLOAT4);
+    instanceLayout.Add("WORLD", 2, VERTEX_ENCODING_FLOAT4);
+    instanceLayout.Add("WORLD", 3, VERTEX_ENCODING_FLOAT4);
+    instanceLayout.Add("COLOR", 0, VERTEX_ENCODING_FLOAT4);
+
+    std::vector<VertexElement> instancedElements(vertexLayout.GetElements(), vertexLayout.GetElements() + vertexLayout.GetElementCount());
+    instancedElements.insert(instancedElements.end(), instanceLayout.GetElements(), instanceLayout.GetElements() + instanceLayout.GetElementCount());
+    shaderDesc.pElements = instancedElements.data();
+    shaderDesc.numElements = (unsigned int)instancedElements.size();
+    shaderDesc.instanceSlotMask = 1u << 1;
+
+    shaderDesc.softwareVertexShader = vertexShader<SHADER_FEATURE_INSTANCING>;
+    shaderDesc.softwarePixelShader = pixelShader<SHADER_FEATURE_INSTANCING>;
+    shaderDesc.numVaryings = 0;
+    shaders[SHADER_FEATURE_INSTANCING] = CreateShaderPermutation(pRenderer, shaderDesc, SHADER_FEATURE_INSTANCING);
+    shaderDesc.softwareVertexShader = vertexShader<SHADER_FEATURE_LIGHTING | SHADER_FEATURE_INSTANCING>;
+    shaderDesc.softwarePixelShader = pixelShader<SHADER_FEATURE_LIGHTING | SHADER_FEATURE_INSTANCING>;
+    shaderDesc.numVaryings = 12;
+    shaders[SHADER_FEATURE_LIGHTING | SHADER_FEATURE_INSTANCING] = CreateShaderPermutation(pRenderer, shaderDesc, SHADER_FEATURE_LIGHTING | SHADER_FEATURE_INSTANCING);
+    if (shaders[SHADER_FEATURE_INSTANCING] == 0 || shaders[SHADER_FEATURE_LIGHTING | SHADER_FEATURE_INSTANCING] == 0)
+        return -1;
 
     // declare geometry
-    // position
-    getSphereVertexData(sphere_vertices, sphere_normals, sphere_textures, sphere_elements);
-    gNumVertices = getNumberOfSphereVertices();
-    gNumElements = getNumberOfSphereElements();
-
-    // Position VB
-    D3D11_BUFFER_DESC bufferDesc;
-    ZeroMemory(&bufferDesc, sizeof(D3D11_BUFFER_DESC));
-    bufferDesc.Usage = D3D11_USAGE_DEFAULT;
-    bufferDesc.ByteWidth = gNumVertices * 3 * sizeof(float);
-    bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-    D3D11_SUBRESOURCE_DATA d3d11SubresourceData;
-    ZeroMemory((void *)&d3d11SubresourceData, sizeof(D3D11_SUBRESOURCE_DATA));
-    d3d11SubresourceData.pSysMem = sphere_vertices;
-    hr = gpID3D11Device->CreateBuffer(&bufferDesc, &d3d11SubresourceData, &gpID3D11Buffer_PositionBuffer);
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateBuffer Failed for Vertex Buffer\n");
-        fclose(gpFile);
-        return hr;
-    }
-    else
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateBuffer Successful for Vertex Buffer\n");
-        fclose(gpFile);
-    }
-
-    // Normals VB
-    // Follow Same Above Method For Normals And Textures
-    ZeroMemory(&bufferDesc, sizeof(D3D11_BUFFER_DESC));
-    bufferDesc.Usage = D3D11_USAGE_DEFAULT;
-    bufferDesc.ByteWidth = gNumVertices * 3 * sizeof(float);
-    bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-    ZeroMemory((void *)&d3d11SubresourceData, sizeof(D3D11_SUBRESOURCE_DATA));
-    d3d11SubresourceData.pSysMem = sphere_normals;
-    hr = gpID3D11Device->CreateBuffer(&bufferDesc, &d3d11SubresourceData, &gpID3D11Buffer_NormalBuffer);
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateBuffer Failed for Vertex Buffer\n");
-        fclose(gpFile);
-        return hr;
-    }
-    else
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateBuffer Successful for Vertex Buffer\n");
-        fclose(gpFile);
-    }
-
-    ZeroMemory(&bufferDesc, sizeof(D3D11_BUFFER_DESC));
-    bufferDesc.Usage = D3D11_USAGE_DEFAULT;
-    bufferDesc.ByteWidth = gNumVertices * 2 * sizeof(float);
-    bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-    ZeroMemory((void *)&d3d11SubresourceData, sizeof(D3D11_SUBRESOURCE_DATA));
-    d3d11SubresourceData.pSysMem = sphere_textures;
-    hr = gpID3D11Device->CreateBuffer(&bufferDesc, &d3d11SubresourceData, &gpID3D11Buffer_TexcoordBuffer);
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateBuffer Failed for Vertex Buffer\n");
-        fclose(gpFile);
-        return hr;
-    }
-    else
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateBuffer Successful for Vertex Buffer\n");
-        fclose(gpFile);
-    }
-
-    // create index buffer
-    ZeroMemory(&bufferDesc, sizeof(D3D11_BUFFER_DESC));
-    bufferDesc.Usage = D3D11_USAGE_DEFAULT;
-    bufferDesc.ByteWidth = gNumElements * sizeof(short);
-    bufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-    ZeroMemory((void *)&d3d11SubresourceData, sizeof(D3D11_SUBRESOURCE_DATA));
-    d3d11SubresourceData.pSysMem = sphere_elements;
-    hr = gpID3D11Device->CreateBuffer(&bufferDesc, &d3d11SubresourceData, &gpID3D11Buffer_IndexBuffer);
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateBuffer Failed for Vertex Buffer\n");
-        fclose(gpFile);
-        return hr;
-    }
-    else
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateBuffer Successful for Vertex Buffer\n");
-        fclose(gpFile);
-    }
-
-    // create constant buffer to send tranformation like uniform data
-    ZeroMemory((void *)&bufferDesc, sizeof(D3D11_BUFFER_DESC));
-    bufferDesc.Usage = D3D11_USAGE_DEFAULT;
-    bufferDesc.ByteWidth = sizeof(CBUFFER);
-    bufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-
-    // create Constant buffer using above structure
-    hr = gpID3D11Device->CreateBuffer(&bufferDesc, NULL, &gpID3D11Buffer_ConstantBuffer);
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateBuffer Failed for Constant Buffer\n");
-        fclose(gpFile);
-        return hr;
-    }
-    else
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateBuffer Successful for Constant Buffer\n");
-        fclose(gpFile);
-    }
-
-    // set above buffer into pipeline
-    gpID3D11DeviceContext->VSSetConstantBuffers(0, 1, &gpID3D11Buffer_ConstantBuffer);
-    gpID3D11DeviceContext->PSSetConstantBuffers(0, 1, &gpID3D11Buffer_ConstantBuffer);
-
-    return hr;
+    SphereDesc sphereDesc;
+    GetDefaultSphereDesc(sphereDesc);
+    SphereMesh sphere;
+    if (!GenerateSphere(sphereDesc, sphere))
+        return -1;
+
+    // reorder for the post-transform cache, overdraw and vertex fetch
+    MeshOptimizationReport optimization;
+    OptimizeMesh(sphere, &optimization);
+    LogInfo("Sphere ACMR %.3f -> %.3f, ATVR %.3f -> %.3f\n", optimization.before.acmr, optimization.after.acmr,
+            optimization.before.atvr, optimization.after.atvr);
+
+    gNumElements = sphere.indexCount;
+    gIndexFormat = sphere.indexFormat;
+
+    // 12 bytes per vertex instead of the 32 of SphereVertex
+    const void *sources[] = {sphere.vertices[0].position, sphere.vertices[0].normal};
+    const unsigned int sourceStrides[] = {sizeof(SphereVertex), sizeof(SphereVertex)};
+    std::vector<unsigned char> vertices;
+    vertexLayout.Pack(sources, sourceStrides, (unsigned int)sphere.vertices.size(), vertices);
+
+    BufferDesc vertexBufferDesc = {BUFFER_TYPE_VERTEX, (unsigned int)vertices.size(), vertices.data()};
+    vertexBuffer = pRenderer->CreateBuffer(vertexBufferDesc);
+
+    BufferDesc indexBufferDesc = {BUFFER_TYPE_INDEX, sphere.GetIndexDataSize(), sphere.GetIndexData()};
+    indexBuffer = pRenderer->CreateBuffer(indexBufferDesc);
+
+    // light and material never change, so the block is only uploaded by its first Bind()
+    LIGHTING_CBUFFER lighting;
+    memset(&lighting, 0, sizeof(LIGHTING_CBUFFER));
+    lighting.LightAmbient = XMVectorSet(lightAmbient[0], lightAmbient[1], lightAmbient[2], 0.0f);
+    lighting.LightDiffuse = XMVectorSet(lightDiffuse[0], lightDiffuse[1], lightDiffuse[2], 0.0f);
+    lighting.LightSpecular = XMVectorSet(lightSpecular[0], lightSpecular[1], lightSpecular[2], 0.0f);
+    lighting.LightPosition = XMVectorSet(lightPosition[0], lightPosition[1], lightPosition[2], lightPosition[3]);
+
+    lighting.MaterialAmbient = XMVectorSet(materialAmbient[0], materialAmbient[1], materialAmbient[2], 0.0f);
+    lighting.MaterialSpecular = XMVectorSet(materialSpecular[0], materialSpecular[1], materialSpecular[2], 0.0f);
+    lighting.MaterialShininess = materialShininess;
+
+    frameConstants.Update(&lighting);
+
+    if (vertexBuffer == 0 || indexBuffer == 0)
+        return -1;
+    return 0;
 }
 
-// Resize the swap chain and render target view
-HRESULT D3D11App::Resize(int width, int height)
+void PerFragmentLightingScene::Resize(int width, int height)
 {
-    // variable dec
-    HRESULT hr = S_OK;
-
-    if (gpID3D11DepthStencilView)
-    {
-        gpID3D11DepthStencilView->Release();
-        gpID3D11DepthStencilView = NULL;
-    }
-
-    // release rtv
-    if (gpID3D11RenderTargetView)
-    {
-        gpID3D11RenderTargetView->Release();
-        gpID3D11RenderTargetView = NULL;
-    }
-
-    // resize the swapchain buffers according to the changese size
-    gpIDXGISwapChain->ResizeBuffers(1, width, height, DXGI_FORMAT_R8G8B8A8_UNORM, 0);
-
-    // create new reender target view
-    // A. get the buffer from rtv from swapchain into the texture (just like FBO)
-    ID3D11Texture2D *pID3D11texture2d = NULL;
-    gpIDXGISwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void **)&pID3D11texture2d);
-
-    // B. create new rtv using above buffer
-    hr = gpID3D11Device->CreateRenderTargetView(pID3D11texture2d, NULL, &gpID3D11RenderTargetView);
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateRenderTargetView Failed\n");
-        fclose(gpFile);
-        pID3D11texture2d->Release();
-        pID3D11texture2d = NULL;
-        return hr;
-    }
-    else
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateRenderTargetView Successful\n");
-        fclose(gpFile);
-    }
-
-    pID3D11texture2d->Release();
-    pID3D11texture2d = NULL;
-
-    // create an empty texture according to changed resize, we will call it depth buffer
-    D3D11_TEXTURE2D_DESC d3dtexture2dDesc;
-    ZeroMemory(&d3dtexture2dDesc, sizeof(D3D11_TEXTURE2D_DESC));
-    d3dtexture2dDesc.Width = (UINT)width;
-    d3dtexture2dDesc.Height = (UINT)height;
-    d3dtexture2dDesc.MipLevels = 1;
-    d3dtexture2dDesc.ArraySize = 1;
-    d3dtexture2dDesc.SampleDesc.Count = 1;
-    d3dtexture2dDesc.SampleDesc.Quality = 0;
-    d3dtexture2dDesc.Usage = D3D11_USAGE_DEFAULT;
-    d3dtexture2dDesc.Format = DXGI_FORMAT_D32_FLOAT;
-    d3dtexture2dDesc.BindFlags = D3D11_BIND_DEPTH_STENCIL;
-    d3dtexture2dDesc.CPUAccessFlags = 0;
-    d3dtexture2dDesc.MiscFlags = 0;
-
-    ID3D11Texture2D *pID3D11texture2d_DepthBuffer = NULL;
-
-    hr = gpID3D11Device->CreateTexture2D(&d3dtexture2dDesc, NULL, &pID3D11texture2d_DepthBuffer);
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateTexture2D for Depth Stencil Buffer Failed\n");
-        fclose(gpFile);
-        return hr;
-    }
-    else
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateTexture2D for Depth Stencil Buffer Successful\n");
-        fclose(gpFile);
-    }
-
-    // create depth Stencil View
-    D3D11_DEPTH_STENCIL_VIEW_DESC d3dDepthStencilViewDesc;
-    ZeroMemory((void *)&d3dDepthStencilViewDesc, sizeof(D3D11_DEPTH_STENCIL_VIEW_DESC));
-    d3dDepthStencilViewDesc.Format = DXGI_FORMAT_D32_FLOAT;
-    d3dDepthStencilViewDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2DMS;
-
-    hr = gpID3D11Device->CreateDepthStencilView(pID3D11texture2d_DepthBuffer, &d3dDepthStencilViewDesc, &gpID3D11DepthStencilView);
-    if (FAILED(hr))
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateDepthStencilView Failed\n");
-        fclose(gpFile);
-        pID3D11texture2d_DepthBuffer->Release();
-        pID3D11texture2d_DepthBuffer = NULL;
-        return hr;
-    }
-    else
-    {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "CreateDepthStencilView Successful\n");
-        fclose(gpFile);
-    }
-
-    pID3D11texture2d_DepthBuffer->Release();
-    pID3D11texture2d_DepthBuffer = NULL;
-
-    // C. set this new rtv into OM state pipeline
-    gpID3D11DeviceContext->OMSetRenderTargets(1, &gpID3D11RenderTargetView, gpID3D11DepthStencilView);
-
-    // set the viewport
-    D3D11_VIEWPORT d3dViewport;
-    ZeroMemory((void *)&d3dViewport, sizeof(D3D11_VIEWPORT));
-    d3dViewport.TopLeftX = 0.0f;
-    d3dViewport.TopLeftY = 0.0f;
-    d3dViewport.Width = (float)width;
-    d3dViewport.Height = (float)height;
-    d3dViewport.MinDepth = 0.0f;
-    d3dViewport.MaxDepth = 1.0f;
-
-    // set above viewport in pipeline
-    gpID3D11DeviceContext->RSSetViewports(1, &d3dViewport);
-
-    // initialise perpective projection matrix
-    perspectiveProjectionMatrix = XMMatrixPerspectiveFovLH(XMConvertToRadians(45.0f), (float)width / (float)height, 0.1f, 100.0f);
-
-    // Code
-    return hr;
+    // initialise perspective projection matrix
+    aspectRatio = (float)width / (float)height;
+    perspectiveProjectionMatrix = XMMatrixPerspectiveFovLH(XMConvertToRadians(45.0f), aspectRatio, 0.1f, 100.0f);
 }
 
 // Render the scene
-void D3D11App::Render()
+void PerFragmentLightingScene::Render(Renderer *pRenderer)
 {
-    // Code
-    // clear the rtv using clear color
-    gpID3D11DeviceContext->ClearRenderTargetView(gpID3D11RenderTargetView, gClearColor);
-    gpID3D11DeviceContext->ClearDepthStencilView(gpID3D11DepthStencilView, D3D11_CLEAR_DEPTH, 1.0f, 0);
-
-    // transformations
-    XMMATRIX worldMatrix = XMMatrixIdentity();
-    worldMatrix = XMMatrixTranslation(0.0f, 0.0f, 3.0f);
-    XMMATRIX viewMatrix = XMMatrixIdentity();
-
-    CBUFFER constantBuffer;
-    ZeroMemory((void *)&constantBuffer, sizeof(CBUFFER));
+    std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
+    double frameMilliseconds = bHaveLastFrame ? std::chrono::duration<double, std::milli>(frameStart - lastFrameStart).count() : 0.0;
+    lastFrameStart = frameStart;
+    bHaveLastFrame = true;
 
-    constantBuffer.WorldMatrix = worldMatrix;
-    constantBuffer.ViewMatrix = viewMatrix;
-    constantBuffer.ProjectionMatrix = perspectiveProjectionMatrix;
+    // clear the rtv using clear color
+    pRenderer->Clear(gClearColor);
 
-    if (bLightingEnabled == TRUE)
+    if (instanceCount > 0)
     {
-        constantBuffer.KeyPressed = 1;
-        constantBuffer.LightAmbient = XMVectorSet(lightAmbient[0], lightAmbient[1], lightAmbient[2], 0.0f);
-        constantBuffer.LightDiffuse = XMVectorSet(lightDiffuse[0], lightDiffuse[1], lightDiffuse[2], 0.0f);
-        constantBuffer.LightSpecular = XMVectorSet(lightSpecular[0], lightSpecular[1], lightSpecular[2], 0.0f);
-        constantBuffer.LightPosition = XMVectorSet(lightPosition[0], lightPosition[1], lightPosition[2], lightPosition[3]);
-
-        constantBuffer.MaterialAmbient = XMVectorSet(materialAmbient[0], materialAmbient[1], materialAmbient[2], 0.0f);
-        constantBuffer.MaterialDiffuse = XMVectorSet(materialDiffuse[0], materialDiffuse[1], materialDiffuse[2], 0.0f);
-        constantBuffer.MaterialSpecular = XMVectorSet(materialSpecular[0], materialSpecular[1], materialSpecular[2], 0.0f);
-        constantBuffer.MaterialShininess = materialShininess;
-    }
-    else
-    {
-        constantBuffer.KeyPressed = 0;
+        renderField(pRenderer);
+        double submitMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+        if (bStress)
+            updateStress(frameMilliseconds, submitMilliseconds);
+        return;
     }
 
-    gpID3D11DeviceContext->UpdateSubresource(gpID3D11Buffer_ConstantBuffer, 0, NULL, &constantBuffer, 0, 0);
-
-    // set position buffer into pipeline Here
-    UINT stride = sizeof(float) * 3;
-    UINT offset = 0;
-
-    gpID3D11DeviceContext->IASetVertexBuffers(0, 1, &gpID3D11Buffer_PositionBuffer, &stride, &offset);
+    VIEW_CBUFFER view;
+    memset(&view, 0, sizeof(VIEW_CBUFFER));
+    view.ViewMatrix = XMMatrixIdentity();
+    view.ProjectionMatrix = perspectiveProjectionMatrix;
+    viewConstants.Update(&view);
 
-    // normal
-    stride = sizeof(float) * 3;
-    offset = 0;
-
-    gpID3D11DeviceContext->IASetVertexBuffers(1, 1, &gpID3D11Buffer_NormalBuffer, &stride, &offset);
-
-    // set index buffer
-    gpID3D11DeviceContext->IASetIndexBuffer(gpID3D11Buffer_IndexBuffer, DXGI_FORMAT_R16_UINT, 0); // R16 maps with 'short'
-
-    // set primitive geometry
-    gpID3D11DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    // transformations
+    OBJECT_CBUFFER object;
+    memset(&object, 0, sizeof(OBJECT_CBUFFER));
+    object.WorldMatrix = XMMatrixTranslation(0.0f, 0.0f, 3.0f);
+    object.MaterialDiffuse = XMVectorSet(materialDiffuse[0], materialDiffuse[1], materialDiffuse[2], 0.0f);
+    objectConstants.Update(&object);
+
+    pRenderer->SetShader(shaders[shaderFeatures]);
+    if (shaderFeatures & SHADER_FEATURE_LIGHTING)
+        frameConstants.Bind(pRenderer);
+    viewConstants.Bind(pRenderer);
+    objectConstants.Bind(pRenderer);
+    pRenderer->SetVertexBuffer(0, vertexBuffer, vertexLayout.GetStride(), 0);
+    pRenderer->SetIndexBuffer(indexBuffer, gIndexFormat);
+    pRenderer->SetPrimitiveTopology(PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
     // draw the geometry
-    gpID3D11DeviceContext->DrawIndexed(gNumElements, 0, 0);
-
-    // do double buffering by presenting the swapchain
-    gpIDXGISwapChain->Present(0, 0);
-}
-
-// Update the application state
-void D3D11App::Update()
-{
+    pRenderer->DrawIndexed(gNumElements, 0, 0);
 }
 
-// Cleanup resources
-void D3D11App::Cleanup()
+// Instances on a square spiral around the origin, so the first n always form a compact field
+bool PerFragmentLightingScene::createInstanceBuffer(Renderer *pRenderer)
 {
-    if (gbFullscreen == TRUE)
-    {
-        ToggleFullscreen();
-        gbFullscreen = FALSE;
-    }
-
-    // Destroy Window
-    if (ghwnd)
-    {
-        DestroyWindow(ghwnd);
-        ghwnd = NULL;
+    instances.resize(MAX_INSTANCES);
+    int x = 0, y = 0, dx = 1, dy = 0;
+    int segmentLength = 1, segmentPassed = 0, turns = 0;
+    for (unsigned int i = 0; i < MAX_INSTANCES; i++)
+    {
+        INSTANCE_DATA &instance = instances[i];
+        memset(&instance, 0, sizeof(INSTANCE_DATA));
+        instance.WorldMatrix[0] = instance.WorldMatrix[5] = instance.WorldMatrix[10] = instance.WorldMatrix[15] = 1.0f;
+        instance.WorldMatrix[12] = x * INSTANCE_SPACING;
+        instance.WorldMatrix[13] = y * INSTANCE_SPACING;
+
+        // a material per instance, varied so neighbours differ
+        instance.MaterialDiffuse[0] = 0.3f + 0.7f * (float)((i * 7) % 11) / 10.0f;
+        instance.MaterialDiffuse[1] = 0.2f + 0.6f * (float)((i * 5) % 13) / 12.0f;
+        instance.MaterialDiffuse[2] = 0.4f + 0.6f * (float)((i * 3) % 7) / 6.0f;
+        instance.MaterialDiffuse[3] = 1.0f;
+
+        x += dx;
+        y += dy;
+        if (++segmentPassed == segmentLength)
+        {
+            segmentPassed = 0;
+            int temp = dx;
+            dx = -dy;
+            dy = temp;
+            if (++turns % 2 == 0)
+                segmentLength++;
+        }
     }
 
-    if (gpID3D11DepthStencilView)
+    BufferDesc instanceBufferDesc = {BUFFER_TYPE_VERTEX, (unsigned int)(instances.size() * sizeof(INSTANCE_DATA)), instances.data()};
+    instanceBuffer = pRenderer->CreateBuffer(instanceBufferDesc);
+    if (instanceBuffer == 0)
     {
-        gpID3D11DepthStencilView->Release();
-        gpID3D11DepthStencilView = NULL;
+        LogError("Instance buffer creation Failed\n");
+        return false;
     }
+    return true;
+}
 
-    if (gpID3D11RasterizerState)
+void PerFragmentLightingScene::renderField(Renderer *pRenderer)
+{
+    PROFILE_SCOPE("renderField");
+    if (instanceBuffer == 0 && !createInstanceBuffer(pRenderer))
     {
-        gpID3D11RasterizerState->Release();
-        gpID3D11RasterizerState = NULL;
+        instanceCount = 0;
+        return;
     }
 
-    if (gpID3D11Buffer_ConstantBuffer)
-    {
-        gpID3D11Buffer_ConstantBuffer->Release();
-        gpID3D11Buffer_ConstantBuffer = NULL;
+    // back off until the whole spiral fits the 45 degree field of view
+    float halfExtent = (sqrtf((float)instanceCount) * 0.5f + 1.0f) * INSTANCE_SPACING;
+    float distance = halfExtent / tanf(XMConvertToRadians(22.5f)) / (aspectRatio < 1.0f ? aspectRatio : 1.0f);
+    VIEW_CBUFFER view;
+    memset(&view, 0, sizeof(VIEW_CBUFFER));
+    view.ViewMatrix = XMMatrixTranslation(0.0f, 0.0f, distance);
+    view.ProjectionMatrix = XMMatrixPerspectiveFovLH(XMConvertToRadians(45.0f), aspectRatio, 0.1f, distance + 10.0f);
+    viewConstants.Update(&view);
+
+    unsigned int features = shaderFeatures | (bInstancing ? SHADER_FEATURE_INSTANCING : 0);
+    pRenderer->SetShader(shaders[features]);
+    if (shaderFeatures & SHADER_FEATURE_LIGHTING)
+        frameConstants.Bind(pRenderer);
+    viewConstants.Bind(pRenderer);
+    pRenderer->SetVertexBuffer(0, vertexBuffer, vertexLayout.GetStride(), 0);
+    pRenderer->SetIndexBuffer(indexBuffer, gIndexFormat);
+    pRenderer->SetPrimitiveTopology(PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+    if (bInstancing)
+    {
+        // one draw, the input assembler steps through slot 1 once per instance
+        pRenderer->SetVertexBuffer(1, instanceBuffer, sizeof(INSTANCE_DATA), 0);
+        pRenderer->DrawIndexedInstanced(gNumElements, instanceCount, 0, 0, 0);
+        return;
     }
 
-    if (gpID3D11Buffer_ColorBuffer)
+    // the same field the way the single sphere is drawn, an object block per sphere
+    OBJECT_CBUFFER object;
+    memset(&object, 0, sizeof(OBJECT_CBUFFER));
+    for (unsigned int i = 0; i < instanceCount; i++)
     {
-        gpID3D11Buffer_ColorBuffer->Release();
-        gpID3D11Buffer_ColorBuffer = NULL;
+        memcpy(&object.WorldMatrix, instances[i].WorldMatrix, sizeof(instances[i].WorldMatrix));
+        memcpy(&object.MaterialDiffuse, instances[i].MaterialDiffuse, sizeof(instances[i].MaterialDiffuse));
+        objectConstants.Update(&object);
+        objectConstants.Bind(pRenderer);
+        pRenderer->DrawIndexed(gNumElements, 0, 0);
     }
+}
 
-    if (gpID3D11Buffer_PositionBuffer)
-    {
-        gpID3D11Buffer_PositionBuffer->Release();
-        gpID3D11Buffer_PositionBuffer = NULL;
-    }
+void PerFragmentLightingScene::setInstanceCount(unsigned int count)
+{
+    instanceCount = count < MAX_INSTANCES ? count : MAX_INSTANCES;
+    LogInfo("Instances %u, %s\n", instanceCount, bInstancing ? "DrawIndexedInstanced" : "DrawIndexed per sphere");
+}
 
-    if (gpID3D11InputLayout)
+// Average the measured frames of a step, report them and move on to ten times the instances
+void PerFragmentLightingScene::updateStress(double frameMilliseconds, double submitMilliseconds)
+{
+    stressFrame++;
+    if (stressFrame > STRESS_WARMUP_FRAMES)
     {
-        gpID3D11InputLayout->Release();
-        gpID3D11InputLayout = NULL;
+        stressFrameMilliseconds += frameMilliseconds;
+        stressSubmitMilliseconds += submitMilliseconds;
     }
+    if (stressFrame < STRESS_FRAMES_PER_STEP)
+        return;
 
-    if (gpID3D11InputLayout)
-    {
-        gpID3D11InputLayout->Release();
-        gpID3D11InputLayout = NULL;
-    }
+    double measured = STRESS_FRAMES_PER_STEP - STRESS_WARMUP_FRAMES;
+    double frame = stressFrameMilliseconds / measured;
+    double submit = stressSubmitMilliseconds / measured;
+    printf("stress %6u instances: frame %9.3f ms, submission %9.3f ms, %8.3f us/instance\n",
+           instanceCount, frame, submit, submit * 1000.0 / instanceCount);
+    LogInfo("Stress %u instances: frame %.3f ms, submission %.3f ms, %.3f us/instance\n",
+            instanceCount, frame, submit, submit * 1000.0 / instanceCount);
+
+    stressFrame = 0;
+    stressFrameMilliseconds = 0.0;
+    stressSubmitMilliseconds = 0.0;
+    if (instanceCount * 10 <= stressMaxInstances)
+        setInstanceCount(instanceCount * 10);
+    else
+        bStress = false; // Done, keep drawing the largest field
+}
 
-    if (gpID3D11PixelShader)
+void PerFragmentLightingScene::OnKeyDown(unsigned int key)
+{
+    if (key == 'L') // Switch lit/unlit variant on 'L' key press
     {
-        gpID3D11PixelShader->Release();
-        gpID3D11PixelShader = NULL;
+        shaderFeatures ^= SHADER_FEATURE_LIGHTING;
     }
-
-    if (gpID3D11VertexShader)
+    else if (key == 'I') // Single sphere, then 1, 10, ... MAX_INSTANCES instances
     {
-        gpID3D11VertexShader->Release();
-        gpID3D11VertexShader = NULL;
+        setInstanceCount(instanceCount == 0 ? 1 : (instanceCount >= MAX_INSTANCES ? 0 : instanceCount * 10));
     }
-
-    if (gpID3D11DeviceContext)
+    else if (key == 'D') // Instanced draw or one draw per sphere
     {
-        gpID3D11DeviceContext->Release();
-        gpID3D11DeviceContext = NULL;
+        bInstancing = !bInstancing;
+        setInstanceCount(instanceCount);
     }
+}
 
-    if (gpIDXGISwapChain)
+bool PerFragmentLightingScene::SetOption(const char *name, const char *value)
+{
+    if (strcmp(name, "lit") == 0) // Start with the lit variant, like pressing 'L' once
     {
-        gpIDXGISwapChain->Release();
-        gpIDXGISwapChain = NULL;
+        shaderFeatures |= SHADER_FEATURE_LIGHTING;
+        return true;
     }
-
-    if (gpID3D11Device)
+    if (strcmp(name, "instances") == 0 && value)
     {
-        gpID3D11Device->Release();
-        gpID3D11Device = NULL;
+        setInstanceCount((unsigned int)atoi(value));
+        return true;
     }
-
-    if (gpFile)
+    if (strcmp(name, "no-instancing") == 0)
     {
-        fprintf(gpFile, "Closing log file\n");
-        fclose(gpFile);
-        gpFile = NULL;
+        bInstancing = false;
+        return true;
     }
-}
-
-string D3D11App::readShaderSource(const char *filePath)
-{
-    std::ifstream shaderFile(filePath, std::ios::in);
-    if (!shaderFile.is_open())
+    if (strcmp(name, "stress") == 0)
     {
-        gpFile = fopen(gszLogFileName, "a+");
-        fprintf(gpFile, "Failed to open shader file: %s\n", filePath);
-        fclose(gpFile);
-        return "";
+        bStress = true;
+        if (value)
+            stressMaxInstances = (unsigned int)atoi(value);
+        if (stressMaxInstances < 1 || stressMaxInstances > MAX_INSTANCES)
+            stressMaxInstances = MAX_INSTANCES;
+        setInstanceCount(1);
+        return true;
     }
-
-    std::stringstream shaderStream;
-    shaderStream << shaderFile.rdbuf();
-    shaderFile.close();
-
-    return shaderStream.str();
+    return false;
 }
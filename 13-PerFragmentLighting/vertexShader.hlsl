@@ -1,42 +1,72 @@
-cbuffer ConstantBuffer
+cbuffer ViewBuffer : register(b1)
 {
-    float4x4 worldMatrix;
     float4x4 viewMatrix;
     float4x4 projectionMatrix;
+}
+#ifndef INSTANCING
+cbuffer ObjectBuffer : register(b2)
+{
+    float4x4 worldMatrix;
+    float4 materialDiffuse;
+}
+#endif
+#ifdef LIGHTING
+cbuffer LightingBuffer : register(b0)
+{
     float4 lightAmbient;
     float4 lightDiffuse;
     float4 lightSpecular;
     float4 lightPosition;
     float4 materialAmbient;
-    float4 materialDiffuse;
     float4 materialSpecular;
     float materialShininess;
-    uint keyPressed;
 }
+#endif
 struct vertex_output
 {
     float4 position : SV_POSITION;
+#ifdef LIGHTING
     float3 transformedNormals : NORMAL0;
     float3 lightDirection : NORMAL1;
     float3 viewerVector : NORMAL2;
+    float3 diffuseMaterial : COLOR;
+#endif
 };
-vertex_output main(float4 pos : POSITION, float3 norm : NORMAL)
+// NORMAL is octahedral, two snorm16 values the input assembler expands to [-1, 1]
+float3 octahedralDecode(float2 encoded)
+{
+    float3 n = float3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));
+    float t = saturate(-n.z);
+    n.xy += (n.xy >= 0.0) ? -t : t;
+    return normalize(n);
+}
+#ifdef INSTANCING
+// WORLD0..3 are the rows of the instance's XMMATRIX, so the vector goes on the left
+vertex_output main(float4 pos : POSITION, float2 octNormal : NORMAL,
+                   float4 world0 : WORLD0, float4 world1 : WORLD1, float4 world2 : WORLD2, float4 world3 : WORLD3,
+                   float4 diffuse : COLOR)
+{
+    float4x4 instanceWorld = float4x4(world0, world1, world2, world3);
+    float4 worldPosition = mul(pos, instanceWorld);
+#else
+vertex_output main(float4 pos : POSITION, float2 octNormal : NORMAL)
 {
+    float4 worldPosition = mul(worldMatrix, pos);
+#endif
     vertex_output output;
-    if (keyPressed == 1)
-    {
-        float4 iCoordinates = mul(viewMatrix, mul(worldMatrix, pos));
-        output.transformedNormals = mul((float3x3)worldMatrix, norm);
-        output.lightDirection = (float3)(lightPosition - iCoordinates);
-        output.viewerVector = -iCoordinates.xyz;
-    }
-    else
-    {
-        output.transformedNormals = float3(0.0, 0.0, 0.0);
-        output.lightDirection = float3(0.0, 0.0, 0.0);
-        output.viewerVector = float3(0.0, 0.0, 0.0);
-    }
-    float4 position = mul(projectionMatrix, mul(viewMatrix, mul(worldMatrix, pos)));
+#ifdef LIGHTING
+    float4 iCoordinates = mul(viewMatrix, worldPosition);
+#ifdef INSTANCING
+    output.transformedNormals = mul(octahedralDecode(octNormal), (float3x3)instanceWorld);
+    output.diffuseMaterial = diffuse.rgb;
+#else
+    output.transformedNormals = mul((float3x3)worldMatrix, octahedralDecode(octNormal));
+    output.diffuseMaterial = materialDiffuse.rgb;
+#endif
+    output.lightDirection = (float3)(lightPosition - iCoordinates);
+    output.viewerVector = -iCoordinates.xyz;
+#endif
+    float4 position = mul(projectionMatrix, mul(viewMatrix, worldPosition));
     output.position = position;
     return output;
 }
@@ -0,0 +1,140 @@
+// Batched object transform benchmark
+// Builds world and world * view * projection matrices for --objects objects
+// with random positions, angles and scales, three ways:
+//   per object     XMMatrixScaling * XMMatrixRotationX/Y/Z * XMMatrixTranslation,
+//                  then * viewProjection, one XMMatrixMultiply at a time like
+//                  Render() in 06-Cube-3DRotation
+//   batch scalar   ComposeWorldViewProjection() with TRANSFORM_BATCH_FLAG_SCALAR
+//   batch SIMD     ComposeWorldViewProjection(), GetTransformBatchWidth() objects
+//                  per iteration; build with -mavx2 -mfma or -mavx512f for 8 or 16
+// and reports millions of matrices per second (best of --repeat runs), each
+// world * view * projection counting as one, with the largest difference of
+// the batched results from the per object ones.
+//
+// Usage: BatchTransforms [--objects 100000] [--repeat 20]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "TransformBatch.h"
+
+static float random01()
+{
+    return (float)rand() / (float)RAND_MAX;
+}
+
+static void perObject(const TransformBatch &batch, CXMMATRIX viewProjection, XMMATRIX *pWorld, XMMATRIX *pWorldViewProjection)
+{
+    for (unsigned int i = 0; i < batch.count; i++)
+    {
+        XMMATRIX worldMatrix = XMMatrixScaling(batch.scaleX[i], batch.scaleY[i], batch.scaleZ[i]) *
+                               XMMatrixRotationX(batch.rotationX[i]) * XMMatrixRotationY(batch.rotationY[i]) * XMMatrixRotationZ(batch.rotationZ[i]) *
+                               XMMatrixTranslation(batch.positionX[i], batch.positionY[i], batch.positionZ[i]);
+        pWorld[i] = worldMatrix;
+        pWorldViewProjection[i] = XMMatrixMultiply(worldMatrix, viewProjection);
+    }
+}
+
+// Largest element difference, relative to the element once it is above 1
+static double maxDifference(const std::vector<XMMATRIX> &a, const std::vector<XMMATRIX> &b)
+{
+    double worst = 0.0;
+    for (size_t n = 0; n < a.size(); n++)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                double expected = b[n].m[i][j];
+                double difference = fabs(a[n].m[i][j] - expected) / (fabs(expected) > 1.0 ? fabs(expected) : 1.0);
+                if (difference > worst)
+                    worst = difference;
+            }
+        }
+    }
+    return worst;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int objects = 100000;
+    int repeat = 20;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--objects") == 0 && i + 1 < argc)
+            objects = (unsigned int)atol(argv[++i]);
+        else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+            repeat = atoi(argv[++i]);
+        else
+        {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (objects == 0 || repeat < 1)
+    {
+        fprintf(stderr, "--objects and --repeat must be positive\n");
+        return 1;
+    }
+
+    TransformBatch batch;
+    batch.Resize(objects);
+    srand(1);
+    for (unsigned int i = 0; i < objects; i++)
+    {
+        batch.positionX[i] = random01() * 200.0f - 100.0f;
+        batch.positionY[i] = random01() * 200.0f - 100.0f;
+        batch.positionZ[i] = random01() * 200.0f - 100.0f;
+        batch.rotationX[i] = random01() * 4.0f * XM_2PI - 2.0f * XM_2PI;
+        batch.rotationY[i] = random01() * 4.0f * XM_2PI - 2.0f * XM_2PI;
+        batch.rotationZ[i] = random01() * 4.0f * XM_2PI - 2.0f * XM_2PI;
+        batch.scaleX[i] = 0.5f + random01();
+        batch.scaleY[i] = 0.5f + random01();
+        batch.scaleZ[i] = 0.5f + random01();
+    }
+
+    XMMATRIX viewProjection = XMMatrixTranslation(0.0f, 0.0f, 150.0f) * XMMatrixPerspectiveFovLH(XMConvertToRadians(45.0f), 800.0f / 600.0f, 0.1f, 300.0f);
+
+    std::vector<XMMATRIX> referenceWorld(objects);
+    std::vector<XMMATRIX> referenceWorldViewProjection(objects);
+    std::vector<XMMATRIX> world(objects);
+    std::vector<XMMATRIX> worldViewProjection(objects);
+
+    printf("%-14s %6s %12s %10s %12s %12s\n", "", "width", "Mmatrices/s", "speedup", "world diff", "wvp diff");
+
+    double perObjectBest = 0.0;
+    for (int run = 0; run < 3; run++)
+    {
+        const char *name = run == 0 ? "per object" : run == 1 ? "batch scalar" : "batch SIMD";
+        unsigned int flags = run == 1 ? TRANSFORM_BATCH_FLAG_SCALAR : 0;
+
+        double best = 0.0;
+        for (int i = 0; i < repeat; i++)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            if (run == 0)
+                perObject(batch, viewProjection, referenceWorld.data(), referenceWorldViewProjection.data());
+            else
+                ComposeWorldViewProjection(batch, viewProjection, world.data(), worldViewProjection.data(), flags);
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (i == 0 || seconds < best)
+                best = seconds;
+        }
+        if (run == 0)
+            perObjectBest = best;
+
+        printf("%-14s %6u %12.1f %9.2fx", name, run == 2 ? GetTransformBatchWidth() : 1, objects / best / 1.0e6, perObjectBest / best);
+        if (run == 0)
+            printf(" %12s %12s\n", "-", "-");
+        else
+            printf(" %12.2e %12.2e\n", maxDifference(world, referenceWorld), maxDifference(worldViewProjection, referenceWorldViewProjection));
+    }
+    printf("%u objects, best of %d\n", objects, repeat);
+
+    return 0;
+}
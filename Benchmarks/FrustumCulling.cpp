@@ -0,0 +1,165 @@
+// Frustum culling benchmark
+// Scatters --objects bounding spheres and boxes through a 200 unit cube in
+// front of a camera whose frustum comes from the projection matrix
+// 13-PerFragmentLighting builds in Resize() (45 degrees, 4:3, 0.1 to 100),
+// culls them with FrustumCuller and reports millions of objects culled per
+// second, best of --repeat runs:
+//   scalar      FRUSTUM_CULLER_FLAG_SCALAR on one thread
+//   SIMD        the SIMDLanes.h path on one thread
+//   SIMD xN     the SIMD path on N JobSystem.h threads, doubling up to --threads
+// Every visible list is checked against a double precision test of each
+// object; objects within 1e-3 of a plane may go either way.
+//
+// Usage: FrustumCulling [--objects 1000000] [--repeat 20] [--threads 0]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "FrustumCuller.h"
+#include "JobSystem.h"
+
+static float random01()
+{
+    return (float)rand() / (float)RAND_MAX;
+}
+
+// Smallest signed plane distance of the object's furthest point, in double
+static double referenceDistance(const Frustum &frustum, double x, double y, double z, double ex, double ey, double ez, double radius)
+{
+    double nearest = 0.0;
+    for (int p = 0; p < 6; p++)
+    {
+        const float *plane = frustum.planes[p];
+        double distance = plane[0] * x + plane[1] * y + plane[2] * z + plane[3] +
+                          fabs(plane[0]) * ex + fabs(plane[1]) * ey + fabs(plane[2]) * ez + radius;
+        if (p == 0 || distance < nearest)
+            nearest = distance;
+    }
+    return nearest;
+}
+
+// Counts objects on the wrong side of the list, ignoring those at a plane
+template <typename ReferenceDistance>
+static unsigned int checkVisible(unsigned int count, const std::vector<unsigned int> &visible, unsigned int visibleCount, ReferenceDistance distance)
+{
+    unsigned int errors = 0;
+    unsigned int next = 0;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        bool bListed = next < visibleCount && visible[next] == i;
+        if (bListed)
+            next++;
+        double nearest = distance(i);
+        if (fabs(nearest) > 1.0e-3 && bListed != (nearest >= 0.0))
+            errors++;
+    }
+    return errors + (visibleCount - next); // Anything left was out of order
+}
+
+struct Run
+{
+    const char *name;
+    unsigned int threads;
+    unsigned int flags;
+};
+
+int main(int argc, char *argv[])
+{
+    unsigned int objects = 1000000;
+    int repeat = 20;
+    unsigned int maxThreads = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--objects") == 0 && i + 1 < argc)
+            objects = (unsigned int)atol(argv[++i]);
+        else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+            repeat = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            maxThreads = (unsigned int)atoi(argv[++i]);
+        else
+        {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (objects == 0 || repeat < 1)
+    {
+        fprintf(stderr, "--objects and --repeat must be positive\n");
+        return 1;
+    }
+    if (maxThreads == 0)
+        maxThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+
+    XMMATRIX viewMatrix = XMMatrixTranslation(0.0f, 0.0f, 10.0f);
+    XMMATRIX perspectiveProjectionMatrix = XMMatrixPerspectiveFovLH(XMConvertToRadians(45.0f), 800.0f / 600.0f, 0.1f, 100.0f);
+    Frustum frustum;
+    ExtractFrustum(viewMatrix * perspectiveProjectionMatrix, frustum);
+
+    BoundingSpheres spheres;
+    BoundingBoxes boxes;
+    spheres.Resize(objects);
+    boxes.Resize(objects);
+    srand(1);
+    for (unsigned int i = 0; i < objects; i++)
+    {
+        spheres.centerX[i] = boxes.centerX[i] = random01() * 200.0f - 100.0f;
+        spheres.centerY[i] = boxes.centerY[i] = random01() * 200.0f - 100.0f;
+        spheres.centerZ[i] = boxes.centerZ[i] = random01() * 200.0f - 100.0f;
+        spheres.radius[i] = 0.5f + random01() * 2.0f;
+        boxes.extentX[i] = 0.5f + random01() * 2.0f;
+        boxes.extentY[i] = 0.5f + random01() * 2.0f;
+        boxes.extentZ[i] = 0.5f + random01() * 2.0f;
+    }
+
+    std::vector<Run> runs;
+    runs.push_back(Run{"scalar", 1, FRUSTUM_CULLER_FLAG_SCALAR});
+    runs.push_back(Run{"SIMD", 1, 0});
+    for (unsigned int threads = 2; threads < maxThreads * 2; threads *= 2)
+        runs.push_back(Run{"SIMD", threads < maxThreads ? threads : maxThreads, 0});
+
+    printf("%-10s %8s %10s %10s %10s %10s %8s\n", "", "threads", "spheres", "Mobj/s", "boxes", "Mobj/s", "errors");
+
+    std::vector<unsigned int> visible;
+    for (size_t r = 0; r < runs.size(); r++)
+    {
+        JobsInitialize(runs[r].threads);
+        FrustumCuller culler;
+        culler.Initialize(runs[r].flags);
+
+        double best[2] = {0.0, 0.0};
+        unsigned int visibleCount[2] = {0, 0};
+        unsigned int errors = 0;
+        for (int type = 0; type < 2; type++)
+        {
+            for (int i = 0; i < repeat; i++)
+            {
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                visibleCount[type] = type == 0 ? culler.CullSpheres(frustum, spheres, visible) : culler.CullBoxes(frustum, boxes, visible);
+                double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                if (i == 0 || seconds < best[type])
+                    best[type] = seconds;
+            }
+
+            if (type == 0)
+                errors += checkVisible(objects, visible, visibleCount[type], [&](unsigned int i)
+                                       { return referenceDistance(frustum, spheres.centerX[i], spheres.centerY[i], spheres.centerZ[i], 0.0, 0.0, 0.0, spheres.radius[i]); });
+            else
+                errors += checkVisible(objects, visible, visibleCount[type], [&](unsigned int i)
+                                       { return referenceDistance(frustum, boxes.centerX[i], boxes.centerY[i], boxes.centerZ[i], boxes.extentX[i], boxes.extentY[i], boxes.extentZ[i], 0.0); });
+        }
+
+        printf("%-10s %8u %10u %10.1f %10u %10.1f %8u\n", runs[r].name, JobsGetThreadCount(),
+               visibleCount[0], objects / best[0] / 1.0e6, visibleCount[1], objects / best[1] / 1.0e6, errors);
+        culler.Cleanup();
+        JobsCleanup();
+    }
+    printf("%u objects, best of %d\n", objects, repeat);
+
+    return 0;
+}
@@ -0,0 +1,381 @@
+// Headless CPU run of the 13-PerFragmentLighting pipeline
+// Renders the lit sphere with SoftwareRasterizer instead of a D3D11 device and
+// reports triangles/sec and fragments/sec. "--lighting vertex" evaluates the
+// 12-PerVertexLighting shaders instead, so both lighting models can be timed
+// on a machine without a GPU.
+//
+// "--branch dynamic" runs the shaders the way they were before permutations,
+// deciding lit/unlit per vertex and fragment from KeyPressed in the cbuffer;
+// "--branch static" (the default) uses the variant compiled for that choice,
+// like the samples do now. Comparing the two gives the cost of the branch.
+//
+// Usage: HeadlessLighting [--width 800] [--height 600] [--frames 200] [--threads 0]
+//                         [--lighting fragment|vertex|off] [--branch static|dynamic]
+//                         [--output frame.bmp]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+
+#include "Image.h"
+#include "JobSystem.h"
+#include "MeshOptimizer.h"
+#include "SoftwareRasterizer.h"
+#include "Sphere.h"
+
+// Macros
+#define WIN_WIDTH 800
+#define WIN_HEIGHT 600
+#define PI 3.14159265358979323846f
+
+// The benchmark's own single block, the layout 13-PerFragmentLighting used
+// before its constants were split into ViewBuffer, ObjectBuffer and
+// LightingBuffer; matrices are row major like XMMATRIX and used as row
+// vector * matrix
+struct CBUFFER
+{
+    float WorldMatrix[16];
+    float ViewMatrix[16];
+    float ProjectionMatrix[16];
+
+    float LightAmbient[4];
+    float LightDiffuse[4];
+    float LightSpecular[4];
+    float LightPosition[4];
+
+    float MaterialAmbient[4];
+    float MaterialDiffuse[4];
+    float MaterialSpecular[4];
+    float MaterialShininess;
+
+    unsigned int KeyPressed;
+};
+
+// Small helpers standing in for the XNAMath calls used in Render() and Resize()
+static void matrixIdentity(float m[16])
+{
+    memset(m, 0, sizeof(float) * 16);
+    m[0] = m[5] = m[10] = m[15] = 1.0f;
+}
+
+static void matrixTranslation(float m[16], float x, float y, float z)
+{
+    matrixIdentity(m);
+    m[12] = x;
+    m[13] = y;
+    m[14] = z;
+}
+
+static void matrixPerspectiveFovLH(float m[16], float fovAngleY, float aspectRatio, float nearZ, float farZ)
+{
+    float yScale = 1.0f / tanf(fovAngleY * 0.5f);
+    float xScale = yScale / aspectRatio;
+    float range = farZ / (farZ - nearZ);
+
+    memset(m, 0, sizeof(float) * 16);
+    m[0] = xScale;
+    m[5] = yScale;
+    m[10] = range;
+    m[11] = 1.0f;
+    m[14] = -range * nearZ;
+}
+
+// out = v * m, v has four components
+static inline void transform4(float out[4], const float v[4], const float m[16])
+{
+    for (int c = 0; c < 4; c++)
+        out[c] = v[0] * m[c] + v[1] * m[4 + c] + v[2] * m[8 + c] + v[3] * m[12 + c];
+}
+
+// out = v * (float3x3)m
+static inline void transform3(float out[3], const float v[3], const float m[16])
+{
+    for (int c = 0; c < 3; c++)
+        out[c] = v[0] * m[c] + v[1] * m[4 + c] + v[2] * m[8 + c];
+}
+
+static inline float dot3(const float a[3], const float b[3])
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static inline void normalize3(float v[3])
+{
+    float length = sqrtf(dot3(v, v));
+    if (length > 0.0f)
+    {
+        v[0] /= length;
+        v[1] /= length;
+        v[2] /= length;
+    }
+}
+
+// Phong ADS, same math as pixelShader.hlsl of 13-PerFragmentLighting
+static void phongADS(const CBUFFER *pCB, const float normal[3], const float lightDirection[3], const float viewerVector[3], float result[3])
+{
+    float n[3] = {normal[0], normal[1], normal[2]};
+    float l[3] = {lightDirection[0], lightDirection[1], lightDirection[2]};
+    float v[3] = {viewerVector[0], viewerVector[1], viewerVector[2]};
+    normalize3(n);
+    normalize3(l);
+    normalize3(v);
+
+    // reflect(-l, n) = -l - 2 * dot(n, -l) * n
+    float nDotL = dot3(l, n);
+    float r[3];
+    for (int i = 0; i < 3; i++)
+        r[i] = -l[i] + 2.0f * nDotL * n[i];
+
+    float diffuseFactor = fmaxf(nDotL, 0.0f);
+    float specularFactor = powf(fmaxf(dot3(r, v), 0.0f), pCB->MaterialShininess);
+    for (int i = 0; i < 3; i++)
+    {
+        result[i] = pCB->LightAmbient[i] * pCB->MaterialAmbient[i] +
+                    pCB->LightDiffuse[i] * pCB->MaterialDiffuse[i] * diffuseFactor +
+                    pCB->LightSpecular[i] * pCB->MaterialSpecular[i] * specularFactor;
+    }
+}
+
+// Where the lit/unlit decision comes from, see --branch
+#define BRANCH_DYNAMIC 0 // KeyPressed read from the cbuffer
+#define BRANCH_LIT 1     // Compiled in, like the LIGHTING variant
+#define BRANCH_UNLIT 2   // Compiled in, like the unlit variant
+
+template <int BRANCH>
+static inline bool lightingEnabled(const CBUFFER *pCB)
+{
+    if (BRANCH == BRANCH_DYNAMIC)
+        return pCB->KeyPressed == 1;
+    return BRANCH == BRANCH_LIT;
+}
+
+// Shared vertex transform, returns eye space position
+static void transformVertex(const CBUFFER *pCB, const SRVertexInput &input, SRVertexOutput &output, float eyeCoordinates[4])
+{
+    float pos[4] = {input.attributes[0][0], input.attributes[0][1], input.attributes[0][2], 1.0f};
+    float worldCoordinates[4];
+    transform4(worldCoordinates, pos, pCB->WorldMatrix);
+    transform4(eyeCoordinates, worldCoordinates, pCB->ViewMatrix);
+    transform4(output.position, eyeCoordinates, pCB->ProjectionMatrix);
+}
+
+// 13-PerFragmentLighting/vertexShader.hlsl
+template <int BRANCH>
+static void perFragmentVertexShader(const SRShaderContext &context, const SRVertexInput &input, SRVertexOutput &output)
+{
+    const CBUFFER *pCB = (const CBUFFER *)context.pConstants[0];
+    float iCoordinates[4];
+    transformVertex(pCB, input, output, iCoordinates);
+
+    if (lightingEnabled<BRANCH>(pCB))
+    {
+        transform3(&output.varyings[0], input.attributes[1], pCB->WorldMatrix);
+        for (int i = 0; i < 3; i++)
+        {
+            output.varyings[3 + i] = pCB->LightPosition[i] - iCoordinates[i];
+            output.varyings[6 + i] = -iCoordinates[i];
+        }
+    }
+    else if (BRANCH == BRANCH_DYNAMIC)
+    {
+        memset(output.varyings, 0, sizeof(float) * 9); // The unlit variant has no varyings
+    }
+}
+
+// 13-PerFragmentLighting/pixelShader.hlsl
+template <int BRANCH>
+static void perFragmentPixelShader(const SRShaderContext &context, const float *varyings, float color[4])
+{
+    const CBUFFER *pCB = (const CBUFFER *)context.pConstants[0];
+    if (lightingEnabled<BRANCH>(pCB))
+    {
+        phongADS(pCB, &varyings[0], &varyings[3], &varyings[6], color);
+    }
+    else
+    {
+        color[0] = color[1] = color[2] = 1.0f;
+    }
+    color[3] = 1.0f;
+}
+
+// 12-PerVertexLighting/vertexShader.hlsl
+template <int BRANCH>
+static void perVertexVertexShader(const SRShaderContext &context, const SRVertexInput &input, SRVertexOutput &output)
+{
+    const CBUFFER *pCB = (const CBUFFER *)context.pConstants[0];
+    float iCoordinates[4];
+    transformVertex(pCB, input, output, iCoordinates);
+
+    if (lightingEnabled<BRANCH>(pCB))
+    {
+        float transformedNormals[3], lightDirection[3], viewerVector[3];
+        transform3(transformedNormals, input.attributes[1], pCB->WorldMatrix);
+        for (int i = 0; i < 3; i++)
+        {
+            lightDirection[i] = pCB->LightPosition[i] - iCoordinates[i];
+            viewerVector[i] = -iCoordinates[i];
+        }
+        phongADS(pCB, transformedNormals, lightDirection, viewerVector, output.varyings);
+    }
+    else
+    {
+        output.varyings[0] = output.varyings[1] = output.varyings[2] = 1.0f;
+    }
+}
+
+// 12-PerVertexLighting/pixelShader.hlsl
+static void perVertexPixelShader(const SRShaderContext &, const float *varyings, float color[4])
+{
+    color[0] = varyings[0];
+    color[1] = varyings[1];
+    color[2] = varyings[2];
+    color[3] = 1.0f;
+}
+
+int main(int argc, char *argv[])
+{
+    int width = WIN_WIDTH;
+    int height = WIN_HEIGHT;
+    int frames = 200;
+    unsigned int threads = 0;
+    const char *lighting = "fragment";
+    const char *branch = "static";
+    const char *outputFile = NULL;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "--width") == 0)
+            width = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--height") == 0)
+            height = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--frames") == 0)
+            frames = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--threads") == 0)
+            threads = (unsigned int)atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--lighting") == 0)
+            lighting = argv[i + 1];
+        else if (strcmp(argv[i], "--branch") == 0)
+            branch = argv[i + 1];
+        else if (strcmp(argv[i], "--output") == 0)
+            outputFile = argv[i + 1];
+        else
+        {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    SoftwareRasterizer rasterizer;
+    JobsInitialize(threads);
+    rasterizer.Initialize(width, height);
+
+    // geometry, same streams as setupBuffers()
+    SphereDesc sphereDesc;
+    GetDefaultSphereDesc(sphereDesc);
+    SphereMesh sphere;
+    GenerateSphere(sphereDesc, sphere);
+    OptimizeMesh(sphere, NULL); // Same order as the samples draw
+
+    // constant buffer, same values as Render() of 13-PerFragmentLighting
+    CBUFFER constantBuffer;
+    memset(&constantBuffer, 0, sizeof(CBUFFER));
+    matrixTranslation(constantBuffer.WorldMatrix, 0.0f, 0.0f, 3.0f);
+    matrixIdentity(constantBuffer.ViewMatrix);
+    matrixPerspectiveFovLH(constantBuffer.ProjectionMatrix, 45.0f * PI / 180.0f, (float)width / (float)height, 0.1f, 100.0f);
+
+    const float lightAmbient[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+    const float lightDiffuse[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    const float lightSpecular[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    const float lightPosition[4] = {100.0f, 100.0f, -100.0f, 1.0f};
+    const float materialAmbient[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+    const float materialDiffuse[4] = {0.5f, 0.2f, 0.7f, 1.0f};
+    const float materialSpecular[4] = {0.7f, 0.7f, 0.7f, 1.0f};
+    memcpy(constantBuffer.LightAmbient, lightAmbient, sizeof(lightAmbient));
+    memcpy(constantBuffer.LightDiffuse, lightDiffuse, sizeof(lightDiffuse));
+    memcpy(constantBuffer.LightSpecular, lightSpecular, sizeof(lightSpecular));
+    memcpy(constantBuffer.LightPosition, lightPosition, sizeof(lightPosition));
+    memcpy(constantBuffer.MaterialAmbient, materialAmbient, sizeof(materialAmbient));
+    memcpy(constantBuffer.MaterialDiffuse, materialDiffuse, sizeof(materialDiffuse));
+    memcpy(constantBuffer.MaterialSpecular, materialSpecular, sizeof(materialSpecular));
+    constantBuffer.MaterialShininess = 128.0f;
+    constantBuffer.KeyPressed = (strcmp(lighting, "off") == 0) ? 0 : 1;
+
+    SRDrawDesc drawDesc;
+    memset(&drawDesc, 0, sizeof(SRDrawDesc));
+    // dynamic branch, or the variant for the chosen lighting
+    bool bDynamic = strcmp(branch, "dynamic") == 0;
+    bool bLit = constantBuffer.KeyPressed == 1;
+    if (strcmp(lighting, "vertex") == 0)
+    {
+        if (bDynamic)
+            drawDesc.vertexShader = perVertexVertexShader<BRANCH_DYNAMIC>;
+        else
+            drawDesc.vertexShader = bLit ? perVertexVertexShader<BRANCH_LIT> : perVertexVertexShader<BRANCH_UNLIT>;
+        drawDesc.pixelShader = perVertexPixelShader;
+        drawDesc.numVaryings = 3;
+    }
+    else if (bDynamic)
+    {
+        drawDesc.vertexShader = perFragmentVertexShader<BRANCH_DYNAMIC>;
+        drawDesc.pixelShader = perFragmentPixelShader<BRANCH_DYNAMIC>;
+        drawDesc.numVaryings = 9;
+    }
+    else
+    {
+        drawDesc.vertexShader = bLit ? perFragmentVertexShader<BRANCH_LIT> : perFragmentVertexShader<BRANCH_UNLIT>;
+        drawDesc.pixelShader = bLit ? perFragmentPixelShader<BRANCH_LIT> : perFragmentPixelShader<BRANCH_UNLIT>;
+        drawDesc.numVaryings = bLit ? 9 : 0;
+    }
+    drawDesc.context.pConstants[0] = &constantBuffer;
+    drawDesc.streams[0].pData = sphere.vertices[0].position;
+    drawDesc.streams[0].stride = sizeof(SphereVertex);
+    drawDesc.streams[1].pData = sphere.vertices[0].normal;
+    drawDesc.streams[1].stride = sizeof(SphereVertex);
+    drawDesc.numAttributes = 2;
+    drawDesc.vertexCount = (unsigned int)sphere.vertices.size();
+    drawDesc.pIndices16 = sphere.indices16.data();
+    drawDesc.indexCount = sphere.indexCount;
+    drawDesc.cullMode = SR_CULL_NONE;
+    drawDesc.bDepthTest = true;
+
+    const float clearColor[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+
+    // one untimed warmup frame
+    rasterizer.Clear(clearColor, 1.0f);
+    rasterizer.Draw(drawDesc);
+    rasterizer.ResetStatistics();
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        rasterizer.Clear(clearColor, 1.0f);
+        rasterizer.Draw(drawDesc);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const SRStatistics &stats = rasterizer.GetStatistics();
+    printf("Lighting            : %s\n", lighting);
+    printf("Branch              : %s\n", bDynamic ? "dynamic" : "static");
+    printf("Resolution          : %d x %d\n", width, height);
+    printf("Threads             : %u\n", JobsGetThreadCount());
+    printf("Frames              : %d\n", frames);
+    printf("Average frame time  : %.3f ms\n", frames > 0 ? seconds * 1000.0 / frames : 0.0);
+    printf("Triangles/sec       : %.0f\n", stats.trianglesSubmitted / seconds);
+    printf("Fragments/sec       : %.0f\n", stats.fragmentsShaded / seconds);
+    printf("Fragments per frame : %.0f\n", frames > 0 ? (double)stats.fragmentsShaded / frames : 0.0);
+
+    if (outputFile)
+    {
+        if (!ImageSaveBMP(outputFile, width, height, rasterizer.GetColorBuffer(), (size_t)width))
+        {
+            fprintf(stderr, "Failed to write %s\n", outputFile);
+            return 1;
+        }
+    }
+
+    rasterizer.Cleanup();
+    JobsCleanup();
+    return 0;
+}
@@ -0,0 +1,604 @@
+// Image decode throughput benchmark
+// Times ImageDecoder, the loader behind CreateTextureFromFile on both
+// backends, decoding into one preallocated RGBA buffer the way it decodes
+// into a mapped staging texture, and reports MB/s of RGBA written (best of
+// --repeat runs, so the file is in the page cache). Without file arguments it
+// writes a --size square test image as every format it reads and checks each
+// decodes back to the same pixels:
+//   bmp24, bmp32        the 07/08 texture formats
+//   bmp24 per pixel     the loader before ImageDecoder: one fread, then a
+//                       scalar per pixel swizzle into an intermediate image
+//   tga24, tga32 rle
+//   png stored          zlib stored blocks, the cost without Huffman decoding
+//   png fixed           fixed Huffman codes with short matches, closer to real
+//                       files; pass encoder output as arguments for those
+// On Windows every file is decoded through WIC as well, to 32bppRGBA with a
+// format converter like CreateWICTextureFromFile; WIC has no TGA codec.
+//
+// Usage: ImageDecode [--size 4096] [--repeat 5] [file ...]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "Image.h"
+#include "ImageDecoder.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <wincodec.h>
+#pragma comment(lib, "windowscodecs.lib")
+#pragma comment(lib, "ole32.lib")
+#endif
+
+// Sink for the written test files
+struct ByteWriter
+{
+    std::vector<unsigned char> bytes;
+
+    void Byte(unsigned int value) { bytes.push_back((unsigned char)value); }
+    void LE16(unsigned int value) { Byte(value); Byte(value >> 8); }
+    void LE32(unsigned int value) { LE16(value); LE16(value >> 16); }
+    void BE32(unsigned int value) { Byte(value >> 24); Byte(value >> 16); Byte(value >> 8); Byte(value); }
+    void Bytes(const void *pData, size_t size) { bytes.insert(bytes.end(), (const unsigned char *)pData, (const unsigned char *)pData + size); }
+
+    bool Save(const char *filePath) const
+    {
+        FILE *pFile = fopen(filePath, "wb");
+        if (pFile == NULL)
+            return false;
+        bool bWritten = fwrite(bytes.data(), 1, bytes.size(), pFile) == bytes.size();
+        fclose(pFile);
+        return bWritten;
+    }
+};
+
+// LSB first bit writer for the deflate stream
+struct BitWriter
+{
+    ByteWriter &writer;
+    unsigned int buffer;
+    unsigned int count;
+
+    BitWriter(ByteWriter &writer) : writer(writer), buffer(0), count(0) {}
+
+    void Bits(unsigned int value, unsigned int bitCount)
+    {
+        buffer |= value << count;
+        count += bitCount;
+        while (count >= 8)
+        {
+            writer.Byte(buffer & 0xFF);
+            buffer >>= 8;
+            count -= 8;
+        }
+    }
+
+    // Huffman codes go MSB first
+    void Code(unsigned int code, unsigned int length)
+    {
+        unsigned int reversed = 0;
+        for (unsigned int bit = 0; bit < length; bit++)
+            reversed |= ((code >> bit) & 1) << (length - 1 - bit);
+        Bits(reversed, length);
+    }
+
+    void Flush()
+    {
+        if (count > 0)
+            writer.Byte(buffer & 0xFF);
+        buffer = 0;
+        count = 0;
+    }
+};
+
+// Test image: flat 8x8 blocks over a gradient with a little noise, so RLE
+// and matches find something without the image being trivial
+static void makeImage(Image &image, int size)
+{
+    image.width = size;
+    image.height = size;
+    image.pixels.resize((size_t)size * size);
+    unsigned int seed = 1;
+    for (int y = 0; y < size; y++)
+    {
+        for (int x = 0; x < size; x++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            unsigned int r, g, b;
+            if (((x >> 3) + (y >> 3)) % 3 == 0)
+            {
+                r = (x >> 3) * 37 & 0xFF;
+                g = (y >> 3) * 53 & 0xFF;
+                b = 128;
+            }
+            else
+            {
+                r = (x * 255 / size + (seed >> 29)) & 0xFF;
+                g = (y * 255 / size) & 0xFF;
+                b = ((x + y) >> 4) & 0xFF;
+            }
+            image.pixels[(size_t)y * size + x] = r | (g << 8) | (b << 16) | ((x * 7 & 0xFF) << 24);
+        }
+    }
+}
+
+static bool saveBMP24(const char *filePath, const Image &image)
+{
+    size_t rowSize = ((size_t)image.width * 3 + 3) & ~(size_t)3;
+    ByteWriter writer;
+    writer.Byte('B');
+    writer.Byte('M');
+    writer.LE32((unsigned int)(54 + rowSize * image.height));
+    writer.LE32(0);
+    writer.LE32(54);
+    writer.LE32(40);
+    writer.LE32((unsigned int)image.width);
+    writer.LE32((unsigned int)image.height);
+    writer.LE16(1);
+    writer.LE16(24);
+    writer.LE32(0);
+    writer.LE32((unsigned int)(rowSize * image.height));
+    writer.LE32(0);
+    writer.LE32(0);
+    writer.LE32(0);
+    writer.LE32(0);
+    for (int y = image.height - 1; y >= 0; y--)
+    {
+        const unsigned int *pRow = &image.pixels[(size_t)y * image.width];
+        for (int x = 0; x < image.width; x++)
+        {
+            writer.Byte(pRow[x] >> 16);
+            writer.Byte(pRow[x] >> 8);
+            writer.Byte(pRow[x]);
+        }
+        for (size_t pad = (size_t)image.width * 3; pad < rowSize; pad++)
+            writer.Byte(0);
+    }
+    return writer.Save(filePath);
+}
+
+// Top-left origin; RLE packets run across rows like most encoders write them
+static bool saveTGA(const char *filePath, const Image &image, int bitCount, bool bRLE)
+{
+    ByteWriter writer;
+    writer.Byte(0);
+    writer.Byte(0);
+    writer.Byte(bRLE ? 10 : 2);
+    for (int i = 0; i < 9; i++)
+        writer.Byte(0);
+    writer.LE16((unsigned int)image.width);
+    writer.LE16((unsigned int)image.height);
+    writer.Byte((unsigned int)bitCount);
+    writer.Byte(0x20 | (bitCount == 32 ? 8 : 0));
+
+    const std::vector<unsigned int> &pixels = image.pixels;
+    size_t bytesPerPixel = (size_t)bitCount / 8;
+    for (size_t i = 0; i < pixels.size();)
+    {
+        size_t run = 1;
+        if (bRLE)
+        {
+            while (run < 128 && i + run < pixels.size() && pixels[i + run] == pixels[i])
+                run++;
+        }
+        if (bRLE && run > 1)
+        {
+            writer.Byte(0x80 | (unsigned int)(run - 1));
+            writer.Byte(pixels[i] >> 16);
+            writer.Byte(pixels[i] >> 8);
+            writer.Byte(pixels[i]);
+            if (bytesPerPixel == 4)
+                writer.Byte(pixels[i] >> 24);
+            i += run;
+            continue;
+        }
+
+        // Raw packet up to the next run, the whole image without RLE
+        size_t count = 1;
+        while (i + count < pixels.size() && (!bRLE || (count < 128 && pixels[i + count] != pixels[i + count - 1])))
+            count++;
+        if (bRLE)
+            writer.Byte((unsigned int)(count - 1));
+        for (size_t j = i; j < i + count; j++)
+        {
+            writer.Byte(pixels[j] >> 16);
+            writer.Byte(pixels[j] >> 8);
+            writer.Byte(pixels[j]);
+            if (bytesPerPixel == 4)
+                writer.Byte(pixels[j] >> 24);
+        }
+        i += count;
+    }
+    return writer.Save(filePath);
+}
+
+static unsigned int crc32(const unsigned char *pData, size_t size)
+{
+    static unsigned int table[256];
+    if (table[1] == 0)
+    {
+        for (unsigned int i = 0; i < 256; i++)
+        {
+            unsigned int c = i;
+            for (int k = 0; k < 8; k++)
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+    }
+    unsigned int crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; i++)
+        crc = table[(crc ^ pData[i]) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+static void pngChunk(ByteWriter &writer, const char *type, const std::vector<unsigned char> &data)
+{
+    writer.BE32((unsigned int)data.size());
+    size_t start = writer.bytes.size();
+    writer.Bytes(type, 4);
+    writer.Bytes(data.data(), data.size());
+    writer.BE32(crc32(&writer.bytes[start], writer.bytes.size() - start));
+}
+
+// Fixed Huffman codes, RFC 1951 3.2.6
+static void fixedLiteral(BitWriter &bits, unsigned int symbol)
+{
+    if (symbol < 144)
+        bits.Code(0x30 + symbol, 8);
+    else if (symbol < 256)
+        bits.Code(0x190 + symbol - 144, 9);
+    else if (symbol < 280)
+        bits.Code(symbol - 256, 7);
+    else
+        bits.Code(0xC0 + symbol - 280, 8);
+}
+
+// Matches 3..10 long (length codes 257..264, no extra bits) at distance 1..4
+// (codes 0..3); enough to find the repeats in filtered rows
+static void deflateFixed(ByteWriter &writer, const std::vector<unsigned char> &data)
+{
+    BitWriter bits(writer);
+    bits.Bits(1, 1); // Final block
+    bits.Bits(1, 2); // Fixed codes
+    for (size_t i = 0; i < data.size();)
+    {
+        unsigned int bestLength = 0;
+        unsigned int bestDistance = 0;
+        for (unsigned int distance = 1; distance <= 4 && distance <= i; distance++)
+        {
+            unsigned int length = 0;
+            while (length < 10 && i + length < data.size() && data[i + length] == data[i + length - distance])
+                length++;
+            if (length > bestLength)
+            {
+                bestLength = length;
+                bestDistance = distance;
+            }
+        }
+        if (bestLength >= 3)
+        {
+            fixedLiteral(bits, 257 + bestLength - 3);
+            bits.Code(bestDistance - 1, 5);
+            i += bestLength;
+        }
+        else
+            fixedLiteral(bits, data[i++]);
+    }
+    fixedLiteral(bits, 256);
+    bits.Flush();
+}
+
+// RGB, every row with the Sub filter
+static bool savePNG(const char *filePath, const Image &image, bool bCompressed)
+{
+    size_t rowBytes = (size_t)image.width * 3;
+    std::vector<unsigned char> filtered;
+    filtered.reserve((rowBytes + 1) * image.height);
+    for (int y = 0; y < image.height; y++)
+    {
+        const unsigned int *pRow = &image.pixels[(size_t)y * image.width];
+        filtered.push_back(1);
+        for (size_t i = 0; i < rowBytes; i++)
+        {
+            unsigned char value = (unsigned char)(pRow[i / 3] >> (i % 3 * 8));
+            unsigned char left = i >= 3 ? (unsigned char)(pRow[i / 3 - 1] >> (i % 3 * 8)) : 0;
+            filtered.push_back((unsigned char)(value - left));
+        }
+    }
+
+    ByteWriter zlib;
+    zlib.Byte(0x78);
+    zlib.Byte(0x01);
+    if (bCompressed)
+        deflateFixed(zlib, filtered);
+    else
+    {
+        for (size_t i = 0; i < filtered.size(); i += 65535)
+        {
+            size_t count = filtered.size() - i < 65535 ? filtered.size() - i : 65535;
+            zlib.Byte(i + count == filtered.size() ? 1 : 0);
+            zlib.LE16((unsigned int)count);
+            zlib.LE16((unsigned int)count ^ 0xFFFF);
+            zlib.Bytes(&filtered[i], count);
+        }
+    }
+    zlib.BE32(0); // Adler-32, not checked by the decoder
+
+    ByteWriter header;
+    header.BE32((unsigned int)image.width);
+    header.BE32((unsigned int)image.height);
+    header.Byte(8); // Bit depth
+    header.Byte(2); // RGB
+    header.Byte(0);
+    header.Byte(0);
+    header.Byte(0);
+
+    static const unsigned char signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    ByteWriter writer;
+    writer.Bytes(signature, sizeof(signature));
+    pngChunk(writer, "IHDR", header.bytes);
+    for (size_t i = 0; i < zlib.bytes.size(); i += 1 << 20)
+    {
+        size_t count = zlib.bytes.size() - i < (1 << 20) ? zlib.bytes.size() - i : (1 << 20);
+        pngChunk(writer, "IDAT", std::vector<unsigned char>(zlib.bytes.begin() + i, zlib.bytes.begin() + i + count));
+    }
+    pngChunk(writer, "IEND", std::vector<unsigned char>());
+    return writer.Save(filePath);
+}
+
+// Common/Image.cpp's ImageLoadBMP() before ImageDecoder, for the baseline
+static bool loadBMPPerPixel(const char *filePath, Image &image)
+{
+    FILE *pFile = fopen(filePath, "rb");
+    if (pFile == NULL)
+        return false;
+
+    unsigned char header[54];
+    if (fread(header, 1, sizeof(header), pFile) != sizeof(header) || header[0] != 'B' || header[1] != 'M')
+    {
+        fclose(pFile);
+        return false;
+    }
+    unsigned int dataOffset = header[10] | (header[11] << 8) | (header[12] << 16) | ((unsigned int)header[13] << 24);
+    int width = (int)(header[18] | (header[19] << 8) | (header[20] << 16) | ((unsigned int)header[21] << 24));
+    int height = (int)(header[22] | (header[23] << 8) | (header[24] << 16) | ((unsigned int)header[25] << 24));
+    int bytesPerPixel = (header[28] | (header[29] << 8)) / 8;
+    bool bTopDown = height < 0;
+    if (bTopDown)
+        height = -height;
+
+    int rowSize = (width * bytesPerPixel + 3) & ~3;
+    std::vector<unsigned char> row(rowSize);
+    image.width = width;
+    image.height = height;
+    image.pixels.resize((size_t)width * height);
+    fseek(pFile, dataOffset, SEEK_SET);
+    for (int y = 0; y < height; y++)
+    {
+        if (fread(row.data(), 1, rowSize, pFile) != (size_t)rowSize)
+        {
+            fclose(pFile);
+            return false;
+        }
+        unsigned int *pDst = &image.pixels[(size_t)(bTopDown ? y : height - 1 - y) * width];
+        for (int x = 0; x < width; x++)
+        {
+            const unsigned char *pSrc = &row[x * bytesPerPixel];
+            unsigned int a = (bytesPerPixel == 4) ? pSrc[3] : 255;
+            pDst[x] = pSrc[2] | (pSrc[1] << 8) | (pSrc[0] << 16) | (a << 24);
+        }
+    }
+    fclose(pFile);
+    return true;
+}
+
+#ifdef _WIN32
+static bool decodeWIC(IWICImagingFactory *pFactory, const char *filePath, unsigned int *pPixels, int width, int height)
+{
+    wchar_t wideFilePath[MAX_PATH];
+    MultiByteToWideChar(CP_ACP, 0, filePath, -1, wideFilePath, MAX_PATH);
+
+    IWICBitmapDecoder *pDecoder = NULL;
+    IWICBitmapFrameDecode *pFrame = NULL;
+    IWICFormatConverter *pConverter = NULL;
+    HRESULT hr = pFactory->CreateDecoderFromFilename(wideFilePath, NULL, GENERIC_READ, WICDecodeMetadataCacheOnDemand, &pDecoder);
+    if (SUCCEEDED(hr))
+        hr = pDecoder->GetFrame(0, &pFrame);
+    if (SUCCEEDED(hr))
+        hr = pFactory->CreateFormatConverter(&pConverter);
+    if (SUCCEEDED(hr))
+        hr = pConverter->Initialize(pFrame, GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone, NULL, 0.0, WICBitmapPaletteTypeCustom);
+    if (SUCCEEDED(hr))
+        hr = pConverter->CopyPixels(NULL, (UINT)width * 4, (UINT)width * height * 4, (BYTE *)pPixels);
+
+    if (pConverter)
+        pConverter->Release();
+    if (pFrame)
+        pFrame->Release();
+    if (pDecoder)
+        pDecoder->Release();
+    return SUCCEEDED(hr);
+}
+#endif
+
+struct Run
+{
+    const char *name;
+    const char *filePath;
+    const Image *pExpected; // NULL for files from the command line
+};
+
+static double seconds(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static long fileSize(const char *filePath)
+{
+    FILE *pFile = fopen(filePath, "rb");
+    if (pFile == NULL)
+        return 0;
+    fseek(pFile, 0, SEEK_END);
+    long size = ftell(pFile);
+    fclose(pFile);
+    return size;
+}
+
+int main(int argc, char *argv[])
+{
+    int size = 4096;
+    int repeat = 5;
+    std::vector<Run> runs;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+            size = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+            repeat = atoi(argv[++i]);
+        else if (argv[i][0] == '-')
+        {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+        else
+        {
+            Run run = {argv[i], argv[i], NULL};
+            runs.push_back(run);
+        }
+    }
+    if (size < 1)
+        size = 1;
+    if (repeat < 1)
+        repeat = 1;
+
+    // Test files; the expected pixels of the formats without alpha are opaque
+    Image image, opaque;
+    bool bSynthetic = runs.empty();
+    if (bSynthetic)
+    {
+        makeImage(image, size);
+        opaque = image;
+        for (size_t i = 0; i < opaque.pixels.size(); i++)
+            opaque.pixels[i] |= 0xFF000000;
+
+        bool bSaved = saveBMP24("ImageDecode_24.bmp", image) && ImageSaveBMP("ImageDecode_32.bmp", image) &&
+                      saveTGA("ImageDecode_24.tga", image, 24, false) && saveTGA("ImageDecode_32_rle.tga", image, 32, true) &&
+                      savePNG("ImageDecode_stored.png", image, false) && savePNG("ImageDecode_fixed.png", image, true);
+        if (!bSaved)
+        {
+            fprintf(stderr, "Cannot write the test files\n");
+            return 1;
+        }
+        Run synthetic[] = {
+            {"bmp24", "ImageDecode_24.bmp", &opaque},
+            {"bmp24 per pixel", "ImageDecode_24.bmp", &opaque},
+            {"bmp32", "ImageDecode_32.bmp", &image},
+            {"tga24", "ImageDecode_24.tga", &opaque},
+            {"tga32 rle", "ImageDecode_32_rle.tga", &image},
+            {"png stored", "ImageDecode_stored.png", &opaque},
+            {"png fixed", "ImageDecode_fixed.png", &opaque},
+        };
+        runs.assign(synthetic, synthetic + sizeof(synthetic) / sizeof(synthetic[0]));
+    }
+
+#ifdef _WIN32
+    CoInitializeEx(NULL, COINIT_MULTITHREADED);
+    IWICImagingFactory *pFactory = NULL;
+    CoCreateInstance(CLSID_WICImagingFactory, NULL, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&pFactory));
+    printf("%-16s %10s %10s %12s %12s\n", "", "size", "file MB", "decoder MB/s", "WIC MB/s");
+#else
+    printf("%-16s %10s %10s %12s\n", "", "size", "file MB", "decoder MB/s");
+#endif
+
+    int failures = 0;
+    std::vector<unsigned int> upload; // Stands in for the mapped staging texture
+    for (size_t r = 0; r < runs.size(); r++)
+    {
+        const Run &run = runs[r];
+        bool bPerPixel = strcmp(run.name, "bmp24 per pixel") == 0;
+
+        ImageDecoder decoder;
+        if (!decoder.Open(run.filePath))
+        {
+            printf("%-16s cannot decode %s\n", run.name, run.filePath);
+            failures++;
+            continue;
+        }
+        int width = decoder.GetWidth();
+        int height = decoder.GetHeight();
+        upload.assign((size_t)width * height, 0);
+
+        double best = 1e30;
+        bool bDecoded = true;
+        for (int i = 0; i < repeat && bDecoded; i++)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            if (bPerPixel)
+            {
+                // Plus the copy into upload memory the old path needed
+                Image loaded;
+                bDecoded = loadBMPPerPixel(run.filePath, loaded);
+                if (bDecoded)
+                    memcpy(upload.data(), loaded.pixels.data(), upload.size() * 4);
+            }
+            else
+                bDecoded = (i == 0 || decoder.Open(run.filePath)) && decoder.Decode(upload.data(), (size_t)width);
+            double elapsed = seconds(start);
+            if (elapsed < best)
+                best = elapsed;
+        }
+
+        const char *result = "";
+        if (!bDecoded)
+            result = "  decode FAILED";
+        else if (run.pExpected && memcmp(upload.data(), run.pExpected->pixels.data(), upload.size() * 4) != 0)
+            result = "  pixels DIFFER";
+        if (result[0])
+            failures++;
+
+        double megabytes = (double)upload.size() * 4 / (1024.0 * 1024.0);
+        char dimensions[32];
+        snprintf(dimensions, sizeof(dimensions), "%dx%d", width, height);
+        printf("%-16s %10s %10.1f %12.0f", run.name, dimensions, fileSize(run.filePath) / (1024.0 * 1024.0), megabytes / best);
+
+#ifdef _WIN32
+        double bestWIC = 1e30;
+        bool bWIC = pFactory != NULL && !bPerPixel;
+        for (int i = 0; i < repeat && bWIC; i++)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            bWIC = decodeWIC(pFactory, run.filePath, upload.data(), width, height);
+            double elapsed = seconds(start);
+            if (elapsed < bestWIC)
+                bestWIC = elapsed;
+        }
+        if (bWIC)
+            printf(" %12.0f", megabytes / bestWIC);
+        else
+            printf(" %12s", "n/a");
+#endif
+        printf("%s\n", result);
+    }
+    printf("MB/s of RGBA written, best of %d\n", repeat);
+
+#ifdef _WIN32
+    if (pFactory)
+        pFactory->Release();
+    CoUninitialize();
+#endif
+
+    if (bSynthetic)
+    {
+        remove("ImageDecode_24.bmp");
+        remove("ImageDecode_32.bmp");
+        remove("ImageDecode_24.tga");
+        remove("ImageDecode_32_rle.tga");
+        remove("ImageDecode_stored.png");
+        remove("ImageDecode_fixed.png");
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,167 @@
+// Job system scaling benchmark
+// Runs three workloads on JobSystem.h with 1, 2, 4 ... up to --threads
+// threads (all cores by default), best of --repeat runs each:
+//   parallel for   JobParallelFor over --items independent items of about 100
+//                  flops each in ranges of --grain; ms, speedup over one thread
+//                  and parallel efficiency (speedup / threads)
+//   job tree       a binary tree of --depth levels where every job spawns two
+//                  children, all empty; millions of jobs per second, which is
+//                  what scheduling itself costs
+//   continuations  a chain of 1000 jobs, each queued as the continuation of
+//                  the previous one; microseconds per hop
+// The parallel for result is compared with the one thread run and the tree's
+// job count with 2^(depth + 1) - 1, so lost or repeated work shows up as errors.
+//
+// Usage: JobScaling [--threads 0] [--items 4194304] [--grain 4096] [--depth 17] [--repeat 10]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "JobSystem.h"
+
+#define CHAIN_LENGTH 1000 // Below JOB_POOL_SIZE, every link exists before the first runs
+
+static std::atomic<unsigned long long> gTreeJobs(0);
+
+// Enough dependent multiply-adds to keep a core busy and the compiler honest
+static float work(unsigned int i)
+{
+    float x = (float)(i & 1023) * (1.0f / 1024.0f);
+    float y = 0.0f;
+    for (int k = 0; k < 50; k++)
+        y = y * x + 0.5f;
+    return y;
+}
+
+static void treeJob(Job *pJob, const void *pData)
+{
+    unsigned int depth;
+    memcpy(&depth, pData, sizeof(depth));
+    gTreeJobs.fetch_add(1, std::memory_order_relaxed);
+    if (depth == 0)
+        return;
+    depth--;
+    JobRun(JobCreateChild(pJob, treeJob, &depth, sizeof(depth)));
+    JobRun(JobCreateChild(pJob, treeJob, &depth, sizeof(depth)));
+}
+
+static void chainJob(Job *pJob, const void *pData)
+{
+    (void)pJob;
+    (void)pData;
+}
+
+template <typename Function>
+static double bestSeconds(int repeat, Function function)
+{
+    double best = 0.0;
+    for (int i = 0; i < repeat; i++)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        function();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (i == 0 || seconds < best)
+            best = seconds;
+    }
+    return best;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int maxThreads = 0;
+    unsigned int items = 4194304;
+    unsigned int grain = 4096;
+    unsigned int depth = 17;
+    int repeat = 10;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            maxThreads = (unsigned int)atoi(argv[++i]);
+        else if (strcmp(argv[i], "--items") == 0 && i + 1 < argc)
+            items = (unsigned int)atol(argv[++i]);
+        else if (strcmp(argv[i], "--grain") == 0 && i + 1 < argc)
+            grain = (unsigned int)atoi(argv[++i]);
+        else if (strcmp(argv[i], "--depth") == 0 && i + 1 < argc)
+            depth = (unsigned int)atoi(argv[++i]);
+        else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+            repeat = atoi(argv[++i]);
+        else
+        {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (items == 0 || grain == 0 || repeat < 1 || depth > 24)
+    {
+        fprintf(stderr, "--items, --grain and --repeat must be positive, --depth at most 24\n");
+        return 1;
+    }
+    if (maxThreads == 0)
+        maxThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+
+    std::vector<unsigned int> threadCounts;
+    for (unsigned int threads = 1; threads < maxThreads * 2; threads *= 2)
+        threadCounts.push_back(threads < maxThreads ? threads : maxThreads);
+
+    std::vector<float> results(items);
+    std::vector<float> reference;
+    unsigned long long treeJobs = (2ULL << depth) - 1;
+    double oneThreadSeconds = 0.0;
+
+    printf("%8s %12s %9s %11s %12s %12s %8s\n", "threads", "for ms", "speedup", "efficiency", "tree Mjob/s", "chain us/hop", "errors");
+    for (size_t t = 0; t < threadCounts.size(); t++)
+    {
+        JobsInitialize(threadCounts[t]);
+        unsigned int errors = 0;
+
+        double forSeconds = bestSeconds(repeat, [&]()
+                                        { JobParallelFor(items, grain, [&](unsigned int begin, unsigned int end)
+                                                         {
+                                                             for (unsigned int i = begin; i < end; i++)
+                                                                 results[i] = work(i);
+                                                         }); });
+        if (t == 0)
+        {
+            oneThreadSeconds = forSeconds;
+            reference = results;
+        }
+        else if (memcmp(results.data(), reference.data(), items * sizeof(float)) != 0)
+            errors++;
+
+        double treeSeconds = bestSeconds(repeat, [&]()
+                                         {
+                                             gTreeJobs = 0;
+                                             Job *pRoot = JobCreate(treeJob, &depth, sizeof(depth));
+                                             JobRun(pRoot);
+                                             JobWait(pRoot);
+                                             if (gTreeJobs != treeJobs)
+                                                 errors++; });
+
+        double chainSeconds = bestSeconds(repeat, [&]()
+                                          {
+                                              Job *pFirst = JobCreate(chainJob, NULL, 0);
+                                              Job *pLast = pFirst;
+                                              for (int i = 1; i < CHAIN_LENGTH; i++)
+                                              {
+                                                  Job *pNext = JobCreate(chainJob, NULL, 0);
+                                                  JobAddContinuation(pLast, pNext);
+                                                  pLast = pNext;
+                                              }
+                                              JobRun(pFirst);
+                                              JobWait(pLast); });
+
+        double speedup = oneThreadSeconds / forSeconds;
+        printf("%8u %12.3f %8.2fx %10.0f%% %12.2f %12.3f %8u\n", JobsGetThreadCount(), forSeconds * 1000.0, speedup,
+               100.0 * speedup / JobsGetThreadCount(), treeJobs / treeSeconds / 1.0e6, chainSeconds / CHAIN_LENGTH * 1.0e6, errors);
+        JobsCleanup();
+    }
+    printf("%u items in ranges of %u, tree of %llu jobs, best of %d\n", items, grain, treeJobs, repeat);
+
+    return 0;
+}
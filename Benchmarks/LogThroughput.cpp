@@ -0,0 +1,141 @@
+// Log throughput micro-benchmark
+// Compares the original per-message fopen/fprintf/fclose pattern with the ring
+// buffer logger in Common/Log.cpp and reports messages/sec for each. "burst"
+// is the rate the calling threads see when they log faster than the writer
+// thread drains, messages past the ring size are dropped and counted.
+// "sustained" waits for the writer every LOG_RING_SIZE / 8 messages per
+// thread, so with up to 8 threads every message reaches the file and the time
+// includes the disk writes.
+//
+// Usage: LogThroughput [--messages 100000] [--threads 1]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "Log.h"
+
+static const char *gszSyncLogFileName = "LogThroughput_sync.txt";
+static const char *gszAsyncLogFileName = "LogThroughput_async.txt";
+
+// The pattern every D3D11App::Initialize()/Resize() used before Common/Log
+static void syncLog(const char *format, ...)
+{
+    FILE *pFile = fopen(gszSyncLogFileName, "a+");
+    if (pFile == NULL)
+        return;
+
+    va_list args;
+    va_start(args, format);
+    vfprintf(pFile, format, args);
+    va_end(args);
+
+    fclose(pFile);
+}
+
+static void syncProducer(int first, int count)
+{
+    for (int i = first; i < first + count; i++)
+        syncLog("CreateBuffer Successful for frame %d, width %d, height %d\n", i, 800, 600);
+}
+
+static void asyncProducer(int first, int count)
+{
+    for (int i = first; i < first + count; i++)
+        Log("CreateBuffer Successful for frame %d, width %d, height %d\n", i, 800, 600);
+}
+
+static void sustainedProducer(int first, int count)
+{
+    for (int i = first; i < first + count; i++)
+    {
+        Log("CreateBuffer Successful for frame %d, width %d, height %d\n", i, 800, 600);
+        if ((i - first) % (LOG_RING_SIZE / 8) == LOG_RING_SIZE / 8 - 1)
+            LogFlush();
+    }
+}
+
+static void debugProducer(int first, int count)
+{
+    // Below LOG_MIN_LEVEL, so the call and its arguments compile away
+    for (int i = first; i < first + count; i++)
+        LogDebug("CreateBuffer Successful for frame %d, width %d, height %d\n", i, 800, 600);
+}
+
+// Run producer on threads threads, messages split evenly, returns seconds
+static double runProducers(void (*producer)(int, int), int messages, int threads)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    int perThread = messages / threads;
+    for (int t = 0; t < threads; t++)
+        workers.push_back(std::thread(producer, t * perThread, perThread));
+    for (size_t t = 0; t < workers.size(); t++)
+        workers[t].join();
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char *name, int messages, double seconds)
+{
+    printf("%-24s %10d messages %10.3f ms %14.0f messages/sec\n", name, messages, seconds * 1000.0, messages / seconds);
+}
+
+int main(int argc, char *argv[])
+{
+    int messages = 100000;
+    int threads = 1;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "--messages") == 0)
+            messages = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--threads") == 0)
+            threads = atoi(argv[i + 1]);
+        else
+        {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (threads < 1)
+        threads = 1;
+    messages = messages / threads * threads;
+
+    // fopen/fclose per message
+    remove(gszSyncLogFileName);
+    double syncSeconds = runProducers(syncProducer, messages, threads);
+    report("fopen/fclose per message", messages, syncSeconds);
+
+    // ring buffer, as seen by the callers
+    LogInitialize(gszAsyncLogFileName);
+    double burstSeconds = runProducers(asyncProducer, messages, threads);
+    LogFlush();
+    unsigned long long dropped = LogDroppedCount();
+    LogCleanup();
+    report("ring buffer, burst", messages, burstSeconds);
+    if (dropped)
+        printf("%24s %10llu dropped with a %d slot ring\n", "", dropped, LOG_RING_SIZE);
+
+    // ring buffer, every message written to the file
+    LogInitialize(gszAsyncLogFileName);
+    double sustainedSeconds = runProducers(sustainedProducer, messages, threads);
+    LogFlush();
+    LogCleanup();
+    report("ring buffer, sustained", messages, sustainedSeconds);
+
+    // compiled out level
+    double debugSeconds = runProducers(debugProducer, messages, threads);
+    report("LogDebug, compiled out", messages, debugSeconds);
+
+    printf("sustained speedup %.1fx\n", syncSeconds / sustainedSeconds);
+
+    remove(gszSyncLogFileName);
+    remove(gszAsyncLogFileName);
+    return 0;
+}
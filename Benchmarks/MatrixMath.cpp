@@ -0,0 +1,347 @@
+// Matrix math benchmark
+// Times the XMath.h calls the samples make in Render() and Resize(), over
+// arrays of --count inputs so loads and stores are part of the cost, and
+// reports ns per call (best of --repeat runs). Each result is checked against
+// the same math in double precision first. XMath.h picks its implementation
+// at compile time, so build this once per path and compare the tables; the
+// first line says which one was compiled in:
+//   g++ ... -D_XM_NO_INTRINSICS_    scalar
+//   g++ ...                         SSE2
+//   g++ ... -msse4.1                SSE4.1
+//   g++ ... -mavx2 -mfma            AVX2
+//
+// Usage: MatrixMath [--count 4096] [--repeat 200]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "XMath.h"
+
+#if defined(_XM_AVX2_INTRINSICS_)
+#define XMATH_PATH "AVX2"
+#elif defined(_XM_SSE4_INTRINSICS_)
+#define XMATH_PATH "SSE4.1"
+#elif defined(_XM_SSE_INTRINSICS_)
+#define XMATH_PATH "SSE2"
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+#define XMATH_PATH "NEON"
+#else
+#define XMATH_PATH "scalar (_XM_NO_INTRINSICS_)"
+#endif
+
+// Inputs and outputs of every kernel, vectors in their unaligned storage type
+struct Data
+{
+    std::vector<XMMATRIX> a;
+    std::vector<XMMATRIX> b;
+    std::vector<XMMATRIX> result;
+    std::vector<XMFLOAT4> vectors;
+    std::vector<XMFLOAT4> transformed;
+    std::vector<float> angles;
+};
+
+static float random01()
+{
+    return (float)rand() / (float)RAND_MAX;
+}
+
+static XMMATRIX randomMatrix()
+{
+    XMMATRIX M;
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 4; j++)
+            M.m[i][j] = random01() * 4.0f - 2.0f;
+    }
+    return M;
+}
+
+//
+// Kernels
+//
+
+static void multiply(Data &data, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        data.result[i] = XMMatrixMultiply(data.a[i], data.b[i]);
+}
+
+static void transpose(Data &data, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        data.result[i] = XMMatrixTranspose(data.a[i]);
+}
+
+static void transform(Data &data, size_t count)
+{
+    const XMMATRIX &M = data.a[0];
+    for (size_t i = 0; i < count; i++)
+        XMStoreFloat4(&data.transformed[i], XMVector4Transform(XMLoadFloat4(&data.vectors[i]), M));
+}
+
+static void normalize(Data &data, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        XMStoreFloat4(&data.transformed[i], XMVector3Normalize(XMLoadFloat4(&data.vectors[i])));
+}
+
+static void rotation(Data &data, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        data.result[i] = XMMatrixRotationY(data.angles[i]);
+}
+
+static void perspective(Data &data, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        data.result[i] = XMMatrixPerspectiveFovLH(0.785398f, 1.0f + data.angles[i], 0.1f, 100.0f);
+}
+
+// The world * view * projection chain 06-Cube-3DRotation builds per object
+static void worldViewProjection(Data &data, size_t count)
+{
+    XMMATRIX viewMatrix = XMMatrixIdentity();
+    XMMATRIX projectionMatrix = XMMatrixPerspectiveFovLH(XMConvertToRadians(45.0f), 800.0f / 600.0f, 0.1f, 100.0f);
+    for (size_t i = 0; i < count; i++)
+    {
+        float angle = data.angles[i];
+        XMMATRIX worldMatrix = XMMatrixRotationX(angle) * XMMatrixRotationY(angle) * XMMatrixRotationZ(angle) * XMMatrixTranslation(0.0f, 0.0f, 6.0f);
+        data.result[i] = worldMatrix * viewMatrix * projectionMatrix;
+    }
+}
+
+//
+// Checks against double precision
+//
+
+static double relativeError(double value, double expected)
+{
+    return fabs(value - expected) / (fabs(expected) > 1.0 ? fabs(expected) : 1.0);
+}
+
+static double checkMultiply(const Data &data, size_t count)
+{
+    double worst = 0.0;
+    for (size_t n = 0; n < count; n++)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                double expected = 0.0;
+                for (int k = 0; k < 4; k++)
+                    expected += (double)data.a[n].m[i][k] * data.b[n].m[k][j];
+                double error = relativeError(data.result[n].m[i][j], expected);
+                if (error > worst)
+                    worst = error;
+            }
+        }
+    }
+    return worst;
+}
+
+static double checkTranspose(const Data &data, size_t count)
+{
+    for (size_t n = 0; n < count; n++)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                if (data.result[n].m[i][j] != data.a[n].m[j][i])
+                    return 1.0;
+            }
+        }
+    }
+    return 0.0;
+}
+
+static double checkTransform(const Data &data, size_t count)
+{
+    double worst = 0.0;
+    const XMMATRIX &M = data.a[0];
+    for (size_t n = 0; n < count; n++)
+    {
+        const float *v = &data.vectors[n].x;
+        const float *t = &data.transformed[n].x;
+        for (int j = 0; j < 4; j++)
+        {
+            double expected = 0.0;
+            for (int k = 0; k < 4; k++)
+                expected += (double)v[k] * M.m[k][j];
+            double error = relativeError(t[j], expected);
+            if (error > worst)
+                worst = error;
+        }
+    }
+    return worst;
+}
+
+static double checkNormalize(const Data &data, size_t count)
+{
+    double worst = 0.0;
+    for (size_t n = 0; n < count; n++)
+    {
+        const float *v = &data.vectors[n].x;
+        const float *t = &data.transformed[n].x;
+        double length = sqrt((double)v[0] * v[0] + (double)v[1] * v[1] + (double)v[2] * v[2]);
+        for (int j = 0; j < 3; j++)
+        {
+            double error = relativeError(t[j], v[j] / length);
+            if (error > worst)
+                worst = error;
+        }
+    }
+    return worst;
+}
+
+static double checkRotation(const Data &data, size_t count)
+{
+    double worst = 0.0;
+    for (size_t n = 0; n < count; n++)
+    {
+        double s = sin((double)data.angles[n]);
+        double c = cos((double)data.angles[n]);
+        const float(*m)[4] = data.result[n].m;
+        double errors[4] = {relativeError(m[0][0], c), relativeError(m[0][2], -s),
+                            relativeError(m[2][0], s), relativeError(m[2][2], c)};
+        for (int j = 0; j < 4; j++)
+        {
+            if (errors[j] > worst)
+                worst = errors[j];
+        }
+        if (m[1][1] != 1.0f || m[3][3] != 1.0f)
+            return 1.0;
+    }
+    return worst;
+}
+
+static double checkPerspective(const Data &data, size_t count)
+{
+    double worst = 0.0;
+    for (size_t n = 0; n < count; n++)
+    {
+        double height = 1.0 / tan(0.785398 * 0.5);
+        double range = 100.0 / (100.0 - 0.1);
+        const float(*m)[4] = data.result[n].m;
+        double errors[4] = {relativeError(m[0][0], height / (1.0 + data.angles[n])), relativeError(m[1][1], height),
+                            relativeError(m[2][2], range), relativeError(m[3][2], -range * 0.1)};
+        for (int j = 0; j < 4; j++)
+        {
+            if (errors[j] > worst)
+                worst = errors[j];
+        }
+        if (m[2][3] != 1.0f || m[3][3] != 0.0f)
+            return 1.0;
+    }
+    return worst;
+}
+
+// Rotations are checked on their own, this is the product with a known translation
+static double checkWorldViewProjection(const Data &data, size_t count)
+{
+    double worst = 0.0;
+    XMMATRIX projectionMatrix = XMMatrixPerspectiveFovLH(XMConvertToRadians(45.0f), 800.0f / 600.0f, 0.1f, 100.0f);
+    for (size_t n = 0; n < count; n++)
+    {
+        // Row 3 is the translation (0, 0, 6, 1) through the projection
+        const float *row = data.result[n].m[3];
+        double expected[4] = {0.0, 0.0, 6.0 * projectionMatrix.m[2][2] + projectionMatrix.m[3][2], 6.0};
+        for (int j = 0; j < 4; j++)
+        {
+            double error = relativeError(row[j], expected[j]);
+            if (error > worst)
+                worst = error;
+        }
+    }
+    return worst;
+}
+
+struct Kernel
+{
+    const char *name;
+    void (*run)(Data &data, size_t count);
+    double (*check)(const Data &data, size_t count);
+};
+
+static const Kernel kernels[] = {
+    {"multiply", multiply, checkMultiply},
+    {"transpose", transpose, checkTranspose},
+    {"vector transform", transform, checkTransform},
+    {"vector normalize", normalize, checkNormalize},
+    {"rotation y", rotation, checkRotation},
+    {"perspective", perspective, checkPerspective},
+    {"world view proj", worldViewProjection, checkWorldViewProjection},
+};
+
+int main(int argc, char *argv[])
+{
+    size_t count = 4096;
+    int repeat = 200;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--count") == 0 && i + 1 < argc)
+            count = (size_t)atol(argv[++i]);
+        else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+            repeat = atoi(argv[++i]);
+        else
+        {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (count == 0 || repeat < 1)
+    {
+        fprintf(stderr, "--count and --repeat must be positive\n");
+        return 1;
+    }
+
+    Data data;
+    srand(1);
+    data.a.resize(count);
+    data.b.resize(count);
+    data.result.resize(count);
+    data.vectors.resize(count);
+    data.transformed.resize(count);
+    data.angles.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        data.a[i] = randomMatrix();
+        data.b[i] = randomMatrix();
+        XMFLOAT4 vector = {random01() * 2.0f - 1.0f, random01() * 2.0f - 1.0f, random01() * 2.0f + 0.5f, 1.0f};
+        data.vectors[i] = vector;
+        data.angles[i] = random01() * XM_2PI;
+    }
+
+    printf("XMath path: %s\n", XMATH_PATH);
+    printf("%-18s %10s %12s\n", "", "ns/call", "max error");
+
+    int failures = 0;
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++)
+    {
+        const Kernel &kernel = kernels[k];
+        double best = 0.0;
+        for (int i = 0; i < repeat; i++)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            kernel.run(data, count);
+            double nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            if (i == 0 || nanoseconds < best)
+                best = nanoseconds;
+        }
+
+        double error = kernel.check(data, count);
+        bool bPassed = error < 1.0e-5;
+        if (!bPassed)
+            failures++;
+        printf("%-18s %10.2f %12.2e%s\n", kernel.name, best / count, error, bPassed ? "" : "  FAILED");
+    }
+    printf("%zu calls per run, best of %d\n", count, repeat);
+
+    return failures == 0 ? 0 : 1;
+}
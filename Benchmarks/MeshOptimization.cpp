@@ -0,0 +1,108 @@
+// Mesh optimization benchmark
+// Runs the Common/MeshOptimizer passes one after another on UV spheres and
+// icospheres and prints ACMR and ATVR of a FIFO post-transform cache after
+// each, plus the time every pass takes. "generated" is the order
+// GenerateSphere() writes, band by band for the UV sphere and face by face
+// for the icosphere.
+//
+// Usage: MeshOptimization [--cache 16]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "MeshOptimizer.h"
+#include "Sphere.h"
+
+static double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char *pass, const std::vector<unsigned int> &indices, unsigned int vertexCount, unsigned int cacheSize, double milliseconds)
+{
+    VertexCacheStatistics statistics;
+    AnalyzeVertexCache(indices.data(), (unsigned int)indices.size(), vertexCount, cacheSize, statistics);
+    printf("  %-10s ACMR %6.3f  ATVR %6.3f", pass, statistics.acmr, statistics.atvr);
+    if (milliseconds > 0.0)
+        printf("  %10.3f ms", milliseconds);
+    printf("\n");
+}
+
+static bool run(const char *name, const SphereDesc &desc, unsigned int cacheSize)
+{
+    SphereMesh mesh;
+    if (!GenerateSphere(desc, mesh))
+    {
+        fprintf(stderr, "%s failed\n", name);
+        return false;
+    }
+    unsigned int vertexCount = (unsigned int)mesh.vertices.size();
+    std::vector<unsigned int> indices(mesh.indexCount);
+    for (unsigned int i = 0; i < mesh.indexCount; i++)
+        indices[i] = mesh.indexFormat == INDEX_FORMAT_UINT16 ? mesh.indices16[i] : mesh.indices32[i];
+
+    printf("%s: %u triangles, %u vertices\n", name, mesh.indexCount / 3, vertexCount);
+    report("generated", indices, vertexCount, cacheSize, 0.0);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    OptimizeVertexCache(indices.data(), indices.data(), mesh.indexCount, vertexCount);
+    report("cache", indices, vertexCount, cacheSize, millisecondsSince(start));
+
+    start = std::chrono::steady_clock::now();
+    OptimizeOverdraw(indices.data(), indices.data(), mesh.indexCount, mesh.vertices[0].position, sizeof(SphereVertex), vertexCount, MESH_OVERDRAW_THRESHOLD);
+    report("overdraw", indices, vertexCount, cacheSize, millisecondsSince(start));
+
+    start = std::chrono::steady_clock::now();
+    std::vector<SphereVertex> vertices(vertexCount);
+    unsigned int usedVertices = OptimizeVertexFetch(vertices.data(), indices.data(), mesh.indexCount, mesh.vertices.data(), vertexCount, sizeof(SphereVertex));
+    report("fetch", indices, usedVertices, cacheSize, millisecondsSince(start));
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int cacheSize = MESH_CACHE_SIZE;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "--cache") == 0)
+            cacheSize = (unsigned int)atoi(argv[i + 1]);
+        else
+        {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (cacheSize == 0)
+        cacheSize = MESH_CACHE_SIZE;
+    printf("FIFO cache of %u vertices\n\n", cacheSize);
+
+    const unsigned int uvSizes[] = {20, 100, 1000};
+    for (unsigned int i = 0; i < sizeof(uvSizes) / sizeof(uvSizes[0]); i++)
+    {
+        SphereDesc desc;
+        GetDefaultSphereDesc(desc);
+        desc.slices = desc.stacks = uvSizes[i];
+        char name[64];
+        snprintf(name, sizeof(name), "uv %ux%u", desc.slices, desc.stacks);
+        if (!run(name, desc, cacheSize))
+            return 1;
+    }
+
+    const unsigned int subdivisions[] = {2, 5, 8};
+    for (unsigned int i = 0; i < sizeof(subdivisions) / sizeof(subdivisions[0]); i++)
+    {
+        SphereDesc desc;
+        GetDefaultSphereDesc(desc);
+        desc.type = SPHERE_TYPE_ICOSPHERE;
+        desc.subdivisions = subdivisions[i];
+        char name[64];
+        snprintf(name, sizeof(name), "icosphere %u", desc.subdivisions);
+        if (!run(name, desc, cacheSize))
+            return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,70 @@
+#!/bin/sh
+# Sample benchmark
+# Builds every sample (or the ones named) for the headless loop, runs each for
+# a fixed number of frames at a fixed size and collects their --json results
+# into one JSON document tagged with the commit, so runs can be compared across
+# samples and across commits. Needs no GPU with the software or null backend.
+#
+# Usage: Benchmarks/RunSamples.sh [--frames 300] [--width 800] [--height 600]
+#            [--renderer software|null] [--build-dir dir] [--output results.json]
+#            [sample directory ...]
+# The compiler is $CXX, g++ by default; the build is Tools/SampleBuild.sh's.
+
+set -e
+
+frames=300
+width=800
+height=600
+renderer=software
+buildDir=${TMPDIR:-/tmp}/SampleBenchmark
+output=
+root=$(cd "$(dirname "$0")/.." && pwd)
+. "$root/Tools/SampleBuild.sh"
+
+while [ $# -gt 0 ]; do
+    case $1 in
+    --frames) frames=$2; shift 2 ;;
+    --width) width=$2; shift 2 ;;
+    --height) height=$2; shift 2 ;;
+    --renderer) renderer=$2; shift 2 ;;
+    --build-dir) buildDir=$2; shift 2 ;;
+    --output) output=$2; shift 2 ;;
+    --*) echo "Unknown option $1" >&2; exit 1 ;;
+    *) break ;;
+    esac
+done
+
+if [ $# -eq 0 ]; then
+    set -- "$root"/[0-9][0-9]-*/
+fi
+
+sampleBuildCommon "$root" "$buildDir"
+
+commit=$(git -C "$root" rev-parse --short HEAD 2>/dev/null || echo unknown)
+results="$buildDir/results.json"
+
+printf '{"commit": "%s", "renderer": "%s", "width": %s, "height": %s, "frames": %s, "samples": [\n' \
+    "$commit" "$renderer" "$width" "$height" "$frames" > "$results"
+separator=
+for sampleDir in "$@"; do
+    sampleDir=$(cd "$sampleDir" && pwd)
+    sample=$(basename "$sampleDir")
+    [ -f "$sampleDir/D3D.cpp" ] || continue
+
+    sampleBuild "$root" "$buildDir" "$sampleDir"
+    echo "$sample: $frames frames" >&2
+    sampleRun "$buildDir" "$sampleDir" "$sample" --renderer "$renderer" --frames "$frames" --width "$width" --height "$height" \
+        --json "$buildDir/$sample.json"
+
+    # the sample's own object, with its name in front
+    printf '%s{"sample": "%s", ' "$separator" "$sample" >> "$results"
+    tail -c +2 "$buildDir/$sample.json" >> "$results"
+    separator=','
+done
+printf ']}\n' >> "$results"
+
+if [ -n "$output" ]; then
+    cp "$results" "$output"
+else
+    cat "$results"
+fi
@@ -0,0 +1,100 @@
+// Sphere generation benchmark
+// Times GenerateSphere() in Common/Sphere.cpp for UV spheres and icospheres
+// from about 1k to 10M triangles and reports triangles/sec. UV spheres run
+// both the scalar path (SPHERE_FLAG_SCALAR) and the SSE2 one; the icosphere
+// has a single path, its cost is the shared-edge lookup, not the arithmetic.
+// Each size keeps the best of --repeat runs.
+//
+// Usage: SphereGeneration [--max-triangles 10000000] [--repeat 5]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+
+#include "Sphere.h"
+
+// Best of repeat runs in milliseconds, 0 when generation fails
+static double timeGeneration(const SphereDesc &desc, int repeat, SphereMesh &mesh)
+{
+    double best = 0.0;
+    for (int i = 0; i < repeat; i++)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        if (!GenerateSphere(desc, mesh))
+            return 0.0;
+        double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (i == 0 || milliseconds < best)
+            best = milliseconds;
+    }
+    return best;
+}
+
+static void report(const char *type, const SphereMesh &mesh, double scalarMilliseconds, double simdMilliseconds)
+{
+    unsigned int triangles = mesh.indexCount / 3;
+    printf("%-10s %10u %10u %4d %10.3f ", type, triangles, (unsigned int)mesh.vertices.size(),
+           mesh.indexFormat == INDEX_FORMAT_UINT16 ? 16 : 32, scalarMilliseconds);
+    if (simdMilliseconds > 0.0)
+        printf("%10.3f %9.1f %7.2fx\n", simdMilliseconds, triangles / simdMilliseconds / 1000.0, scalarMilliseconds / simdMilliseconds);
+    else
+        printf("%10s %9.1f %8s\n", "-", triangles / scalarMilliseconds / 1000.0, "-");
+}
+
+int main(int argc, char *argv[])
+{
+    double maxTriangles = 10000000.0;
+    int repeat = 5;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "--max-triangles") == 0)
+            maxTriangles = atof(argv[i + 1]);
+        else if (strcmp(argv[i], "--repeat") == 0)
+            repeat = atoi(argv[i + 1]);
+        else
+        {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (repeat < 1)
+        repeat = 1;
+
+    printf("%-10s %10s %10s %4s %10s %10s %9s %8s\n", "type", "triangles", "vertices", "bits", "scalar ms", "simd ms", "Mtri/s", "speedup");
+
+    SphereMesh mesh;
+    for (double target = 1000.0; target <= maxTriangles * 1.001; target *= 10.0)
+    {
+        // UV sphere with twice as many slices as stacks, 4 * stacks^2 triangles
+        SphereDesc desc;
+        GetDefaultSphereDesc(desc);
+        desc.stacks = (unsigned int)(sqrt(target / 4.0) + 0.5);
+        desc.slices = desc.stacks * 2;
+
+        desc.flags = SPHERE_FLAG_SCALAR;
+        double scalarMilliseconds = timeGeneration(desc, repeat, mesh);
+        desc.flags = 0;
+        double simdMilliseconds = timeGeneration(desc, repeat, mesh);
+        if (scalarMilliseconds <= 0.0 || simdMilliseconds <= 0.0)
+        {
+            fprintf(stderr, "UV sphere %ux%u failed\n", desc.slices, desc.stacks);
+            return 1;
+        }
+        report("uv", mesh, scalarMilliseconds, simdMilliseconds);
+
+        // icosphere with the closest power of four, 20 * 4^n triangles
+        GetDefaultSphereDesc(desc);
+        desc.type = SPHERE_TYPE_ICOSPHERE;
+        desc.subdivisions = (unsigned int)(log(target / 20.0) / log(4.0) + 0.5);
+        double icoMilliseconds = timeGeneration(desc, repeat, mesh);
+        if (icoMilliseconds <= 0.0)
+        {
+            fprintf(stderr, "Icosphere level %u failed\n", desc.subdivisions);
+            return 1;
+        }
+        report("icosphere", mesh, icoMilliseconds, 0.0);
+    }
+    return 0;
+}
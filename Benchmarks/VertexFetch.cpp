@@ -0,0 +1,222 @@
+// Vertex fetch benchmark
+// Packs the sphere of 13-PerFragmentLighting (position and normal) with
+// Common/VertexLayout in four ways and compares what the input assembler has
+// to read for one indexed draw:
+//   separate    two float3 streams, 12 + 12 bytes
+//   SphereVertex interleaved float position, normal and texcoord, 32 bytes
+//   float       interleaved float3 position and normal, 24 bytes
+//   compact     half4 position and octahedral snorm16 normal, 12 bytes
+// "fetched" is index count * bytes per vertex, the traffic with no post
+// transform cache. The timed loop walks the index buffer and decodes every
+// vertex back to floats the way SoftwareRasterizer does, best of --repeat
+// runs. The error columns are the largest position error and normal angle of
+// the encoding against the float mesh.
+//
+// Usage: VertexFetch [--stacks 20] [--repeat 5]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "Sphere.h"
+#include "VertexEncoding.h"
+#include "VertexLayout.h"
+
+struct FetchLayout
+{
+    const char *name;
+    VertexEncoding position;
+    VertexEncoding normal;
+    bool separate;   // position and normal in their own buffers
+    bool sphereVertex; // the generator's own 32 byte vertices, no packing
+};
+
+struct PackedMesh
+{
+    std::vector<unsigned char> streams[2];
+    unsigned int strides[2];
+    unsigned int offsets[2]; // of position and normal within their stream
+    unsigned int streamOf[2];
+    VertexEncoding encodings[2];
+    unsigned int vertexSize;
+};
+
+static void pack(const FetchLayout &fetchLayout, const SphereMesh &mesh, PackedMesh &packed)
+{
+    unsigned int vertexCount = (unsigned int)mesh.vertices.size();
+    const void *sources[] = {mesh.vertices[0].position, mesh.vertices[0].normal};
+    const unsigned int sourceStrides[] = {sizeof(SphereVertex), sizeof(SphereVertex)};
+    packed.encodings[0] = fetchLayout.position;
+    packed.encodings[1] = fetchLayout.normal;
+
+    if (fetchLayout.sphereVertex)
+    {
+        const unsigned char *pData = (const unsigned char *)mesh.vertices.data();
+        packed.streams[0].assign(pData, pData + vertexCount * sizeof(SphereVertex));
+        packed.strides[0] = sizeof(SphereVertex);
+        packed.offsets[0] = 0;
+        packed.offsets[1] = 12;
+        packed.streamOf[0] = packed.streamOf[1] = 0;
+        packed.vertexSize = sizeof(SphereVertex);
+    }
+    else if (fetchLayout.separate)
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            VertexLayout layout;
+            layout.Add(i == 0 ? "POSITION" : "NORMAL", 0, packed.encodings[i]);
+            layout.Pack(&sources[i], &sourceStrides[i], vertexCount, packed.streams[i]);
+            packed.strides[i] = layout.GetStride();
+            packed.offsets[i] = 0;
+            packed.streamOf[i] = i;
+        }
+        packed.vertexSize = packed.strides[0] + packed.strides[1];
+    }
+    else
+    {
+        VertexLayout layout;
+        layout.Add("POSITION", 0, packed.encodings[0]);
+        layout.Add("NORMAL", 0, packed.encodings[1]);
+        layout.Pack(sources, sourceStrides, vertexCount, packed.streams[0]);
+        packed.strides[0] = layout.GetStride();
+        packed.offsets[0] = layout.GetElements()[0].alignedByteOffset;
+        packed.offsets[1] = layout.GetElements()[1].alignedByteOffset;
+        packed.streamOf[0] = packed.streamOf[1] = 0;
+        packed.vertexSize = layout.GetStride();
+    }
+}
+
+// Position or normal of one vertex back as floats
+static inline void fetch(const PackedMesh &packed, unsigned int attribute, unsigned int vertex, float out[3])
+{
+    unsigned int stream = packed.streamOf[attribute];
+    const unsigned char *pElement = packed.streams[stream].data() + (size_t)vertex * packed.strides[stream] + packed.offsets[attribute];
+    switch (packed.encodings[attribute])
+    {
+    case VERTEX_ENCODING_HALF:
+    {
+        unsigned short half[3];
+        memcpy(half, pElement, sizeof(half));
+        out[0] = HalfToFloat(half[0]);
+        out[1] = HalfToFloat(half[1]);
+        out[2] = HalfToFloat(half[2]);
+        break;
+    }
+    case VERTEX_ENCODING_OCTAHEDRAL:
+    {
+        short snorm[2];
+        memcpy(snorm, pElement, sizeof(snorm));
+        float encoded[2] = {Snorm16ToFloat(snorm[0]), Snorm16ToFloat(snorm[1])};
+        OctahedralDecode(encoded, out);
+        break;
+    }
+    default:
+        memcpy(out, pElement, sizeof(float) * 3);
+        break;
+    }
+}
+
+// One pass over the index buffer, returns a checksum so nothing is optimized away
+static float fetchAll(const PackedMesh &packed, const SphereMesh &mesh)
+{
+    float sum = 0.0f;
+    for (unsigned int i = 0; i < mesh.indexCount; i++)
+    {
+        unsigned int index = mesh.indexFormat == INDEX_FORMAT_UINT16 ? mesh.indices16[i] : mesh.indices32[i];
+        float position[3], normal[3];
+        fetch(packed, 0, index, position);
+        fetch(packed, 1, index, normal);
+        sum += position[0] + position[1] + position[2] + normal[0] + normal[1] + normal[2];
+    }
+    return sum;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int stacks = 20;
+    int repeat = 5;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "--stacks") == 0)
+            stacks = (unsigned int)atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--repeat") == 0)
+            repeat = atoi(argv[i + 1]);
+        else
+        {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (repeat < 1)
+        repeat = 1;
+
+    SphereDesc desc;
+    GetDefaultSphereDesc(desc);
+    desc.slices = desc.stacks = stacks;
+    SphereMesh mesh;
+    if (!GenerateSphere(desc, mesh))
+    {
+        fprintf(stderr, "Sphere %ux%u failed\n", desc.slices, desc.stacks);
+        return 1;
+    }
+    unsigned int vertexCount = (unsigned int)mesh.vertices.size();
+    printf("sphere %ux%u: %u vertices, %u indices\n\n", desc.slices, desc.stacks, vertexCount, mesh.indexCount);
+
+    const FetchLayout layouts[] = {
+        {"separate", VERTEX_ENCODING_FLOAT3, VERTEX_ENCODING_FLOAT3, true, false},
+        {"SphereVertex", VERTEX_ENCODING_FLOAT3, VERTEX_ENCODING_FLOAT3, false, true},
+        {"float", VERTEX_ENCODING_FLOAT3, VERTEX_ENCODING_FLOAT3, false, false},
+        {"compact", VERTEX_ENCODING_HALF, VERTEX_ENCODING_OCTAHEDRAL, false, false},
+    };
+    const unsigned int numLayouts = sizeof(layouts) / sizeof(layouts[0]);
+
+    printf("%-12s %6s %10s %12s %8s %10s %10s %10s %9s\n", "layout", "bytes", "VB KB", "fetched KB", "vs 32B", "fetch ms", "Mvert/s", "pos err", "nrm deg");
+    for (unsigned int l = 0; l < numLayouts; l++)
+    {
+        PackedMesh packed;
+        pack(layouts[l], mesh, packed);
+
+        // accuracy against the float mesh, in double so float rounding of acos does not show up as error
+        double positionError = 0.0, normalError = 0.0;
+        for (unsigned int v = 0; v < vertexCount; v++)
+        {
+            float position[3], normal[3];
+            fetch(packed, 0, v, position);
+            fetch(packed, 1, v, normal);
+            const float *pReference = mesh.vertices[v].position;
+            const float *nReference = mesh.vertices[v].normal;
+            double cross[3], dot = 0.0;
+            for (int c = 0; c < 3; c++)
+            {
+                positionError = fmax(positionError, fabs((double)position[c] - pReference[c]));
+                dot += (double)normal[c] * nReference[c];
+            }
+            cross[0] = (double)normal[1] * nReference[2] - (double)normal[2] * nReference[1];
+            cross[1] = (double)normal[2] * nReference[0] - (double)normal[0] * nReference[2];
+            cross[2] = (double)normal[0] * nReference[1] - (double)normal[1] * nReference[0];
+            double angle = atan2(sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]), dot);
+            normalError = fmax(normalError, angle * 57.29577951308232);
+        }
+
+        double best = 0.0;
+        volatile float checksum = 0.0f;
+        for (int i = 0; i < repeat; i++)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            checksum = checksum + fetchAll(packed, mesh);
+            double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            if (i == 0 || milliseconds < best)
+                best = milliseconds;
+        }
+
+        double vbKilobytes = (double)vertexCount * packed.vertexSize / 1024.0;
+        double fetchedKilobytes = (double)mesh.indexCount * packed.vertexSize / 1024.0;
+        printf("%-12s %6u %10.1f %12.1f %7.0f%% %10.3f %10.1f %10.2e %9.4f\n", layouts[l].name, packed.vertexSize, vbKilobytes, fetchedKilobytes,
+               100.0 * packed.vertexSize / sizeof(SphereVertex), best, mesh.indexCount / best / 1000.0, positionError, normalError);
+    }
+    return 0;
+}
@@ -0,0 +1,169 @@
+#ifdef _WIN32
+#include <windows.h>
+#include <mmsystem.h>
+#else
+#include <time.h>
+#endif
+#include <math.h>
+
+#include "Clock.h"
+
+#ifdef _WIN32
+#pragma comment(lib, "winmm.lib")
+
+static double getSecondsPerTick()
+{
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency); // Fixed at boot, never fails on XP and later
+    return 1.0 / (double)frequency.QuadPart;
+}
+
+unsigned long long ClockTicks()
+{
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (unsigned long long)counter.QuadPart;
+}
+
+double ClockSeconds(unsigned long long ticks)
+{
+    static const double secondsPerTick = getSecondsPerTick();
+    return ticks * secondsPerTick;
+}
+
+unsigned long long ClockTicksFromSeconds(double seconds)
+{
+    static const double ticksPerSecond = 1.0 / getSecondsPerTick();
+    return (unsigned long long)(seconds * ticksPerSecond);
+}
+
+double ClockCpuSeconds()
+{
+    // Kernel and user time in 100 ns units
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+        return 0.0;
+    ULARGE_INTEGER kernel, user;
+    kernel.LowPart = kernelTime.dwLowDateTime;
+    kernel.HighPart = kernelTime.dwHighDateTime;
+    user.LowPart = userTime.dwLowDateTime;
+    user.HighPart = userTime.dwHighDateTime;
+    return (kernel.QuadPart + user.QuadPart) * 1e-7;
+}
+
+#else
+
+// Nanosecond ticks
+unsigned long long ClockTicks()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ull + (unsigned long long)now.tv_nsec;
+}
+
+double ClockSeconds(unsigned long long ticks)
+{
+    return ticks * 1e-9;
+}
+
+unsigned long long ClockTicksFromSeconds(double seconds)
+{
+    return (unsigned long long)(seconds * 1e9);
+}
+
+double ClockCpuSeconds()
+{
+    struct timespec cpuTime;
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpuTime) != 0)
+        return 0.0;
+    return cpuTime.tv_sec + cpuTime.tv_nsec * 1e-9;
+}
+
+#endif // _WIN32
+
+void ClockBeginTimerPeriod()
+{
+#ifdef _WIN32
+    // Sleep(1) only wakes after 1 ms instead of the default 15.6 ms tick with the period raised
+    timeBeginPeriod(1);
+#endif
+}
+
+void ClockEndTimerPeriod()
+{
+#ifdef _WIN32
+    timeEndPeriod(1);
+#endif
+}
+
+// One CLOCK_SLEEP_SLICE, a whole timer tick unless the caller raised the period
+static void sleepSlice()
+{
+#ifdef _WIN32
+    Sleep(1);
+#else
+    struct timespec slice = {0, (long)(CLOCK_SLEEP_SLICE * 1e9)};
+    nanosleep(&slice, NULL);
+#endif
+}
+
+void ClockSleepUntil(unsigned long long ticks)
+{
+    // Observed length of a slice, Welford's running mean and variance
+    static thread_local double sleepMean = CLOCK_SLEEP_SLICE;
+    static thread_local double sleepM2 = 0.0;
+    static thread_local unsigned long long sleepCount = 1;
+
+    unsigned long long now = ClockTicks();
+    while (now < ticks)
+    {
+        double remaining = ClockSeconds(ticks - now);
+        double estimate = sleepMean + sqrt(sleepM2 / sleepCount);
+        if (remaining <= estimate)
+            break;
+
+        sleepSlice();
+        unsigned long long woken = ClockTicks();
+        double observed = ClockSeconds(woken - now);
+        now = woken;
+
+        sleepCount++;
+        double delta = observed - sleepMean;
+        sleepMean += delta / sleepCount;
+        sleepM2 += delta * (observed - sleepMean);
+    }
+    while (now < ticks)
+        now = ClockTicks();
+}
+
+SimulationClock::SimulationClock(unsigned int rate) : stepSeconds(1.0 / (rate > 0 ? rate : SIMULATION_RATE)),
+                                                      accumulator(0.0),
+                                                      steps(0),
+                                                      droppedSteps(0),
+                                                      bPaused(false)
+{
+}
+
+unsigned int SimulationClock::Advance(double elapsedSeconds)
+{
+    if (bPaused || elapsedSeconds <= 0.0)
+        return 0;
+
+    accumulator += elapsedSeconds;
+    unsigned long long due = (unsigned long long)(accumulator / stepSeconds);
+    accumulator -= due * stepSeconds;
+    if (accumulator < 0.0) // Rounding of the subtraction
+        accumulator = 0.0;
+    if (due > SIMULATION_MAX_STEPS)
+    {
+        droppedSteps += due - SIMULATION_MAX_STEPS;
+        due = SIMULATION_MAX_STEPS;
+    }
+    steps += due;
+    return (unsigned int)due;
+}
+
+void SimulationClock::SetPaused(bool bPause)
+{
+    bPaused = bPause;
+}
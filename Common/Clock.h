@@ -0,0 +1,56 @@
+#pragma once
+
+// Simulation clock
+// ClockTicks() reads the high resolution monotonic counter,
+// QueryPerformanceCounter on Windows and clock_gettime(CLOCK_MONOTONIC)
+// elsewhere. SimulationClock turns the real time between frames into a whole
+// number of fixed steps, so Scene::Update() always advances by the same amount
+// no matter how fast frames are drawn, and reports how far the clock is into
+// the next step for Scene::Interpolate(). Time that passes while paused is
+// dropped instead of being caught up on resume.
+
+#define SIMULATION_RATE 60        // Fixed steps per second
+#define SIMULATION_MAX_STEPS 8    // Per frame, anything longer is dropped so a stall cannot snowball
+
+unsigned long long ClockTicks();
+double ClockSeconds(unsigned long long ticks);      // Ticks to seconds
+unsigned long long ClockTicksFromSeconds(double seconds);
+double ClockCpuSeconds();                           // CPU time of the process so far, all threads summed
+
+// Sleep in CLOCK_SLEEP_SLICE slices while the remaining time is longer than
+// such a sleep has been observed to take (mean plus one standard deviation of
+// the oversleep, per thread), then spin on ClockTicks() for the rest, so the
+// deadline is met to within microseconds without burning the whole wait
+#define CLOCK_SLEEP_SLICE 0.001 // Seconds, one Sleep(1) with the timer period raised to 1 ms
+void ClockSleepUntil(unsigned long long ticks);
+
+// Raise the Windows timer period to 1 ms for ClockSleepUntil() and restore it,
+// in pairs; the period is system wide, so it is only raised while something
+// sleeps on a schedule. No-ops elsewhere
+void ClockBeginTimerPeriod();
+void ClockEndTimerPeriod();
+
+class SimulationClock
+{
+private:
+    double stepSeconds;
+    double accumulator; // Real time not yet simulated, less than one step after Advance()
+    unsigned long long steps;
+    unsigned long long droppedSteps;
+    bool bPaused;
+
+public:
+    explicit SimulationClock(unsigned int rate = SIMULATION_RATE);
+
+    // Add elapsedSeconds of real time, returns the number of Update() steps to run
+    unsigned int Advance(double elapsedSeconds);
+
+    void SetPaused(bool bPause);
+    bool IsPaused() const { return bPaused; }
+
+    float GetStepSeconds() const { return (float)stepSeconds; }
+    float GetAlpha() const { return (float)(accumulator / stepSeconds); } // 0..1 between the last two steps
+    unsigned long long GetSteps() const { return steps; }                 // Run since creation
+    unsigned long long GetDroppedSteps() const { return droppedSteps; }    // Skipped by SIMULATION_MAX_STEPS
+    double GetSimulatedSeconds() const { return steps * stepSeconds; }
+};
@@ -0,0 +1,30 @@
+#include <string.h>
+
+#include "ConstantBlock.h"
+
+ConstantBlock::ConstantBlock(ConstantFrequency frequency, unsigned int size) : frequency(frequency),
+                                                                              data(size, 0),
+                                                                              bDirty(true)
+{
+    memset(&allocation, 0, sizeof(allocation));
+}
+
+void ConstantBlock::Update(const void *pData)
+{
+    if (memcmp(data.data(), pData, data.size()) == 0)
+        return;
+    memcpy(data.data(), pData, data.size());
+    bDirty = true;
+}
+
+bool ConstantBlock::Bind(Renderer *pRenderer)
+{
+    if (bDirty || !pRenderer->IsConstantAllocationValid(allocation))
+    {
+        if (!pRenderer->UploadConstants(data.data(), (unsigned int)data.size(), allocation))
+            return false;
+        bDirty = false;
+    }
+    pRenderer->SetConstants((unsigned int)frequency, allocation);
+    return true;
+}
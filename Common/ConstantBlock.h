@@ -0,0 +1,36 @@
+#pragma once
+
+// A block of shader constants that changes at one frequency. Scenes keep a
+// CPU copy per block, hand it new values with Update() and call Bind() before
+// drawing; the block only goes through the constant ring when its bytes
+// changed or the ring recycled its last upload, so values that never change
+// (light, material) are sent once rather than every frame.
+//
+// Each frequency has a fixed register, declare the cbuffers as
+// register(b0) per frame, register(b1) per view, register(b2) per object.
+
+#include <vector>
+
+#include "Renderer.h"
+
+enum ConstantFrequency
+{
+    CONSTANT_FREQUENCY_FRAME = 0, // Light, time
+    CONSTANT_FREQUENCY_VIEW,      // View and projection, change on resize or camera moves
+    CONSTANT_FREQUENCY_OBJECT     // World or world-view-projection of one draw
+};
+
+class ConstantBlock
+{
+private:
+    ConstantFrequency frequency;
+    std::vector<unsigned char> data;
+    bool bDirty;
+    ConstantAllocation allocation;
+
+public:
+    ConstantBlock(ConstantFrequency frequency, unsigned int size);
+
+    void Update(const void *pData); // size bytes, marks the block dirty only when they differ
+    bool Bind(Renderer *pRenderer); // Upload if needed and bind to register(b<frequency>)
+};
@@ -0,0 +1,96 @@
+#include <string.h>
+
+#include "ConstantRing.h"
+
+ConstantRing::ConstantRing() : head(0),
+                               generation(0)
+{
+    memset(bound, 0, sizeof(bound));
+}
+
+void ConstantRing::Reset(unsigned int capacity)
+{
+    memory.assign(capacity, 0);
+    head = capacity; // First upload wraps and opens generation 1
+    generation = 0;
+    memset(bound, 0, sizeof(bound));
+}
+
+bool ConstantRing::Upload(const void *pData, unsigned int size, ConstantAllocation &allocation, bool &bWrapped)
+{
+    unsigned int capacity = (unsigned int)memory.size();
+    unsigned int alignedSize = (size + CONSTANT_ALIGNMENT - 1) & ~(CONSTANT_ALIGNMENT - 1);
+    if (size == 0 || alignedSize > capacity)
+        return false;
+
+    bWrapped = alignedSize > capacity - head;
+    if (!bWrapped)
+    {
+        allocation.offset = head;
+        allocation.size = alignedSize;
+        allocation.generation = generation;
+        memcpy(&memory[head], pData, size);
+        head += alignedSize;
+        return true;
+    }
+
+    // keep what is still bound before offset 0 onwards gets overwritten
+    std::vector<unsigned char> stash;
+    for (unsigned int slot = 0; slot < CONSTANT_RING_SLOTS; slot++)
+    {
+        if (IsValid(bound[slot]))
+            stash.insert(stash.end(), memory.begin() + bound[slot].offset, memory.begin() + bound[slot].offset + bound[slot].size);
+    }
+
+    generation++;
+    head = 0;
+    allocation.offset = head;
+    allocation.size = alignedSize;
+    allocation.generation = generation;
+    memcpy(&memory[head], pData, size);
+    head += alignedSize;
+
+    // bound ranges are at most CONSTANT_RING_SLOTS blocks, they fit behind the new data
+    unsigned int stashOffset = 0;
+    for (unsigned int slot = 0; slot < CONSTANT_RING_SLOTS; slot++)
+    {
+        if (bound[slot].generation == 0 || bound[slot].generation != generation - 1)
+            continue;
+        const unsigned char *pStashed = &stash[stashOffset];
+        stashOffset += bound[slot].size;
+        if (bound[slot].size > capacity - head)
+        {
+            memset(&bound[slot], 0, sizeof(bound[slot]));
+            continue;
+        }
+        memcpy(&memory[head], pStashed, bound[slot].size);
+        bound[slot].offset = head;
+        bound[slot].generation = generation;
+        head += bound[slot].size;
+    }
+    return true;
+}
+
+bool ConstantRing::IsValid(const ConstantAllocation &allocation) const
+{
+    return allocation.generation != 0 && allocation.generation == generation;
+}
+
+void ConstantRing::Bind(unsigned int slot, const ConstantAllocation &allocation)
+{
+    if (slot < CONSTANT_RING_SLOTS && IsValid(allocation))
+        bound[slot] = allocation;
+}
+
+void ConstantRing::Unbind(unsigned int slot)
+{
+    if (slot < CONSTANT_RING_SLOTS)
+        memset(&bound[slot], 0, sizeof(bound[slot]));
+}
+
+const ConstantAllocation *ConstantRing::GetBound(unsigned int slot) const
+{
+    if (slot >= CONSTANT_RING_SLOTS || !IsValid(bound[slot]))
+        return NULL;
+    return &bound[slot];
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+// CPU side of the constant ring, shared by the backends. Allocations are
+// CONSTANT_ALIGNMENT aligned and never straddle the end: one that does not fit
+// wraps to offset 0 and starts a new generation, which the D3D11 backend maps
+// with DISCARD. Ranges still bound at that point would see the discarded
+// contents, so Upload() copies them into the new generation first and the
+// backend rebinds them. The software backend reads constants straight from
+// this memory, the D3D11 backend copies from it into the mapped buffer.
+
+#include <vector>
+
+#include "Renderer.h"
+
+#define CONSTANT_RING_SLOTS 4 // Bind points tracked, like SR_MAX_CONSTANT_BUFFERS
+
+class ConstantRing
+{
+private:
+    std::vector<unsigned char> memory;
+    unsigned int head;       // Next free byte
+    unsigned int generation; // Wraps so far, allocations carry it
+    ConstantAllocation bound[CONSTANT_RING_SLOTS];
+
+public:
+    ConstantRing();
+
+    void Reset(unsigned int capacity);
+
+    // Copy size bytes into the ring. bWrapped is set when this upload opened a
+    // new generation, then every bound range moved and only [0, GetHead()) is
+    // valid. false when size is larger than the whole ring.
+    bool Upload(const void *pData, unsigned int size, ConstantAllocation &allocation, bool &bWrapped);
+    bool IsValid(const ConstantAllocation &allocation) const;
+
+    void Bind(unsigned int slot, const ConstantAllocation &allocation);
+    void Unbind(unsigned int slot);
+    const ConstantAllocation *GetBound(unsigned int slot) const; // NULL when the slot holds no ring range
+
+    const unsigned char *GetData(const ConstantAllocation &allocation) const { return memory.data() + allocation.offset; }
+    unsigned int GetHead() const { return head; }
+};
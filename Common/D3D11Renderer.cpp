@@ -0,0 +1,1399 @@
+#ifdef _WIN32
+
+// Windows header files
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+
+// D3D11 Related header file
+#include <d3d11_1.h>
+
+#include "WICTextureLoader.h"
+#include "Clock.h"
+#include "D3D11Renderer.h"
+#include "Image.h"
+#include "JobSystem.h"
+#include "ShaderCache.h"
+#include "Log.h"
+
+// d3d Related
+#pragma comment(lib, "d3d11.lib")
+#pragma comment(lib, "DirectXTK.lib")
+
+using namespace std;
+
+// Constructor
+D3D11Renderer::D3D11Renderer() : ghwnd(NULL),
+                                 gpIDXGISwapChain(NULL),
+                                 gpID3D11Device(NULL),
+                                 gpID3D11DeviceContext(NULL),
+                                 gpID3D11RenderTargetView(NULL),
+                                 gpID3D11DepthStencilView(NULL),
+                                 depthWidth(0),
+                                 depthHeight(0),
+                                 gpID3D11RasterizerState(NULL),
+                                 gpID3D11SamplerState(NULL),
+                                 gpID3D11DeviceContext1(NULL),
+                                 gpConstantRingBuffer(NULL),
+                                 bConstantBufferOffsetting(false),
+                                 bufferCount(PRESENT_DEFAULT_BUFFERS),
+                                 swapChainFlags(0),
+                                 hFrameLatencyWaitableObject(NULL),
+                                 frameInput(0),
+                                 lastDisplayedPresentCount(0),
+                                 captureNext(0)
+{
+    ZeroMemory((void *)&rendererDesc, sizeof(RendererDesc));
+    ZeroMemory((void *)gpConstantSlotBuffers, sizeof(gpConstantSlotBuffers));
+    ZeroMemory((void *)&frameStatistics, sizeof(RendererStatistics));
+    ZeroMemory((void *)&statistics, sizeof(RendererStatistics));
+    ZeroMemory((void *)presentInputs, sizeof(presentInputs));
+    for (unsigned int i = 0; i < CAPTURE_RING_SIZE; i++)
+    {
+        captureSlots[i].pStaging = NULL;
+        captureSlots[i].width = 0;
+        captureSlots[i].height = 0;
+        captureSlots[i].bPending = false;
+    }
+#if PROFILER_ENABLED
+    ZeroMemory((void *)gpuTimerFrames, sizeof(gpuTimerFrames));
+    gpuTimerFrame = 0;
+    bGpuTimerOpen = false;
+#endif
+}
+
+// Destructor
+D3D11Renderer::~D3D11Renderer()
+{
+    Cleanup(); // Cleanup resources
+}
+
+// Create swap chain, device, rasterizer state and the default sampler
+int D3D11Renderer::Initialize(void *pNativeWindow, const RendererDesc &desc)
+{
+    HRESULT hr = S_OK;
+
+    ghwnd = (HWND)pNativeWindow;
+    rendererDesc = desc;
+
+    // flip model needs a second buffer, a single one is the old blt model
+    bufferCount = GetPresentBufferCount(desc);
+    bool bFlipModel = bufferCount >= 2;
+    swapChainFlags = bFlipModel ? DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT : 0;
+
+    // Initialize swap chain description
+    DXGI_SWAP_CHAIN_DESC dxgiSwapChainDesc;
+    ZeroMemory((void *)&dxgiSwapChainDesc, sizeof(DXGI_SWAP_CHAIN_DESC));
+    dxgiSwapChainDesc.BufferDesc.Width = desc.width;
+    dxgiSwapChainDesc.BufferDesc.Height = desc.height;
+    dxgiSwapChainDesc.BufferDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    dxgiSwapChainDesc.BufferDesc.RefreshRate.Numerator = 60;
+    dxgiSwapChainDesc.BufferDesc.RefreshRate.Denominator = 1;
+    dxgiSwapChainDesc.SampleDesc.Count = 1;
+    dxgiSwapChainDesc.SampleDesc.Quality = 0;
+    dxgiSwapChainDesc.BufferCount = bufferCount;
+    dxgiSwapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
+    dxgiSwapChainDesc.OutputWindow = ghwnd;
+    dxgiSwapChainDesc.Windowed = TRUE;
+    dxgiSwapChainDesc.SwapEffect = bFlipModel ? DXGI_SWAP_EFFECT_FLIP_DISCARD : DXGI_SWAP_EFFECT_DISCARD;
+    dxgiSwapChainDesc.Flags = swapChainFlags;
+
+    // Create swap chain, device, device context and render target view
+    D3D_DRIVER_TYPE d3dDriverType;
+    D3D_DRIVER_TYPE d3dDriverTypes[] = {D3D_DRIVER_TYPE_HARDWARE,
+                                        D3D_DRIVER_TYPE_WARP,
+                                        D3D_DRIVER_TYPE_SOFTWARE,
+                                        D3D_DRIVER_TYPE_REFERENCE,
+                                        D3D_DRIVER_TYPE_NULL,
+                                        D3D_DRIVER_TYPE_UNKNOWN};
+    const char *d3dDriverTypeNames[] = {"Hardware Driver", "WARP", "SOFTWARE", "REFERENCE", "NULL", "UNKNOWN"};
+    D3D_FEATURE_LEVEL d3dFeatureLevel_required = D3D_FEATURE_LEVEL_11_0;
+    D3D_FEATURE_LEVEL d3dFeatureLevel_acquired = D3D_FEATURE_LEVEL_10_0;
+    UINT numDriverTypes;
+    UINT numFeatureLevels = 1;
+    UINT driverIndex = 0;
+
+    numDriverTypes = sizeof(d3dDriverTypes) / sizeof(d3dDriverTypes[0]);
+
+    for (driverIndex = 0; driverIndex < numDriverTypes; driverIndex++)
+    {
+        d3dDriverType = d3dDriverTypes[driverIndex];
+        hr = D3D11CreateDeviceAndSwapChain(NULL,
+                                           d3dDriverType,
+                                           NULL,
+                                           0,
+                                           &d3dFeatureLevel_required,
+                                           numFeatureLevels,
+                                           D3D11_SDK_VERSION,
+                                           &dxgiSwapChainDesc,
+                                           &gpIDXGISwapChain,
+                                           &gpID3D11Device,
+                                           &d3dFeatureLevel_acquired,
+                                           &gpID3D11DeviceContext);
+        if (SUCCEEDED(hr))
+            break;
+
+        // FLIP_DISCARD needs Windows 10, retry the same driver with the blt model
+        if (dxgiSwapChainDesc.SwapEffect != DXGI_SWAP_EFFECT_DISCARD)
+        {
+            LogWarning("Flip model swap chain Failed with %s, falling back to DXGI_SWAP_EFFECT_DISCARD\n", d3dDriverTypeNames[driverIndex]);
+            dxgiSwapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_DISCARD;
+            dxgiSwapChainDesc.Flags = swapChainFlags = 0;
+            driverIndex--;
+        }
+    }
+
+    if (FAILED(hr))
+    {
+        LogError("D3D11CreateDeviceAndSwapChain Failed\n");
+        return hr;
+    }
+
+    // print which driver and feature level we found
+    Log("D3D11CreateDeviceAndSwapChain Succeeded with %s\n", d3dDriverTypeNames[driverIndex]);
+    if (d3dFeatureLevel_acquired == D3D_FEATURE_LEVEL_11_0)
+        Log("D3D11CreateDeviceAndSwapChain Succeeded with Feature Level 11.0\n");
+    else if (d3dFeatureLevel_acquired == D3D_FEATURE_LEVEL_10_1)
+        Log("D3D11CreateDeviceAndSwapChain Succeeded with Feature Level 10.1\n");
+    else if (d3dFeatureLevel_acquired == D3D_FEATURE_LEVEL_10_0)
+        Log("D3D11CreateDeviceAndSwapChain Succeeded with Feature Level 10.0\n");
+    else
+        Log("D3D11CreateDeviceAndSwapChain Succeeded with Feature Level UNKNOWN\n");
+
+    // the window belongs to the window thread and 'F' toggles fullscreen there;
+    // DXGI's own Alt+Enter would switch modes behind the frame loop's back
+    IDXGIFactory *pIDXGIFactory = NULL;
+    if (SUCCEEDED(gpIDXGISwapChain->GetParent(__uuidof(IDXGIFactory), (void **)&pIDXGIFactory)))
+    {
+        pIDXGIFactory->MakeWindowAssociation(ghwnd, DXGI_MWA_NO_ALT_ENTER);
+        pIDXGIFactory->Release();
+    }
+
+    // every binding from here on goes through the redundant state filter
+    stateCache.SetContext(gpID3D11DeviceContext, NULL);
+
+    // create and set rasterizer state
+    D3D11_RASTERIZER_DESC d3dRasterizerDesc;
+    ZeroMemory((void *)&d3dRasterizerDesc, sizeof(D3D11_RASTERIZER_DESC));
+    d3dRasterizerDesc.CullMode = D3D11_CULL_NONE;
+    if (desc.cullMode == CULL_MODE_BACK)
+        d3dRasterizerDesc.CullMode = D3D11_CULL_BACK;
+    else if (desc.cullMode == CULL_MODE_FRONT)
+        d3dRasterizerDesc.CullMode = D3D11_CULL_FRONT;
+    d3dRasterizerDesc.FillMode = D3D11_FILL_SOLID;
+    d3dRasterizerDesc.MultisampleEnable = FALSE;
+    d3dRasterizerDesc.DepthBias = 0;
+    d3dRasterizerDesc.DepthBiasClamp = 0.0f;
+    d3dRasterizerDesc.SlopeScaledDepthBias = 0;
+    d3dRasterizerDesc.DepthClipEnable = TRUE;
+    d3dRasterizerDesc.AntialiasedLineEnable = FALSE;
+    d3dRasterizerDesc.FrontCounterClockwise = FALSE;
+    d3dRasterizerDesc.ScissorEnable = FALSE;
+
+    hr = gpID3D11Device->CreateRasterizerState(&d3dRasterizerDesc, &gpID3D11RasterizerState);
+    if (FAILED(hr))
+    {
+        LogError("CreateRasterizerState Failed\n");
+        return hr;
+    }
+    Log("CreateRasterizerState Successful\n");
+
+    // set above structure into pipeline
+    stateCache.RSSetState(gpID3D11RasterizerState);
+
+    // sampler used by every texture, same as the textured samples had
+    D3D11_SAMPLER_DESC d3dSamplerDesc;
+    ZeroMemory((void *)&d3dSamplerDesc, sizeof(D3D11_SAMPLER_DESC));
+    d3dSamplerDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+    d3dSamplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_WRAP;
+    d3dSamplerDesc.AddressV = D3D11_TEXTURE_ADDRESS_WRAP;
+    d3dSamplerDesc.AddressW = D3D11_TEXTURE_ADDRESS_WRAP;
+
+    hr = gpID3D11Device->CreateSamplerState(&d3dSamplerDesc, &gpID3D11SamplerState);
+    if (FAILED(hr))
+    {
+        LogError("CreateSamplerState Failed\n");
+        return hr;
+    }
+    Log("CreateSamplerState Successful\n");
+
+    stateCache.PSSetSampler(0, gpID3D11SamplerState);
+
+    hr = setupConstantRing();
+    if (FAILED(hr))
+    {
+        LogError("setupConstantRing Failed\n");
+        return hr;
+    }
+
+    hr = setupPresentQueue();
+    if (FAILED(hr))
+    {
+        LogError("setupPresentQueue Failed\n");
+        return hr;
+    }
+
+    // warmup resize
+    hr = Resize(desc.width, desc.height);
+    if (FAILED(hr))
+    {
+        LogError("Resize Failed\n");
+        return hr;
+    }
+    Log("Resized Successfully\n");
+
+    return hr;
+}
+
+// Resize the swap chain, render target view and depth buffer
+int D3D11Renderer::Resize(int width, int height)
+{
+    HRESULT hr = S_OK;
+
+    if (height <= 0)
+        height = 1;
+    if (width <= 0)
+        width = 1;
+
+    // nothing to do for the same size, the warmup resize has no rtv yet
+    if (gpID3D11RenderTargetView && width == rendererDesc.width && height == rendererDesc.height)
+        return hr;
+
+    frameStatistics.resizes++;
+
+    // release rtv, the new one may get the same address
+    if (gpID3D11RenderTargetView)
+    {
+        gpID3D11RenderTargetView->Release();
+        gpID3D11RenderTargetView = NULL;
+    }
+    stateCache.InvalidateRenderTargets();
+
+    // resize the swapchain buffers according to the changed size
+    hr = gpIDXGISwapChain->ResizeBuffers(bufferCount, width, height, DXGI_FORMAT_R8G8B8A8_UNORM, swapChainFlags);
+    if (FAILED(hr))
+    {
+        LogError("ResizeBuffers Failed\n");
+        return hr;
+    }
+    frameStatistics.resizeAllocations++;
+
+    // A. get the buffer from swapchain into the texture
+    ID3D11Texture2D *pID3D11texture2d = NULL;
+    hr = gpIDXGISwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void **)&pID3D11texture2d);
+    if (FAILED(hr))
+    {
+        LogError("GetBuffer Failed\n");
+        return hr;
+    }
+
+    // B. create new rtv using above buffer
+    hr = gpID3D11Device->CreateRenderTargetView(pID3D11texture2d, NULL, &gpID3D11RenderTargetView);
+    pID3D11texture2d->Release();
+    pID3D11texture2d = NULL;
+    if (FAILED(hr))
+    {
+        LogError("CreateRenderTargetView Failed\n");
+        return hr;
+    }
+    Log("CreateRenderTargetView Successful\n");
+
+    // the swap chain has the new size only now, a failed resize leaves the
+    // rtv NULL so the next one retries
+    rendererDesc.width = width;
+    rendererDesc.height = height;
+
+    // the depth buffer follows every size, D3D11 binds a dsv only together with
+    // an rtv of the same dimensions so it cannot be pooled at a larger size
+    if (rendererDesc.bDepthBuffer && (width != depthWidth || height != depthHeight))
+    {
+        if (gpID3D11DepthStencilView)
+        {
+            gpID3D11DepthStencilView->Release();
+            gpID3D11DepthStencilView = NULL;
+        }
+        depthWidth = width;
+        depthHeight = height;
+
+        // create an empty texture of the back buffer size, we will call it depth buffer
+        D3D11_TEXTURE2D_DESC d3dtexture2dDesc;
+        ZeroMemory(&d3dtexture2dDesc, sizeof(D3D11_TEXTURE2D_DESC));
+        d3dtexture2dDesc.Width = (UINT)depthWidth;
+        d3dtexture2dDesc.Height = (UINT)depthHeight;
+        d3dtexture2dDesc.MipLevels = 1;
+        d3dtexture2dDesc.ArraySize = 1;
+        d3dtexture2dDesc.SampleDesc.Count = 1;
+        d3dtexture2dDesc.SampleDesc.Quality = 0;
+        d3dtexture2dDesc.Usage = D3D11_USAGE_DEFAULT;
+        d3dtexture2dDesc.Format = DXGI_FORMAT_D32_FLOAT;
+        d3dtexture2dDesc.BindFlags = D3D11_BIND_DEPTH_STENCIL;
+        d3dtexture2dDesc.CPUAccessFlags = 0;
+        d3dtexture2dDesc.MiscFlags = 0;
+
+        ID3D11Texture2D *pID3D11texture2d_DepthBuffer = NULL;
+
+        hr = gpID3D11Device->CreateTexture2D(&d3dtexture2dDesc, NULL, &pID3D11texture2d_DepthBuffer);
+        if (FAILED(hr))
+        {
+            LogError("CreateTexture2D for Depth Stencil Buffer Failed\n");
+            depthWidth = depthHeight = 0;
+            return hr;
+        }
+        frameStatistics.resizeAllocations++;
+        Log("CreateTexture2D for Depth Stencil Buffer Successful\n");
+
+        // create depth stencil view, the texture is single sampled
+        D3D11_DEPTH_STENCIL_VIEW_DESC d3dDepthStencilViewDesc;
+        ZeroMemory((void *)&d3dDepthStencilViewDesc, sizeof(D3D11_DEPTH_STENCIL_VIEW_DESC));
+        d3dDepthStencilViewDesc.Format = DXGI_FORMAT_D32_FLOAT;
+        d3dDepthStencilViewDesc.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2D;
+
+        hr = gpID3D11Device->CreateDepthStencilView(pID3D11texture2d_DepthBuffer, &d3dDepthStencilViewDesc, &gpID3D11DepthStencilView);
+        pID3D11texture2d_DepthBuffer->Release();
+        pID3D11texture2d_DepthBuffer = NULL;
+        if (FAILED(hr))
+        {
+            LogError("CreateDepthStencilView Failed\n");
+            depthWidth = depthHeight = 0;
+            return hr;
+        }
+        Log("CreateDepthStencilView Successful\n");
+    }
+
+    // C. set this new rtv into OM state pipeline
+    stateCache.OMSetRenderTarget(gpID3D11RenderTargetView, gpID3D11DepthStencilView);
+
+    // set the viewport
+    D3D11_VIEWPORT d3dViewport;
+    ZeroMemory((void *)&d3dViewport, sizeof(D3D11_VIEWPORT));
+    d3dViewport.TopLeftX = 0.0f;
+    d3dViewport.TopLeftY = 0.0f;
+    d3dViewport.Width = (float)width;
+    d3dViewport.Height = (float)height;
+    d3dViewport.MinDepth = 0.0f;
+    d3dViewport.MaxDepth = 1.0f;
+
+    // set above viewport in pipeline
+    stateCache.RSSetViewport(d3dViewport);
+
+    return hr;
+}
+
+// Cleanup resources
+void D3D11Renderer::Cleanup()
+{
+    releaseGpuTimers();
+
+    for (unsigned int i = 0; i < CAPTURE_RING_SIZE; i++)
+    {
+        if (captureSlots[i].pStaging)
+        {
+            captureSlots[i].pStaging->Release();
+            captureSlots[i].pStaging = NULL;
+        }
+        captureSlots[i].bPending = false;
+    }
+
+    for (size_t i = 0; i < textures.size(); i++)
+    {
+        if (textures[i])
+            textures[i]->Release();
+    }
+    textures.clear();
+
+    for (size_t i = 0; i < shaders.size(); i++)
+    {
+        if (shaders[i].pInputLayout)
+            shaders[i].pInputLayout->Release();
+        if (shaders[i].pPixelShader)
+            shaders[i].pPixelShader->Release();
+        if (shaders[i].pVertexShader)
+            shaders[i].pVertexShader->Release();
+    }
+    shaders.clear();
+
+    for (size_t i = 0; i < buffers.size(); i++)
+    {
+        if (buffers[i])
+            buffers[i]->Release();
+    }
+    buffers.clear();
+
+    for (int i = 0; i < CONSTANT_RING_SLOTS; i++)
+    {
+        if (gpConstantSlotBuffers[i])
+        {
+            gpConstantSlotBuffers[i]->Release();
+            gpConstantSlotBuffers[i] = NULL;
+        }
+    }
+
+    if (gpConstantRingBuffer)
+    {
+        gpConstantRingBuffer->Release();
+        gpConstantRingBuffer = NULL;
+    }
+
+    if (hFrameLatencyWaitableObject)
+    {
+        CloseHandle(hFrameLatencyWaitableObject);
+        hFrameLatencyWaitableObject = NULL;
+    }
+
+    if (gpID3D11DeviceContext1)
+    {
+        gpID3D11DeviceContext1->Release();
+        gpID3D11DeviceContext1 = NULL;
+    }
+
+    if (gpID3D11SamplerState)
+    {
+        gpID3D11SamplerState->Release();
+        gpID3D11SamplerState = NULL;
+    }
+
+    if (gpID3D11RasterizerState)
+    {
+        gpID3D11RasterizerState->Release();
+        gpID3D11RasterizerState = NULL;
+    }
+
+    if (gpID3D11DepthStencilView)
+    {
+        gpID3D11DepthStencilView->Release();
+        gpID3D11DepthStencilView = NULL;
+    }
+    depthWidth = 0;
+    depthHeight = 0;
+
+    if (gpID3D11RenderTargetView)
+    {
+        gpID3D11RenderTargetView->Release();
+        gpID3D11RenderTargetView = NULL;
+    }
+
+    stateCache.SetContext(NULL, NULL);
+    if (gpID3D11DeviceContext)
+    {
+        gpID3D11DeviceContext->Release();
+        gpID3D11DeviceContext = NULL;
+    }
+
+    if (gpIDXGISwapChain)
+    {
+        gpIDXGISwapChain->Release();
+        gpIDXGISwapChain = NULL;
+    }
+
+    if (gpID3D11Device)
+    {
+        gpID3D11Device->Release();
+        gpID3D11Device = NULL;
+    }
+}
+
+BufferHandle D3D11Renderer::CreateBuffer(const BufferDesc &desc)
+{
+    static const UINT bindFlags[] = {D3D11_BIND_VERTEX_BUFFER, D3D11_BIND_INDEX_BUFFER, D3D11_BIND_CONSTANT_BUFFER};
+    static const char *bufferNames[] = {"Vertex Buffer", "Index Buffer", "Constant Buffer"};
+
+    D3D11_BUFFER_DESC bufferDesc;
+    ZeroMemory(&bufferDesc, sizeof(D3D11_BUFFER_DESC));
+    bufferDesc.Usage = D3D11_USAGE_DEFAULT;
+    bufferDesc.ByteWidth = desc.byteWidth;
+    bufferDesc.BindFlags = bindFlags[desc.type];
+
+    D3D11_SUBRESOURCE_DATA d3d11SubresourceData;
+    ZeroMemory((void *)&d3d11SubresourceData, sizeof(D3D11_SUBRESOURCE_DATA));
+    d3d11SubresourceData.pSysMem = desc.pInitialData;
+
+    ID3D11Buffer *pBuffer = NULL;
+    HRESULT hr = gpID3D11Device->CreateBuffer(&bufferDesc, desc.pInitialData ? &d3d11SubresourceData : NULL, &pBuffer);
+    if (FAILED(hr))
+    {
+        LogError("CreateBuffer Failed for %s\n", bufferNames[desc.type]);
+        return 0;
+    }
+    Log("CreateBuffer Successful for %s\n", bufferNames[desc.type]);
+
+    buffers.push_back(pBuffer);
+    return (BufferHandle)buffers.size();
+}
+
+void D3D11Renderer::UpdateBuffer(BufferHandle buffer, const void *pData)
+{
+    ID3D11Buffer *pBuffer = getBuffer(buffer);
+    if (pBuffer == NULL)
+        return;
+    gpID3D11DeviceContext->UpdateSubresource(pBuffer, 0, NULL, pData, 0, 0);
+
+    D3D11_BUFFER_DESC bufferDesc;
+    pBuffer->GetDesc(&bufferDesc);
+    if (bufferDesc.BindFlags & D3D11_BIND_CONSTANT_BUFFER)
+    {
+        frameStatistics.constantBytesUploaded += bufferDesc.ByteWidth;
+        frameStatistics.constantUploads++;
+    }
+    else
+        frameStatistics.bufferBytesUploaded += bufferDesc.ByteWidth;
+}
+
+bool D3D11Renderer::UploadConstants(const void *pData, unsigned int size, ConstantAllocation &allocation)
+{
+    bool bWrapped = false;
+    if (!constantRing.Upload(pData, size, allocation, bWrapped))
+    {
+        LogError("UploadConstants Failed : %u bytes do not fit the constant ring\n", size);
+        return false;
+    }
+    frameStatistics.constantBytesUploaded += size;
+    frameStatistics.constantUploads++;
+
+    // without offset binding the ring stays on the CPU, SetConstants copies from it
+    if (!bConstantBufferOffsetting)
+        return true;
+
+    // NO_OVERWRITE leaves ranges the GPU may still read alone, a wrap discards
+    // the buffer and rewrites the new generation, including the moved bound ranges
+    D3D11_MAPPED_SUBRESOURCE mappedSubresource;
+    HRESULT hr = gpID3D11DeviceContext->Map(gpConstantRingBuffer, 0,
+                                            bWrapped ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE,
+                                            0, &mappedSubresource);
+    if (FAILED(hr))
+    {
+        LogError("Map Failed for Constant Ring\n");
+        return false;
+    }
+    unsigned int first = bWrapped ? 0 : allocation.offset;
+    unsigned int count = bWrapped ? constantRing.GetHead() : allocation.size;
+    ConstantAllocation range = {first, count, allocation.generation};
+    memcpy((unsigned char *)mappedSubresource.pData + first, constantRing.GetData(range), count);
+    gpID3D11DeviceContext->Unmap(gpConstantRingBuffer, 0);
+
+    if (bWrapped)
+    {
+        for (unsigned int slot = 0; slot < CONSTANT_RING_SLOTS; slot++)
+        {
+            const ConstantAllocation *pBound = constantRing.GetBound(slot);
+            if (pBound)
+                bindConstantRange(slot, *pBound);
+        }
+    }
+    return true;
+}
+
+bool D3D11Renderer::IsConstantAllocationValid(const ConstantAllocation &allocation) const
+{
+    return constantRing.IsValid(allocation);
+}
+
+ShaderHandle D3D11Renderer::CreateShader(const ShaderDesc &desc)
+{
+    HRESULT hr = S_OK;
+    Shader shader;
+    ZeroMemory((void *)&shader, sizeof(Shader));
+
+    // Vertex Shader, from the shader cache or compiled and added to it
+    ShaderCompileDesc compileDesc;
+    ZeroMemory((void *)&compileDesc, sizeof(ShaderCompileDesc));
+    compileDesc.filePath = desc.vertexShaderFile;
+    compileDesc.pDefines = desc.pDefines;
+    compileDesc.numDefines = desc.numDefines;
+    compileDesc.entryPoint = "main";
+    compileDesc.target = "vs_5_0";
+    compileDesc.flags = SHADER_CACHE_COMPILE_FLAGS;
+
+    vector<unsigned char> vertexShaderCode;
+    if (!ShaderCacheCompile(compileDesc, vertexShaderCode))
+        return 0;
+
+    // create the vertex shader from above code
+    hr = gpID3D11Device->CreateVertexShader(vertexShaderCode.data(),
+                                            vertexShaderCode.size(),
+                                            NULL,
+                                            &shader.pVertexShader);
+    if (FAILED(hr))
+    {
+        LogError("CreateVertexShader Failed\n");
+        return 0;
+    }
+    Log("CreateVertexShader Successful\n");
+
+    // Pixel Shader
+    compileDesc.filePath = desc.pixelShaderFile;
+    compileDesc.target = "ps_5_0";
+
+    vector<unsigned char> pixelShaderCode;
+    if (!ShaderCacheCompile(compileDesc, pixelShaderCode))
+    {
+        shader.pVertexShader->Release();
+        return 0;
+    }
+
+    // create the Pixel shader from above code
+    hr = gpID3D11Device->CreatePixelShader(pixelShaderCode.data(),
+                                           pixelShaderCode.size(),
+                                           NULL,
+                                           &shader.pPixelShader);
+    if (FAILED(hr))
+    {
+        LogError("CreatePixelShader Failed\n");
+        shader.pVertexShader->Release();
+        return 0;
+    }
+    Log("CreatePixelShader Successful\n");
+
+    // initialise input element structure from the backend independent layout
+    static const DXGI_FORMAT formats[] = {DXGI_FORMAT_R32G32_FLOAT, DXGI_FORMAT_R32G32B32_FLOAT, DXGI_FORMAT_R32G32B32A32_FLOAT,
+                                          DXGI_FORMAT_R16G16B16A16_FLOAT, DXGI_FORMAT_R16G16_SNORM, DXGI_FORMAT_R16G16_UNORM};
+    vector<D3D11_INPUT_ELEMENT_DESC> d3dInputElementDesc(desc.numElements);
+    ZeroMemory((void *)d3dInputElementDesc.data(), sizeof(D3D11_INPUT_ELEMENT_DESC) * desc.numElements);
+    for (UINT i = 0; i < desc.numElements; i++)
+    {
+        d3dInputElementDesc[i].SemanticName = desc.pElements[i].semanticName;
+        d3dInputElementDesc[i].SemanticIndex = desc.pElements[i].semanticIndex;
+        d3dInputElementDesc[i].Format = formats[desc.pElements[i].format];
+        d3dInputElementDesc[i].InputSlot = desc.pElements[i].inputSlot;
+        d3dInputElementDesc[i].AlignedByteOffset = desc.pElements[i].alignedByteOffset;
+        if (desc.instanceSlotMask & (1u << desc.pElements[i].inputSlot))
+        {
+            d3dInputElementDesc[i].InputSlotClass = D3D11_INPUT_PER_INSTANCE_DATA;
+            d3dInputElementDesc[i].InstanceDataStepRate = 1;
+        }
+        else
+        {
+            d3dInputElementDesc[i].InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
+            d3dInputElementDesc[i].InstanceDataStepRate = 0;
+        }
+    }
+
+    // using above structure create input layout
+    hr = gpID3D11Device->CreateInputLayout(d3dInputElementDesc.data(),
+                                           desc.numElements,
+                                           vertexShaderCode.data(),
+                                           vertexShaderCode.size(),
+                                           &shader.pInputLayout);
+    if (FAILED(hr))
+    {
+        LogError("CreateInputLayout Failed\n");
+        shader.pPixelShader->Release();
+        shader.pVertexShader->Release();
+        return 0;
+    }
+    Log("CreateInputLayout Successful\n");
+
+    shaders.push_back(shader);
+    return (ShaderHandle)shaders.size();
+}
+
+TextureHandle D3D11Renderer::CreateTextureFromFile(const char *filePath)
+{
+    // BMP, TGA and PNG are decoded straight into upload memory, other formats go through WIC
+    ImageDecoder decoder;
+    if (decoder.Open(filePath))
+        return createTextureFromFiles(decoder, &filePath, 1, false);
+
+    wchar_t wideFilePath[MAX_PATH];
+    MultiByteToWideChar(CP_ACP, 0, filePath, -1, wideFilePath, MAX_PATH);
+
+    ID3D11ShaderResourceView *pID3D11ShaderResourceView = NULL;
+    HRESULT hr = CreateWICTextureFromFile(gpID3D11Device, gpID3D11DeviceContext, wideFilePath, NULL, &pID3D11ShaderResourceView);
+    if (FAILED(hr))
+    {
+        LogError("CreateWICTextureFromFile Failed for %s\n", filePath);
+        return 0;
+    }
+    Log("CreateWICTextureFromFile Successful for %s\n", filePath);
+
+    textures.push_back(pID3D11ShaderResourceView);
+    return (TextureHandle)textures.size();
+}
+
+TextureHandle D3D11Renderer::CreateTextureArrayFromFiles(const char *const *filePaths, unsigned int count)
+{
+    if (count == 0)
+        return 0;
+
+    ImageDecoder decoder;
+    if (!decoder.Open(filePaths[0]))
+    {
+        LogError("ImageDecoder::Open() Failed for %s\n", filePaths[0]);
+        return 0;
+    }
+    return createTextureFromFiles(decoder, filePaths, count, true);
+}
+
+// decoder is open on the first file. Every slice is decoded into a mapped
+// staging texture, already R8G8B8A8, and copied to mip 0 of a texture with the
+// full mip chain generated on the GPU, like CreateWICTextureFromFile does.
+TextureHandle D3D11Renderer::createTextureFromFiles(ImageDecoder &decoder, const char *const *filePaths, unsigned int count, bool bArray)
+{
+    int width = decoder.GetWidth();
+    int height = decoder.GetHeight();
+
+    D3D11_TEXTURE2D_DESC d3dtexture2dDesc;
+    ZeroMemory((void *)&d3dtexture2dDesc, sizeof(D3D11_TEXTURE2D_DESC));
+    d3dtexture2dDesc.Width = (UINT)width;
+    d3dtexture2dDesc.Height = (UINT)height;
+    d3dtexture2dDesc.MipLevels = 1;
+    d3dtexture2dDesc.ArraySize = count;
+    d3dtexture2dDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    d3dtexture2dDesc.SampleDesc.Count = 1;
+    d3dtexture2dDesc.SampleDesc.Quality = 0;
+    d3dtexture2dDesc.Usage = D3D11_USAGE_STAGING;
+    d3dtexture2dDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    ID3D11Texture2D *pStagingTexture = NULL;
+    HRESULT hr = gpID3D11Device->CreateTexture2D(&d3dtexture2dDesc, NULL, &pStagingTexture);
+    if (FAILED(hr))
+    {
+        LogError("CreateTexture2D Failed for Staging Texture of %s\n", filePaths[0]);
+        return 0;
+    }
+
+    d3dtexture2dDesc.MipLevels = 0;
+    d3dtexture2dDesc.Usage = D3D11_USAGE_DEFAULT;
+    d3dtexture2dDesc.CPUAccessFlags = 0;
+    d3dtexture2dDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
+    d3dtexture2dDesc.MiscFlags = D3D11_RESOURCE_MISC_GENERATE_MIPS;
+
+    ID3D11Texture2D *pTexture = NULL;
+    hr = gpID3D11Device->CreateTexture2D(&d3dtexture2dDesc, NULL, &pTexture);
+    if (FAILED(hr))
+    {
+        LogError("CreateTexture2D Failed for %s\n", filePaths[0]);
+        pStagingTexture->Release();
+        return 0;
+    }
+    pTexture->GetDesc(&d3dtexture2dDesc);
+
+    // Every slice is mapped and unmapped here, the immediate context is not
+    // thread safe, and decoded in between as one job per slice
+    std::vector<D3D11_MAPPED_SUBRESOURCE> mappedSlices(count);
+    unsigned int mappedCount = 0;
+    for (; mappedCount < count; mappedCount++)
+    {
+        hr = gpID3D11DeviceContext->Map(pStagingTexture, mappedCount, D3D11_MAP_WRITE, 0, &mappedSlices[mappedCount]);
+        if (FAILED(hr))
+        {
+            LogError("Map Failed for Staging Texture of %s\n", filePaths[mappedCount]);
+            break;
+        }
+    }
+
+    std::vector<unsigned char> sliceDecoded(count, 0);
+    if (SUCCEEDED(hr))
+    {
+        JobParallelFor(count, 1, [&](unsigned int first, unsigned int last)
+                       {
+            for (unsigned int i = first; i < last; i++)
+            {
+                ImageDecoder sliceDecoder;
+                ImageDecoder *pDecoder = &decoder;
+                if (i > 0)
+                {
+                    if (!sliceDecoder.Open(filePaths[i]))
+                    {
+                        LogError("ImageDecoder::Open() Failed for %s\n", filePaths[i]);
+                        continue;
+                    }
+                    pDecoder = &sliceDecoder;
+                }
+                if (pDecoder->GetWidth() != width || pDecoder->GetHeight() != height)
+                {
+                    LogError("CreateTextureArrayFromFiles Failed, %s is %dx%d instead of %dx%d\n",
+                             filePaths[i], pDecoder->GetWidth(), pDecoder->GetHeight(), width, height);
+                    continue;
+                }
+                if (!pDecoder->Decode((unsigned int *)mappedSlices[i].pData, mappedSlices[i].RowPitch / 4))
+                {
+                    LogError("ImageDecoder::Decode() Failed for %s\n", filePaths[i]);
+                    continue;
+                }
+                sliceDecoded[i] = 1;
+            } });
+    }
+
+    for (unsigned int i = 0; i < mappedCount; i++)
+    {
+        gpID3D11DeviceContext->Unmap(pStagingTexture, i);
+        if (SUCCEEDED(hr) && !sliceDecoded[i])
+            hr = E_FAIL;
+    }
+    if (SUCCEEDED(hr))
+    {
+        for (unsigned int i = 0; i < count; i++)
+        {
+            UINT subresource = D3D11CalcSubresource(0, i, d3dtexture2dDesc.MipLevels);
+            gpID3D11DeviceContext->CopySubresourceRegion(pTexture, subresource, 0, 0, 0, pStagingTexture, i, NULL);
+        }
+    }
+    pStagingTexture->Release();
+    if (FAILED(hr))
+    {
+        pTexture->Release();
+        return 0;
+    }
+
+    D3D11_SHADER_RESOURCE_VIEW_DESC d3dShaderResourceViewDesc;
+    ZeroMemory((void *)&d3dShaderResourceViewDesc, sizeof(D3D11_SHADER_RESOURCE_VIEW_DESC));
+    d3dShaderResourceViewDesc.Format = d3dtexture2dDesc.Format;
+    if (bArray)
+    {
+        d3dShaderResourceViewDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+        d3dShaderResourceViewDesc.Texture2DArray.MostDetailedMip = 0;
+        d3dShaderResourceViewDesc.Texture2DArray.MipLevels = (UINT)-1;
+        d3dShaderResourceViewDesc.Texture2DArray.FirstArraySlice = 0;
+        d3dShaderResourceViewDesc.Texture2DArray.ArraySize = count;
+    }
+    else
+    {
+        d3dShaderResourceViewDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+        d3dShaderResourceViewDesc.Texture2D.MostDetailedMip = 0;
+        d3dShaderResourceViewDesc.Texture2D.MipLevels = (UINT)-1;
+    }
+
+    ID3D11ShaderResourceView *pID3D11ShaderResourceView = NULL;
+    hr = gpID3D11Device->CreateShaderResourceView(pTexture, &d3dShaderResourceViewDesc, &pID3D11ShaderResourceView);
+    pTexture->Release();
+    if (FAILED(hr))
+    {
+        LogError("CreateShaderResourceView Failed for %s\n", filePaths[0]);
+        return 0;
+    }
+    gpID3D11DeviceContext->GenerateMips(pID3D11ShaderResourceView);
+    if (bArray)
+        Log("CreateTextureArrayFromFiles Successful for %u slices of %dx%d\n", count, width, height);
+    else
+        Log("CreateTextureFromFile Successful for %s (%dx%d)\n", filePaths[0], width, height);
+
+    textures.push_back(pID3D11ShaderResourceView);
+    return (TextureHandle)textures.size();
+}
+
+void D3D11Renderer::SetShader(ShaderHandle shader)
+{
+    frameStatistics.stateChanges++;
+    if (shader == 0 || shader > shaders.size())
+        return;
+
+    const Shader &selected = shaders[shader - 1];
+    stateCache.VSSetShader(selected.pVertexShader);
+    stateCache.PSSetShader(selected.pPixelShader);
+    stateCache.IASetInputLayout(selected.pInputLayout);
+}
+
+void D3D11Renderer::SetVertexBuffer(unsigned int slot, BufferHandle buffer, unsigned int stride, unsigned int offset)
+{
+    frameStatistics.stateChanges++;
+    stateCache.IASetVertexBuffer(slot, getBuffer(buffer), stride, offset);
+}
+
+void D3D11Renderer::SetIndexBuffer(BufferHandle buffer, IndexFormat format)
+{
+    frameStatistics.stateChanges++;
+    // R16 maps with 'short'
+    stateCache.IASetIndexBuffer(getBuffer(buffer), (format == INDEX_FORMAT_UINT32) ? DXGI_FORMAT_R32_UINT : DXGI_FORMAT_R16_UINT, 0);
+}
+
+void D3D11Renderer::SetConstantBuffer(unsigned int slot, BufferHandle buffer)
+{
+    frameStatistics.stateChanges++;
+    ID3D11Buffer *pBuffer = getBuffer(buffer);
+    stateCache.VSSetConstantBuffer(slot, pBuffer);
+    stateCache.PSSetConstantBuffer(slot, pBuffer);
+    constantRing.Unbind(slot);
+}
+
+void D3D11Renderer::SetConstants(unsigned int slot, const ConstantAllocation &allocation)
+{
+    frameStatistics.stateChanges++;
+    if (slot >= CONSTANT_RING_SLOTS || !constantRing.IsValid(allocation))
+        return;
+    constantRing.Bind(slot, allocation);
+    bindConstantRange(slot, allocation);
+}
+
+void D3D11Renderer::SetTexture(unsigned int slot, TextureHandle texture)
+{
+    frameStatistics.stateChanges++;
+    ID3D11ShaderResourceView *pView = (texture != 0 && texture <= textures.size()) ? textures[texture - 1] : NULL;
+    stateCache.PSSetShaderResource(slot, pView);
+}
+
+void D3D11Renderer::SetPrimitiveTopology(PrimitiveTopology topology)
+{
+    frameStatistics.stateChanges++;
+    stateCache.IASetPrimitiveTopology((topology == PRIMITIVE_TOPOLOGY_TRIANGLESTRIP) ? D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP : D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+}
+
+void D3D11Renderer::WaitForFrameSlot()
+{
+    // signaled once fewer than maxFrameLatency presented frames wait for the display
+    if (hFrameLatencyWaitableObject)
+        WaitForSingleObjectEx(hFrameLatencyWaitableObject, 1000, TRUE);
+    frameInput = ClockTicks();
+}
+
+void D3D11Renderer::Clear(const float clearColor[4])
+{
+    // flip model unbinds the back buffer on every Present
+    stateCache.OMSetRenderTarget(gpID3D11RenderTargetView, gpID3D11DepthStencilView);
+
+    // clear the rtv using clear color
+    unsigned int event = beginGpuEvent("Clear");
+    gpID3D11DeviceContext->ClearRenderTargetView(gpID3D11RenderTargetView, clearColor);
+    if (gpID3D11DepthStencilView)
+        gpID3D11DeviceContext->ClearDepthStencilView(gpID3D11DepthStencilView, D3D11_CLEAR_DEPTH, 1.0f, 0);
+    endGpuEvent(event);
+}
+
+void D3D11Renderer::Draw(unsigned int vertexCount, unsigned int startVertex)
+{
+    unsigned int event = beginGpuEvent("Draw");
+    gpID3D11DeviceContext->Draw(vertexCount, startVertex);
+    endGpuEvent(event);
+    frameStatistics.drawCalls++;
+    frameStatistics.instances++;
+}
+
+void D3D11Renderer::DrawIndexed(unsigned int indexCount, unsigned int startIndex, int baseVertex)
+{
+    unsigned int event = beginGpuEvent("Draw");
+    gpID3D11DeviceContext->DrawIndexed(indexCount, startIndex, baseVertex);
+    endGpuEvent(event);
+    frameStatistics.drawCalls++;
+    frameStatistics.instances++;
+}
+
+void D3D11Renderer::DrawIndexedInstanced(unsigned int indexCount, unsigned int instanceCount, unsigned int startIndex, int baseVertex, unsigned int startInstance)
+{
+    unsigned int event = beginGpuEvent("Draw");
+    gpID3D11DeviceContext->DrawIndexedInstanced(indexCount, instanceCount, startIndex, baseVertex, startInstance);
+    endGpuEvent(event);
+    frameStatistics.drawCalls++;
+    frameStatistics.instances += instanceCount;
+}
+
+void D3D11Renderer::Present()
+{
+    // the flip model discards the back buffer, so a capture copies it first
+    if (!captureRequest.empty())
+        copyCapture();
+
+    // do double buffering by presenting the swapchain, on the next vertical blank with vsync
+    unsigned int event = beginGpuEvent("Present");
+    gpIDXGISwapChain->Present(rendererDesc.bVsync ? 1 : 0, 0);
+    stateCache.InvalidateRenderTargets();
+    endGpuEvent(event);
+    endGpuFrame();
+
+    // write the captures whose copy is done, oldest first
+    for (unsigned int i = 0; i < CAPTURE_RING_SIZE; i++)
+    {
+        CaptureSlot &slot = captureSlots[(captureNext + i) % CAPTURE_RING_SIZE];
+        if (slot.bPending && resolveCapture(slot, false) == DXGI_ERROR_WAS_STILL_DRAWING)
+            break;
+    }
+
+    // Queue depth and input to photon latency from the frame statistics, which
+    // report the last frame that reached the screen with the QPC time of its
+    // vertical blank; windowed blt model swap chains have none
+    UINT presentCount = 0;
+    if (SUCCEEDED(gpIDXGISwapChain->GetLastPresentCount(&presentCount)))
+    {
+        const UINT history = sizeof(presentInputs) / sizeof(presentInputs[0]);
+        presentInputs[presentCount % history] = frameInput;
+
+        DXGI_FRAME_STATISTICS dxgiFrameStatistics;
+        ZeroMemory((void *)&dxgiFrameStatistics, sizeof(DXGI_FRAME_STATISTICS));
+        if (SUCCEEDED(gpIDXGISwapChain->GetFrameStatistics(&dxgiFrameStatistics)) && presentCount - dxgiFrameStatistics.PresentCount < history)
+        {
+            frameStatistics.queuedFrames = presentCount - dxgiFrameStatistics.PresentCount;
+            unsigned long long input = presentInputs[dxgiFrameStatistics.PresentCount % history];
+            unsigned long long shown = (unsigned long long)dxgiFrameStatistics.SyncQPCTime.QuadPart;
+            if (dxgiFrameStatistics.PresentCount != lastDisplayedPresentCount && shown > input)
+            {
+                frameStatistics.displayedFrames++;
+                frameStatistics.inputToPhotonMilliseconds += ClockSeconds(shown - input) * 1000.0;
+                lastDisplayedPresentCount = dxgiFrameStatistics.PresentCount;
+            }
+        }
+    }
+
+    frameStatistics.stateCallsIssued = stateCache.GetIssued();
+    frameStatistics.stateCallsFiltered = stateCache.GetFiltered();
+    stateCache.ResetCounters();
+
+    statistics = frameStatistics;
+    ZeroMemory((void *)&frameStatistics, sizeof(RendererStatistics));
+}
+
+const RendererStatistics &D3D11Renderer::GetStatistics() const
+{
+    return statistics;
+}
+
+bool D3D11Renderer::QueueCapture(const char *filePath)
+{
+    captureRequest = filePath;
+    return true;
+}
+
+bool D3D11Renderer::FlushCaptures()
+{
+    bool bWritten = true;
+    for (unsigned int i = 0; i < CAPTURE_RING_SIZE; i++)
+    {
+        CaptureSlot &slot = captureSlots[(captureNext + i) % CAPTURE_RING_SIZE];
+        if (slot.bPending && FAILED(resolveCapture(slot, true)))
+            bWritten = false;
+    }
+    return bWritten;
+}
+
+// Copy the back buffer into the next staging texture, which only waits when
+// that one's previous copy has not been written yet
+void D3D11Renderer::copyCapture()
+{
+    CaptureSlot &slot = captureSlots[captureNext];
+    if (slot.bPending)
+    {
+        frameStatistics.captureStalls++;
+        resolveCapture(slot, true);
+    }
+
+    ID3D11Texture2D *pBackBuffer = NULL;
+    HRESULT hr = gpIDXGISwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void **)&pBackBuffer);
+    if (FAILED(hr))
+    {
+        LogError("GetBuffer for Capture Failed\n");
+        captureRequest.clear();
+        return;
+    }
+
+    D3D11_TEXTURE2D_DESC d3dtexture2dDesc;
+    pBackBuffer->GetDesc(&d3dtexture2dDesc);
+    if (slot.pStaging == NULL || slot.width != d3dtexture2dDesc.Width || slot.height != d3dtexture2dDesc.Height)
+    {
+        if (slot.pStaging)
+        {
+            slot.pStaging->Release();
+            slot.pStaging = NULL;
+        }
+
+        // same size and format as the back buffer, readable by the CPU
+        d3dtexture2dDesc.MipLevels = 1;
+        d3dtexture2dDesc.ArraySize = 1;
+        d3dtexture2dDesc.SampleDesc.Count = 1;
+        d3dtexture2dDesc.SampleDesc.Quality = 0;
+        d3dtexture2dDesc.Usage = D3D11_USAGE_STAGING;
+        d3dtexture2dDesc.BindFlags = 0;
+        d3dtexture2dDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+        d3dtexture2dDesc.MiscFlags = 0;
+        hr = gpID3D11Device->CreateTexture2D(&d3dtexture2dDesc, NULL, &slot.pStaging);
+        if (FAILED(hr))
+        {
+            LogError("CreateTexture2D for Capture Failed\n");
+            pBackBuffer->Release();
+            captureRequest.clear();
+            return;
+        }
+        slot.width = d3dtexture2dDesc.Width;
+        slot.height = d3dtexture2dDesc.Height;
+    }
+
+    gpID3D11DeviceContext->CopyResource(slot.pStaging, pBackBuffer);
+    pBackBuffer->Release();
+
+    slot.filePath.swap(captureRequest);
+    captureRequest.clear();
+    slot.bPending = true;
+    captureNext = (captureNext + 1) % CAPTURE_RING_SIZE;
+}
+
+// Map the staging texture, without waiting unless bWait, and write it as BMP
+HRESULT D3D11Renderer::resolveCapture(CaptureSlot &slot, bool bWait)
+{
+    D3D11_MAPPED_SUBRESOURCE mappedSubresource;
+    HRESULT hr = gpID3D11DeviceContext->Map(slot.pStaging, 0, D3D11_MAP_READ, bWait ? 0 : D3D11_MAP_FLAG_DO_NOT_WAIT, &mappedSubresource);
+    if (hr == DXGI_ERROR_WAS_STILL_DRAWING)
+        return hr;
+
+    slot.bPending = false;
+    if (FAILED(hr))
+    {
+        LogError("Map for Capture Failed\n");
+        return hr;
+    }
+
+    // R8G8B8A8_UNORM rows are the Image pixel layout
+    bool bWritten = ImageSaveBMP(slot.filePath.c_str(), (int)slot.width, (int)slot.height,
+                                 (const unsigned int *)mappedSubresource.pData, mappedSubresource.RowPitch / 4);
+    gpID3D11DeviceContext->Unmap(slot.pStaging, 0);
+    if (!bWritten)
+    {
+        LogError("ImageSaveBMP() Failed for %s\n", slot.filePath.c_str());
+        return E_FAIL;
+    }
+    frameStatistics.capturesWritten++;
+    return S_OK;
+}
+
+// Limit the frames the CPU may queue, through the waitable object of a flip
+// model swap chain or, for the blt model, the device
+HRESULT D3D11Renderer::setupPresentQueue()
+{
+    HRESULT hr = S_OK;
+    UINT maxFrameLatency = GetPresentMaxFrameLatency(rendererDesc);
+
+    IDXGISwapChain2 *pIDXGISwapChain2 = NULL;
+    if ((swapChainFlags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT) &&
+        SUCCEEDED(gpIDXGISwapChain->QueryInterface(__uuidof(IDXGISwapChain2), (void **)&pIDXGISwapChain2)))
+    {
+        hr = pIDXGISwapChain2->SetMaximumFrameLatency(maxFrameLatency);
+        if (SUCCEEDED(hr))
+            hFrameLatencyWaitableObject = pIDXGISwapChain2->GetFrameLatencyWaitableObject();
+        pIDXGISwapChain2->Release();
+        pIDXGISwapChain2 = NULL;
+        if (FAILED(hr) || hFrameLatencyWaitableObject == NULL)
+        {
+            LogError("SetMaximumFrameLatency Failed\n");
+            return FAILED(hr) ? hr : E_FAIL;
+        }
+        Log("Flip model swap chain, %u buffers, max frame latency %u\n", bufferCount, maxFrameLatency);
+        return hr;
+    }
+
+    IDXGIDevice1 *pIDXGIDevice1 = NULL;
+    hr = gpID3D11Device->QueryInterface(__uuidof(IDXGIDevice1), (void **)&pIDXGIDevice1);
+    if (FAILED(hr))
+    {
+        LogError("QueryInterface IDXGIDevice1 Failed\n");
+        return hr;
+    }
+    hr = pIDXGIDevice1->SetMaximumFrameLatency(maxFrameLatency);
+    pIDXGIDevice1->Release();
+    pIDXGIDevice1 = NULL;
+    if (FAILED(hr))
+    {
+        LogError("SetMaximumFrameLatency Failed\n");
+        return hr;
+    }
+    Log("Blt model swap chain, %u buffers, max frame latency %u\n", bufferCount, maxFrameLatency);
+    return hr;
+}
+
+// Create the constant ring, or the per-slot buffers on drivers without 11.1 offset binding
+HRESULT D3D11Renderer::setupConstantRing()
+{
+    HRESULT hr = S_OK;
+
+    D3D11_FEATURE_DATA_D3D11_OPTIONS d3dOptions;
+    ZeroMemory((void *)&d3dOptions, sizeof(D3D11_FEATURE_DATA_D3D11_OPTIONS));
+    if (SUCCEEDED(gpID3D11DeviceContext->QueryInterface(__uuidof(ID3D11DeviceContext1), (void **)&gpID3D11DeviceContext1)) &&
+        SUCCEEDED(gpID3D11Device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &d3dOptions, sizeof(d3dOptions))))
+    {
+        bConstantBufferOffsetting = d3dOptions.ConstantBufferOffsetting && d3dOptions.MapNoOverwriteOnDynamicConstantBuffer;
+    }
+    stateCache.SetContext(gpID3D11DeviceContext, gpID3D11DeviceContext1);
+
+    D3D11_BUFFER_DESC bufferDesc;
+    ZeroMemory(&bufferDesc, sizeof(D3D11_BUFFER_DESC));
+    bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+    bufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    if (bConstantBufferOffsetting)
+    {
+        bufferDesc.ByteWidth = CONSTANT_RING_SIZE;
+        hr = gpID3D11Device->CreateBuffer(&bufferDesc, NULL, &gpConstantRingBuffer);
+        if (FAILED(hr))
+            return hr;
+        Log("Constant Ring Created with Offset Binding, %u bytes\n", CONSTANT_RING_SIZE);
+    }
+    else
+    {
+        // largest cbuffer a shader can declare
+        bufferDesc.ByteWidth = D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT * 16;
+        for (int i = 0; i < CONSTANT_RING_SLOTS; i++)
+        {
+            hr = gpID3D11Device->CreateBuffer(&bufferDesc, NULL, &gpConstantSlotBuffers[i]);
+            if (FAILED(hr))
+                return hr;
+        }
+        Log("Constant Ring Created without Offset Binding, copying per slot\n");
+    }
+
+    constantRing.Reset(CONSTANT_RING_SIZE);
+    return hr;
+}
+
+// Point slot at a ring range, or copy the range into the slot's own buffer
+void D3D11Renderer::bindConstantRange(unsigned int slot, const ConstantAllocation &allocation)
+{
+    if (bConstantBufferOffsetting)
+    {
+        // offsets and sizes are counted in 16 byte constants
+        UINT firstConstant = allocation.offset / 16;
+        UINT numConstants = allocation.size / 16;
+        stateCache.VSSetConstantBuffer1(slot, gpConstantRingBuffer, firstConstant, numConstants);
+        stateCache.PSSetConstantBuffer1(slot, gpConstantRingBuffer, firstConstant, numConstants);
+        return;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE mappedSubresource;
+    if (FAILED(gpID3D11DeviceContext->Map(gpConstantSlotBuffers[slot], 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedSubresource)))
+        return;
+    memcpy(mappedSubresource.pData, constantRing.GetData(allocation), allocation.size);
+    gpID3D11DeviceContext->Unmap(gpConstantSlotBuffers[slot], 0);
+
+    // DISCARD renames the buffer under the same binding, rebinding it is redundant
+    stateCache.VSSetConstantBuffer(slot, gpConstantSlotBuffers[slot]);
+    stateCache.PSSetConstantBuffer(slot, gpConstantSlotBuffers[slot]);
+}
+
+ID3D11Buffer *D3D11Renderer::getBuffer(BufferHandle buffer) const
+{
+    if (buffer == 0 || buffer > buffers.size())
+        return NULL;
+    return buffers[buffer - 1];
+}
+
+#if PROFILER_ENABLED
+
+// Timestamp the start of a GPU event, the first one of a frame opens its
+// disjoint query; the queries of a slot are created on first use
+unsigned int D3D11Renderer::beginGpuEvent(const char *name)
+{
+    if (!ProfilerIsEnabled() || gpID3D11DeviceContext == NULL)
+        return ~0u;
+
+    GpuTimerFrame &frame = gpuTimerFrames[gpuTimerFrame];
+    if (!bGpuTimerOpen)
+    {
+        // still in flight after PROFILER_GPU_FRAMES frames, drop it rather than stall
+        if (frame.bIssued && !resolveGpuTimerFrame(frame))
+            frame.bIssued = false;
+
+        if (frame.pDisjoint == NULL)
+        {
+            D3D11_QUERY_DESC d3dQueryDesc;
+            ZeroMemory((void *)&d3dQueryDesc, sizeof(D3D11_QUERY_DESC));
+            d3dQueryDesc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+            if (FAILED(gpID3D11Device->CreateQuery(&d3dQueryDesc, &frame.pDisjoint)))
+            {
+                LogError("CreateQuery for Timestamp Disjoint Failed\n");
+                return ~0u;
+            }
+            d3dQueryDesc.Query = D3D11_QUERY_TIMESTAMP;
+            for (unsigned int i = 0; i < PROFILER_GPU_EVENTS * 2; i++)
+            {
+                if (frame.pTimestamps[i] == NULL && FAILED(gpID3D11Device->CreateQuery(&d3dQueryDesc, &frame.pTimestamps[i])))
+                {
+                    LogError("CreateQuery for Timestamp Failed\n");
+                    frame.pDisjoint->Release();
+                    frame.pDisjoint = NULL;
+                    return ~0u;
+                }
+            }
+        }
+
+        gpID3D11DeviceContext->Begin(frame.pDisjoint);
+        frame.count = 0;
+        frame.frameIndex = ProfilerGetFrameIndex();
+        frame.anchorTicks = ClockTicks();
+        bGpuTimerOpen = true;
+    }
+
+    if (frame.count >= PROFILER_GPU_EVENTS)
+        return ~0u;
+    frame.names[frame.count] = name;
+    gpID3D11DeviceContext->End(frame.pTimestamps[frame.count * 2]);
+    return frame.count++;
+}
+
+void D3D11Renderer::endGpuEvent(unsigned int event)
+{
+    if (event != ~0u)
+        gpID3D11DeviceContext->End(gpuTimerFrames[gpuTimerFrame].pTimestamps[event * 2 + 1]);
+}
+
+// Close the frame's disjoint query, then read back the finished frames oldest first
+void D3D11Renderer::endGpuFrame()
+{
+    if (!bGpuTimerOpen)
+        return;
+
+    gpID3D11DeviceContext->End(gpuTimerFrames[gpuTimerFrame].pDisjoint);
+    gpuTimerFrames[gpuTimerFrame].bIssued = true;
+    bGpuTimerOpen = false;
+    gpuTimerFrame = (gpuTimerFrame + 1) % PROFILER_GPU_FRAMES;
+
+    for (unsigned int i = 0; i < PROFILER_GPU_FRAMES; i++)
+    {
+        GpuTimerFrame &frame = gpuTimerFrames[(gpuTimerFrame + i) % PROFILER_GPU_FRAMES];
+        if (!frame.bIssued)
+            continue;
+        if (!resolveGpuTimerFrame(frame))
+            break;
+        frame.bIssued = false;
+    }
+}
+
+// GPU timestamps count from an unknown origin, so the frame's first one is
+// placed at the CPU time it was issued and the rest follow at the disjoint
+// query's frequency; the GPU track is offset by the queue latency but its
+// durations are exact
+bool D3D11Renderer::resolveGpuTimerFrame(GpuTimerFrame &frame)
+{
+    D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData;
+    if (gpID3D11DeviceContext->GetData(frame.pDisjoint, &disjointData, sizeof(disjointData), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+        return false;
+    if (disjointData.Disjoint || disjointData.Frequency == 0)
+        return true; // the clock changed during the frame, its timestamps are useless
+
+    UINT64 timestamps[PROFILER_GPU_EVENTS * 2];
+    for (unsigned int i = 0; i < frame.count * 2; i++)
+    {
+        if (gpID3D11DeviceContext->GetData(frame.pTimestamps[i], &timestamps[i], sizeof(UINT64), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+            return true;
+    }
+
+    for (unsigned int i = 0; i < frame.count; i++)
+    {
+        UINT64 begin = timestamps[i * 2] - timestamps[0];
+        UINT64 end = timestamps[i * 2 + 1] - timestamps[0];
+        ProfilerRecordGpuEvent(frame.frameIndex, frame.names[i],
+                               frame.anchorTicks + ClockTicksFromSeconds((double)begin / disjointData.Frequency),
+                               frame.anchorTicks + ClockTicksFromSeconds((double)end / disjointData.Frequency));
+    }
+    return true;
+}
+
+void D3D11Renderer::releaseGpuTimers()
+{
+    for (unsigned int f = 0; f < PROFILER_GPU_FRAMES; f++)
+    {
+        GpuTimerFrame &frame = gpuTimerFrames[f];
+        if (frame.pDisjoint)
+        {
+            frame.pDisjoint->Release();
+            frame.pDisjoint = NULL;
+        }
+        for (unsigned int i = 0; i < PROFILER_GPU_EVENTS * 2; i++)
+        {
+            if (frame.pTimestamps[i])
+            {
+                frame.pTimestamps[i]->Release();
+                frame.pTimestamps[i] = NULL;
+            }
+        }
+        frame.bIssued = false;
+    }
+    bGpuTimerOpen = false;
+}
+
+#endif // PROFILER_ENABLED
+
+#endif // _WIN32
@@ -0,0 +1,161 @@
+#pragma once
+
+// Direct3D 11 backend, the device/swap chain/shader/buffer code that used to
+// live in every sample's D3D11App
+
+#ifdef _WIN32
+
+#include <windows.h>
+#include <d3d11_1.h>
+#include <dxgi1_3.h>
+#include <string>
+#include <vector>
+
+#include "Renderer.h"
+#include "ConstantRing.h"
+#include "D3D11StateCache.h"
+#include "ImageDecoder.h"
+#include "Profiler.h"
+
+#define PROFILER_GPU_FRAMES 4  // Frames of timestamp queries in flight before the oldest is read back
+#define PROFILER_GPU_EVENTS 64 // Timed Clear, draws and Present per frame, later ones go untimed
+
+class D3D11Renderer : public Renderer
+{
+private:
+    struct Shader
+    {
+        ID3D11VertexShader *pVertexShader;
+        ID3D11PixelShader *pPixelShader;
+        ID3D11InputLayout *pInputLayout;
+    };
+
+    HWND ghwnd;                                       // Handle to the window
+    IDXGISwapChain *gpIDXGISwapChain;                 // Swap chain interface
+    ID3D11Device *gpID3D11Device;                     // Device interface
+    ID3D11DeviceContext *gpID3D11DeviceContext;       // Device context interface
+    ID3D11RenderTargetView *gpID3D11RenderTargetView; // Render target view interface
+    ID3D11DepthStencilView *gpID3D11DepthStencilView; // Depth stencil view interface, NULL without depth buffer
+    int depthWidth;                                   // Depth buffer size, the back buffer's
+    int depthHeight;
+    ID3D11RasterizerState *gpID3D11RasterizerState;   // Rasterizer state interface
+    ID3D11SamplerState *gpID3D11SamplerState;         // Linear wrap sampler shared by all textures
+    D3D11StateCache stateCache;                       // Every binding goes through it
+    RendererDesc rendererDesc;
+
+    // Constant ring, bound by offset through the 11.1 context when the driver
+    // supports it, otherwise copied into one dynamic buffer per slot
+    ID3D11DeviceContext1 *gpID3D11DeviceContext1;
+    ID3D11Buffer *gpConstantRingBuffer;
+    ID3D11Buffer *gpConstantSlotBuffers[CONSTANT_RING_SLOTS];
+    bool bConstantBufferOffsetting;
+    ConstantRing constantRing;
+    RendererStatistics frameStatistics; // Being counted
+    RendererStatistics statistics;      // Last presented frame
+
+    // Presentation queue, flip model with a frame latency waitable object;
+    // one buffer, or a DXGI without IDXGISwapChain2, falls back to the blt model
+    unsigned int bufferCount;
+    UINT swapChainFlags;
+    HANDLE hFrameLatencyWaitableObject; // NULL for the blt model, Present() blocks instead
+    unsigned long long frameInput;      // ClockTicks() when WaitForFrameSlot() returned
+    unsigned long long presentInputs[PRESENT_MAX_BUFFERS * 2]; // frameInput by present count
+    UINT lastDisplayedPresentCount;
+
+    // QueueCapture() readback, staging textures the back buffer is copied into
+    // at Present() and mapped without waiting once the copy is done
+    struct CaptureSlot
+    {
+        ID3D11Texture2D *pStaging;
+        UINT width;
+        UINT height;
+        std::string filePath;
+        bool bPending;
+    };
+    CaptureSlot captureSlots[CAPTURE_RING_SIZE];
+    unsigned int captureNext;
+    std::string captureRequest; // Set by QueueCapture() for the frame being drawn
+
+#if PROFILER_ENABLED
+    // Profiler GPU timing, a disjoint query per frame around timestamp pairs;
+    // frames are read back without flushing once their disjoint query is done,
+    // one still in flight when its slot comes round again is dropped
+    struct GpuTimerFrame
+    {
+        ID3D11Query *pDisjoint;
+        ID3D11Query *pTimestamps[PROFILER_GPU_EVENTS * 2]; // Begin and end of every event
+        const char *names[PROFILER_GPU_EVENTS];
+        unsigned int count;
+        unsigned long long frameIndex;  // ProfilerGetFrameIndex() of the frame
+        unsigned long long anchorTicks; // ClockTicks() when its first timestamp was issued
+        bool bIssued;                   // Waiting to be read back
+    };
+    GpuTimerFrame gpuTimerFrames[PROFILER_GPU_FRAMES];
+    unsigned int gpuTimerFrame; // Being recorded
+    bool bGpuTimerOpen;         // Its disjoint query has begun
+#endif
+
+    std::vector<ID3D11Buffer *> buffers; // Handle n lives at index n - 1
+    std::vector<Shader> shaders;
+    std::vector<ID3D11ShaderResourceView *> textures;
+
+public:
+    D3D11Renderer();
+    ~D3D11Renderer();
+
+    int Initialize(void *pNativeWindow, const RendererDesc &desc);
+    int Resize(int width, int height);
+    void Cleanup();
+
+    BufferHandle CreateBuffer(const BufferDesc &desc);
+    void UpdateBuffer(BufferHandle buffer, const void *pData);
+    ShaderHandle CreateShader(const ShaderDesc &desc);
+    TextureHandle CreateTextureFromFile(const char *filePath);
+    TextureHandle CreateTextureArrayFromFiles(const char *const *filePaths, unsigned int count);
+
+    bool UploadConstants(const void *pData, unsigned int size, ConstantAllocation &allocation);
+    bool IsConstantAllocationValid(const ConstantAllocation &allocation) const;
+
+    void SetShader(ShaderHandle shader);
+    void SetVertexBuffer(unsigned int slot, BufferHandle buffer, unsigned int stride, unsigned int offset);
+    void SetIndexBuffer(BufferHandle buffer, IndexFormat format);
+    void SetConstantBuffer(unsigned int slot, BufferHandle buffer);
+    void SetConstants(unsigned int slot, const ConstantAllocation &allocation);
+    void SetTexture(unsigned int slot, TextureHandle texture);
+    void SetPrimitiveTopology(PrimitiveTopology topology);
+
+    void WaitForFrameSlot();
+    void Clear(const float clearColor[4]);
+    void Draw(unsigned int vertexCount, unsigned int startVertex);
+    void DrawIndexed(unsigned int indexCount, unsigned int startIndex, int baseVertex);
+    void DrawIndexedInstanced(unsigned int indexCount, unsigned int instanceCount, unsigned int startIndex, int baseVertex, unsigned int startInstance);
+    void Present();
+
+    const RendererStatistics &GetStatistics() const;
+    bool QueueCapture(const char *filePath);
+    bool FlushCaptures();
+
+private:
+    HRESULT setupConstantRing();
+    HRESULT setupPresentQueue();
+    void bindConstantRange(unsigned int slot, const ConstantAllocation &allocation);
+    ID3D11Buffer *getBuffer(BufferHandle buffer) const;
+    TextureHandle createTextureFromFiles(ImageDecoder &decoder, const char *const *filePaths, unsigned int count, bool bArray);
+    void copyCapture();
+    HRESULT resolveCapture(CaptureSlot &slot, bool bWait); // DXGI_ERROR_WAS_STILL_DRAWING while busy
+
+#if PROFILER_ENABLED
+    unsigned int beginGpuEvent(const char *name); // Event for endGpuEvent(), ~0u when untimed
+    void endGpuEvent(unsigned int event);
+    void endGpuFrame();
+    bool resolveGpuTimerFrame(GpuTimerFrame &frame); // False while the GPU is not done with it
+    void releaseGpuTimers();
+#else
+    unsigned int beginGpuEvent(const char *) { return 0; }
+    void endGpuEvent(unsigned int) {}
+    void endGpuFrame() {}
+    void releaseGpuTimers() {}
+#endif
+};
+
+#endif // _WIN32
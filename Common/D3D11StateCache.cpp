@@ -0,0 +1,200 @@
+#ifdef _WIN32
+
+#include <string.h>
+
+#include "D3D11StateCache.h"
+
+D3D11StateCache::D3D11StateCache() : pContext(NULL),
+                                     pContext1(NULL),
+                                     issued(0),
+                                     filtered(0)
+{
+    Invalidate();
+}
+
+void D3D11StateCache::SetContext(ID3D11DeviceContext *pContext, ID3D11DeviceContext1 *pContext1)
+{
+    this->pContext = pContext;
+    this->pContext1 = pContext1;
+    Invalidate();
+}
+
+void D3D11StateCache::Invalidate()
+{
+    memset((void *)&state, 0xFF, sizeof(State));
+}
+
+void D3D11StateCache::InvalidateRenderTargets()
+{
+    memset((void *)&state.pRenderTargetView, 0xFF, sizeof(state.pRenderTargetView));
+    memset((void *)&state.pDepthStencilView, 0xFF, sizeof(state.pDepthStencilView));
+}
+
+void D3D11StateCache::ResetCounters()
+{
+    issued = 0;
+    filtered = 0;
+}
+
+bool D3D11StateCache::isRedundant(bool bSame)
+{
+    if (bSame)
+        filtered++;
+    else
+        issued++;
+    return bSame;
+}
+
+void D3D11StateCache::VSSetShader(ID3D11VertexShader *pShader)
+{
+    if (isRedundant(state.pVertexShader == pShader))
+        return;
+    state.pVertexShader = pShader;
+    pContext->VSSetShader(pShader, NULL, 0);
+}
+
+void D3D11StateCache::PSSetShader(ID3D11PixelShader *pShader)
+{
+    if (isRedundant(state.pPixelShader == pShader))
+        return;
+    state.pPixelShader = pShader;
+    pContext->PSSetShader(pShader, NULL, 0);
+}
+
+void D3D11StateCache::IASetInputLayout(ID3D11InputLayout *pInputLayout)
+{
+    if (isRedundant(state.pInputLayout == pInputLayout))
+        return;
+    state.pInputLayout = pInputLayout;
+    pContext->IASetInputLayout(pInputLayout);
+}
+
+void D3D11StateCache::IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology)
+{
+    if (isRedundant(state.topology == topology))
+        return;
+    state.topology = topology;
+    pContext->IASetPrimitiveTopology(topology);
+}
+
+void D3D11StateCache::IASetVertexBuffer(UINT slot, ID3D11Buffer *pBuffer, UINT stride, UINT offset)
+{
+    if (slot < STATE_CACHE_VERTEX_BUFFERS)
+    {
+        VertexBufferBinding &binding = state.vertexBuffers[slot];
+        if (isRedundant(binding.pBuffer == pBuffer && binding.stride == stride && binding.offset == offset))
+            return;
+        binding.pBuffer = pBuffer;
+        binding.stride = stride;
+        binding.offset = offset;
+    }
+    else
+        issued++;
+    pContext->IASetVertexBuffers(slot, 1, &pBuffer, &stride, &offset);
+}
+
+void D3D11StateCache::IASetIndexBuffer(ID3D11Buffer *pBuffer, DXGI_FORMAT format, UINT offset)
+{
+    if (isRedundant(state.pIndexBuffer == pBuffer && state.indexFormat == format && state.indexOffset == offset))
+        return;
+    state.pIndexBuffer = pBuffer;
+    state.indexFormat = format;
+    state.indexOffset = offset;
+    pContext->IASetIndexBuffer(pBuffer, format, offset);
+}
+
+// Whole buffers and ranges share the shadow, a whole buffer is the range 0, ~0u
+bool D3D11StateCache::bindConstantBuffer(ConstantBufferBinding *pBindings, UINT slot, ID3D11Buffer *pBuffer,
+                                         UINT firstConstant, UINT numConstants)
+{
+    if (slot >= STATE_CACHE_CONSTANT_BUFFERS)
+    {
+        issued++;
+        return true;
+    }
+
+    ConstantBufferBinding &binding = pBindings[slot];
+    if (isRedundant(binding.pBuffer == pBuffer && binding.firstConstant == firstConstant && binding.numConstants == numConstants))
+        return false;
+    binding.pBuffer = pBuffer;
+    binding.firstConstant = firstConstant;
+    binding.numConstants = numConstants;
+    return true;
+}
+
+void D3D11StateCache::VSSetConstantBuffer(UINT slot, ID3D11Buffer *pBuffer)
+{
+    if (bindConstantBuffer(state.vsConstantBuffers, slot, pBuffer, 0, ~0u))
+        pContext->VSSetConstantBuffers(slot, 1, &pBuffer);
+}
+
+void D3D11StateCache::PSSetConstantBuffer(UINT slot, ID3D11Buffer *pBuffer)
+{
+    if (bindConstantBuffer(state.psConstantBuffers, slot, pBuffer, 0, ~0u))
+        pContext->PSSetConstantBuffers(slot, 1, &pBuffer);
+}
+
+void D3D11StateCache::VSSetConstantBuffer1(UINT slot, ID3D11Buffer *pBuffer, UINT firstConstant, UINT numConstants)
+{
+    if (bindConstantBuffer(state.vsConstantBuffers, slot, pBuffer, firstConstant, numConstants))
+        pContext1->VSSetConstantBuffers1(slot, 1, &pBuffer, &firstConstant, &numConstants);
+}
+
+void D3D11StateCache::PSSetConstantBuffer1(UINT slot, ID3D11Buffer *pBuffer, UINT firstConstant, UINT numConstants)
+{
+    if (bindConstantBuffer(state.psConstantBuffers, slot, pBuffer, firstConstant, numConstants))
+        pContext1->PSSetConstantBuffers1(slot, 1, &pBuffer, &firstConstant, &numConstants);
+}
+
+void D3D11StateCache::PSSetShaderResource(UINT slot, ID3D11ShaderResourceView *pView)
+{
+    if (slot < STATE_CACHE_SHADER_RESOURCES)
+    {
+        if (isRedundant(state.psShaderResources[slot] == pView))
+            return;
+        state.psShaderResources[slot] = pView;
+    }
+    else
+        issued++;
+    pContext->PSSetShaderResources(slot, 1, &pView);
+}
+
+void D3D11StateCache::PSSetSampler(UINT slot, ID3D11SamplerState *pSampler)
+{
+    if (slot < STATE_CACHE_SAMPLERS)
+    {
+        if (isRedundant(state.psSamplers[slot] == pSampler))
+            return;
+        state.psSamplers[slot] = pSampler;
+    }
+    else
+        issued++;
+    pContext->PSSetSamplers(slot, 1, &pSampler);
+}
+
+void D3D11StateCache::RSSetState(ID3D11RasterizerState *pState)
+{
+    if (isRedundant(state.pRasterizerState == pState))
+        return;
+    state.pRasterizerState = pState;
+    pContext->RSSetState(pState);
+}
+
+void D3D11StateCache::RSSetViewport(const D3D11_VIEWPORT &viewport)
+{
+    if (isRedundant(memcmp(&state.viewport, &viewport, sizeof(D3D11_VIEWPORT)) == 0))
+        return;
+    state.viewport = viewport;
+    pContext->RSSetViewports(1, &viewport);
+}
+
+void D3D11StateCache::OMSetRenderTarget(ID3D11RenderTargetView *pRenderTargetView, ID3D11DepthStencilView *pDepthStencilView)
+{
+    if (isRedundant(state.pRenderTargetView == pRenderTargetView && state.pDepthStencilView == pDepthStencilView))
+        return;
+    state.pRenderTargetView = pRenderTargetView;
+    state.pDepthStencilView = pDepthStencilView;
+    pContext->OMSetRenderTargets(1, &pRenderTargetView, pDepthStencilView);
+}
+
+#endif // _WIN32
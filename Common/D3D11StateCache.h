@@ -0,0 +1,105 @@
+#pragma once
+
+// Redundant state filter for the immediate context
+// Every binding D3D11Renderer makes goes through here. The cache shadows what
+// is bound and drops a call that would bind the same thing again, so a scene
+// can set its whole state every frame and only the changes reach the runtime.
+// Calls are single slot versions of the context methods of the same name.
+//
+// The shadow only knows what went through it: after anything that changes
+// bindings behind its back (Present() on a flip model swap chain unbinds the
+// back buffer, releasing an object whose address a new one may reuse) call
+// Invalidate() or InvalidateRenderTargets(), and the next call of each kind
+// is issued again.
+
+#ifdef _WIN32
+
+#include <windows.h>
+#include <d3d11_1.h>
+
+// Slots shadowed per kind, higher ones are always issued
+#define STATE_CACHE_VERTEX_BUFFERS 8
+#define STATE_CACHE_CONSTANT_BUFFERS D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT
+#define STATE_CACHE_SHADER_RESOURCES 16
+#define STATE_CACHE_SAMPLERS D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT
+
+class D3D11StateCache
+{
+private:
+    struct VertexBufferBinding
+    {
+        ID3D11Buffer *pBuffer;
+        UINT stride;
+        UINT offset;
+    };
+
+    // A constant buffer, or a range of one bound through the 11.1 context
+    struct ConstantBufferBinding
+    {
+        ID3D11Buffer *pBuffer;
+        UINT firstConstant; // 0 and ~0u for a whole buffer
+        UINT numConstants;
+    };
+
+    struct State
+    {
+        ID3D11VertexShader *pVertexShader;
+        ID3D11PixelShader *pPixelShader;
+        ID3D11InputLayout *pInputLayout;
+        D3D11_PRIMITIVE_TOPOLOGY topology;
+        VertexBufferBinding vertexBuffers[STATE_CACHE_VERTEX_BUFFERS];
+        ID3D11Buffer *pIndexBuffer;
+        DXGI_FORMAT indexFormat;
+        UINT indexOffset;
+        ConstantBufferBinding vsConstantBuffers[STATE_CACHE_CONSTANT_BUFFERS];
+        ConstantBufferBinding psConstantBuffers[STATE_CACHE_CONSTANT_BUFFERS];
+        ID3D11ShaderResourceView *psShaderResources[STATE_CACHE_SHADER_RESOURCES];
+        ID3D11SamplerState *psSamplers[STATE_CACHE_SAMPLERS];
+        ID3D11RasterizerState *pRasterizerState;
+        ID3D11RenderTargetView *pRenderTargetView;
+        ID3D11DepthStencilView *pDepthStencilView;
+        D3D11_VIEWPORT viewport;
+    };
+
+    ID3D11DeviceContext *pContext;
+    ID3D11DeviceContext1 *pContext1; // NULL without 11.1, the *1 calls need it
+    State state; // All 0xFF bytes when unknown, no pointer, enum or viewport matches that
+    unsigned int issued;
+    unsigned int filtered;
+
+    bool isRedundant(bool bSame); // Counts the call
+    bool bindConstantBuffer(ConstantBufferBinding *pBindings, UINT slot, ID3D11Buffer *pBuffer,
+                            UINT firstConstant, UINT numConstants); // true when the call must be issued
+
+public:
+    D3D11StateCache();
+
+    // Neither context is referenced, both must outlive the cache
+    void SetContext(ID3D11DeviceContext *pContext, ID3D11DeviceContext1 *pContext1);
+    void Invalidate();
+    void InvalidateRenderTargets(); // Just the render target and depth stencil view
+
+    void VSSetShader(ID3D11VertexShader *pShader);
+    void PSSetShader(ID3D11PixelShader *pShader);
+    void IASetInputLayout(ID3D11InputLayout *pInputLayout);
+    void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology);
+    void IASetVertexBuffer(UINT slot, ID3D11Buffer *pBuffer, UINT stride, UINT offset);
+    void IASetIndexBuffer(ID3D11Buffer *pBuffer, DXGI_FORMAT format, UINT offset);
+    void VSSetConstantBuffer(UINT slot, ID3D11Buffer *pBuffer);
+    void PSSetConstantBuffer(UINT slot, ID3D11Buffer *pBuffer);
+    void VSSetConstantBuffer1(UINT slot, ID3D11Buffer *pBuffer, UINT firstConstant, UINT numConstants);
+    void PSSetConstantBuffer1(UINT slot, ID3D11Buffer *pBuffer, UINT firstConstant, UINT numConstants);
+    void PSSetShaderResource(UINT slot, ID3D11ShaderResourceView *pView);
+    void PSSetSampler(UINT slot, ID3D11SamplerState *pSampler);
+    void RSSetState(ID3D11RasterizerState *pState);
+    void RSSetViewport(const D3D11_VIEWPORT &viewport);
+    void OMSetRenderTarget(ID3D11RenderTargetView *pRenderTargetView, ID3D11DepthStencilView *pDepthStencilView);
+
+    // Calls that reached the context and calls dropped as redundant since the
+    // last ResetCounters()
+    unsigned int GetIssued() const { return issued; }
+    unsigned int GetFiltered() const { return filtered; }
+    void ResetCounters();
+};
+
+#endif // _WIN32
@@ -0,0 +1,108 @@
+// Window event queue between the window thread and the frame loop, see EventQueue.h
+
+#include "Clock.h"
+#include "EventQueue.h"
+
+// Constructor
+EventQueue::EventQueue()
+{
+    for (unsigned long long i = 0; i < EVENT_QUEUE_SIZE; i++)
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    claimIndex.store(0, std::memory_order_relaxed);
+    readIndex = 0;
+    dropped.store(0, std::memory_order_relaxed);
+    bWaiting.store(false, std::memory_order_relaxed);
+}
+
+bool EventQueue::Push(const AppEvent &event)
+{
+    // Claim a slot, or drop the event when the frame loop is a full ring behind
+    Slot *pSlot = NULL;
+    unsigned long long index = claimIndex.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        pSlot = &slots[index & (EVENT_QUEUE_SIZE - 1)];
+        long long diff = (long long)(pSlot->sequence.load(std::memory_order_acquire) - index);
+        if (diff == 0)
+        {
+            if (claimIndex.compare_exchange_weak(index, index + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+        {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            index = claimIndex.load(std::memory_order_relaxed);
+        }
+    }
+
+    pSlot->event = event;
+    pSlot->event.ticks = ClockTicks();
+    pSlot->sequence.store(index + 1, std::memory_order_release);
+
+    // Pairs with the fence in Wait(): either the consumer sees the event before
+    // it sleeps or this sees it asleep, only then is the mutex taken
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (bWaiting.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        wake.notify_one();
+    }
+    return true;
+}
+
+bool EventQueue::isReady() const
+{
+    const Slot &slot = slots[readIndex & (EVENT_QUEUE_SIZE - 1)];
+    return slot.sequence.load(std::memory_order_acquire) == readIndex + 1;
+}
+
+// Hand the slot at readIndex back to producers for the next lap of the ring
+void EventQueue::release()
+{
+    Slot &slot = slots[readIndex & (EVENT_QUEUE_SIZE - 1)];
+    slot.sequence.store(readIndex + EVENT_QUEUE_SIZE, std::memory_order_release);
+    readIndex++;
+}
+
+bool EventQueue::Pop(AppEvent &event)
+{
+    if (!isReady())
+        return false;
+    event = slots[readIndex & (EVENT_QUEUE_SIZE - 1)].event;
+    release();
+    return true;
+}
+
+bool EventQueue::Pop(AppEvent &event, unsigned long long pushedBy)
+{
+    if (!isReady())
+        return false;
+    const AppEvent &next = slots[readIndex & (EVENT_QUEUE_SIZE - 1)].event;
+    if (next.ticks > pushedBy)
+        return false;
+    event = next;
+    release();
+    return true;
+}
+
+void EventQueue::Wait()
+{
+    bWaiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!isReady())
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        wake.wait(lock, [this]
+                  { return isReady(); });
+    }
+    bWaiting.store(false, std::memory_order_relaxed);
+}
+
+unsigned long long EventQueue::GetDroppedCount() const
+{
+    return dropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+// Window events handed from the thread that pumps window messages to the one
+// running the frame loop
+//
+// WndProc (or the synthetic source of a headless run) pushes key presses,
+// sizes and focus changes, and the frame loop pops them before every frame,
+// so a modal size loop or a slow message never holds up a frame and a long
+// frame never holds up the window. The ring is the bounded MPMC queue of
+// Log.cpp: a producer claims a slot with one compare-exchange and publishes it
+// with a release store, and when the ring is full the event is dropped and
+// counted instead of waiting. The consumer can sleep until the next push,
+// which is how the frame loop idles while the window has no focus.
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#define EVENT_QUEUE_SIZE 1024 // Power of two
+
+enum AppEventType
+{
+    APP_EVENT_KEY_DOWN, // key
+    APP_EVENT_RESIZE,   // width x height of the client area
+    APP_EVENT_FOCUS,    // bActive
+    APP_EVENT_QUIT      // The frame loop releases the renderer and returns
+};
+
+struct AppEvent
+{
+    AppEventType type;
+    unsigned int key; // Virtual key code
+    int width;
+    int height;
+    bool bActive;
+    unsigned long long ticks; // ClockTicks() of the push, set by Push()
+};
+
+class EventQueue
+{
+public:
+    EventQueue();
+
+    bool Push(const AppEvent &event); // Any thread; false when the ring was full and the event dropped
+    bool Pop(AppEvent &event);        // The consumer thread only; false when empty
+    bool Pop(AppEvent &event, unsigned long long pushedBy); // Only an event pushed by ClockTicks() pushedBy
+    void Wait();                      // The consumer thread only; sleep until something can be popped
+    unsigned long long GetDroppedCount() const;
+
+private:
+    // sequence equals the claim index while the slot is free for that
+    // producer and the claim index + 1 once the event can be popped
+    struct Slot
+    {
+        std::atomic<unsigned long long> sequence;
+        AppEvent event;
+    };
+
+    bool isReady() const;
+    void release();
+
+    Slot slots[EVENT_QUEUE_SIZE];
+    std::atomic<unsigned long long> claimIndex;
+    unsigned long long readIndex; // Consumer only
+    std::atomic<unsigned long long> dropped;
+    std::atomic<bool> bWaiting; // The consumer is in Wait(), producers notify
+    std::mutex mutex;
+    std::condition_variable wake;
+};
@@ -0,0 +1,87 @@
+#include <math.h>
+#include <string.h>
+
+#include "Clock.h"
+#include "FramePacer.h"
+
+FramePacer::FramePacer() : periodTicks(0),
+                           deadline(0),
+                           targetFrameRate(0)
+{
+    ResetStatistics();
+}
+
+FramePacer::~FramePacer()
+{
+    SetTargetFrameRate(0);
+}
+
+void FramePacer::SetTargetFrameRate(unsigned int frameRate)
+{
+    // The timer period stays raised while a cap is set
+    if (frameRate > 0 && targetFrameRate == 0)
+        ClockBeginTimerPeriod();
+    else if (frameRate == 0 && targetFrameRate > 0)
+        ClockEndTimerPeriod();
+    targetFrameRate = frameRate;
+    periodTicks = frameRate > 0 ? ClockTicksFromSeconds(1.0 / frameRate) : 0;
+    deadline = ClockTicks() + periodTicks;
+}
+
+void FramePacer::Wait()
+{
+    if (periodTicks > 0)
+    {
+        ClockSleepUntil(deadline);
+
+        // Deadlines stay on a fixed grid; a frame that overran by more than a
+        // period starts a new grid instead of rushing the following ones
+        unsigned long long now = ClockTicks();
+        deadline += periodTicks;
+        if (now > deadline)
+            deadline = now + periodTicks;
+    }
+
+    unsigned long long now = ClockTicks();
+    if (lastFrame != 0)
+    {
+        double interval = ClockSeconds(now - lastFrame) * 1000.0;
+        frames++;
+        double delta = interval - intervalMean;
+        intervalMean += delta / frames;
+        intervalM2 += delta * (interval - intervalMean);
+        if (interval > intervalMax)
+            intervalMax = interval;
+    }
+    lastFrame = now;
+}
+
+void FramePacer::Reset()
+{
+    lastFrame = 0;
+    deadline = ClockTicks() + periodTicks;
+}
+
+void FramePacer::GetStatistics(FramePacingStatistics &statistics) const
+{
+    memset(&statistics, 0, sizeof(statistics));
+    statistics.frames = frames;
+    statistics.meanMilliseconds = intervalMean;
+    statistics.jitterMilliseconds = frames > 1 ? sqrt(intervalM2 / (frames - 1)) : 0.0;
+    statistics.maxMilliseconds = intervalMax;
+
+    double wall = ClockSeconds(ClockTicks() - statisticsStart);
+    if (wall > 0.0)
+        statistics.cpuUtilization = (ClockCpuSeconds() - statisticsStartCpu) / wall;
+}
+
+void FramePacer::ResetStatistics()
+{
+    lastFrame = 0;
+    frames = 0;
+    intervalMean = 0.0;
+    intervalM2 = 0.0;
+    intervalMax = 0.0;
+    statisticsStart = ClockTicks();
+    statisticsStartCpu = ClockCpuSeconds();
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+// Frame pacing
+// Keeps the render loop from spinning a core at an uncapped frame rate. With
+// a target rate Wait() holds every frame back until its deadline on a fixed
+// grid, sleeping with ClockSleepUntil(). Vsync is a Present() flag,
+// RendererDesc::bVsync; the pacer still measures those frames.
+//
+// Frame time jitter is the standard deviation of the interval between Wait()
+// returns, CPU utilization the process CPU time over wall time, so 1.0 is one
+// busy core.
+
+struct FramePacingStatistics
+{
+    unsigned int frames;
+    double meanMilliseconds;
+    double jitterMilliseconds; // Standard deviation of the frame interval
+    double maxMilliseconds;
+    double cpuUtilization;     // Cores kept busy on average, all threads
+};
+
+class FramePacer
+{
+private:
+    unsigned long long periodTicks; // 0 when uncapped
+    unsigned long long deadline;
+    unsigned int targetFrameRate;
+
+    // Frame intervals since ResetStatistics(), Welford's running mean and variance
+    unsigned long long lastFrame;
+    unsigned int frames;
+    double intervalMean;
+    double intervalM2;
+    double intervalMax;
+    unsigned long long statisticsStart;
+    double statisticsStartCpu;
+
+public:
+    FramePacer();
+    ~FramePacer();
+
+    void SetTargetFrameRate(unsigned int frameRate); // 0 uncapped
+    unsigned int GetTargetFrameRate() const { return targetFrameRate; }
+
+    void Wait();  // Before every frame, returns at the frame's deadline
+    void Reset(); // After a blocking wait, so the gap is neither caught up nor measured
+
+    void GetStatistics(FramePacingStatistics &statistics) const;
+    void ResetStatistics();
+};
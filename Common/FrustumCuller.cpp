@@ -0,0 +1,255 @@
+// Frustum culling of bounding sphere and box arrays, see FrustumCuller.h
+
+#include <string.h>
+
+#include "FrustumCuller.h"
+#include "JobSystem.h"
+#include "SIMDLanes.h"
+
+static size_t paddedCount(unsigned int objectCount)
+{
+    return ((size_t)objectCount + FRUSTUM_CULLER_PADDING - 1) / FRUSTUM_CULLER_PADDING * FRUSTUM_CULLER_PADDING;
+}
+
+void BoundingSpheres::Resize(unsigned int objectCount)
+{
+    size_t padded = paddedCount(objectCount);
+    centerX.resize(padded, 0.0f);
+    centerY.resize(padded, 0.0f);
+    centerZ.resize(padded, 0.0f);
+    radius.resize(padded, 0.0f);
+    count = objectCount;
+}
+
+void BoundingBoxes::Resize(unsigned int objectCount)
+{
+    size_t padded = paddedCount(objectCount);
+    centerX.resize(padded, 0.0f);
+    centerY.resize(padded, 0.0f);
+    centerZ.resize(padded, 0.0f);
+    extentX.resize(padded, 0.0f);
+    extentY.resize(padded, 0.0f);
+    extentZ.resize(padded, 0.0f);
+    count = objectCount;
+}
+
+// Clip space is v * M, so each plane is a sum of columns of M:
+// -w <= x <= w, -w <= y <= w, 0 <= z <= w
+void ExtractFrustum(CXMMATRIX viewProjection, Frustum &frustum)
+{
+    const float(*m)[4] = viewProjection.m;
+    for (int row = 0; row < 4; row++)
+    {
+        frustum.planes[0][row] = m[row][3] + m[row][0];
+        frustum.planes[1][row] = m[row][3] - m[row][0];
+        frustum.planes[2][row] = m[row][3] + m[row][1];
+        frustum.planes[3][row] = m[row][3] - m[row][1];
+        frustum.planes[4][row] = m[row][2];
+        frustum.planes[5][row] = m[row][3] - m[row][2];
+    }
+
+    for (int i = 0; i < 6; i++)
+    {
+        float *plane = frustum.planes[i];
+        float length = sqrtf(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+        if (length > 0.0f)
+        {
+            for (int j = 0; j < 4; j++)
+                plane[j] /= length;
+        }
+    }
+}
+
+//
+// Kernels
+//
+
+// Signed distance of the points (x, y, z) from plane
+template <typename LANES>
+static typename LANES::Float planeDistance(const typename LANES::Float plane[4], typename LANES::Float x, typename LANES::Float y, typename LANES::Float z)
+{
+    typename LANES::Float distance = LANES::MulAdd(plane[0], x, plane[3]);
+    distance = LANES::MulAdd(plane[1], y, distance);
+    return LANES::MulAdd(plane[2], z, distance);
+}
+
+// Bits of the objects in [i, end) whose smallest plane distance is not negative
+template <typename LANES>
+static unsigned int insideBits(typename LANES::Float nearest, unsigned int i, unsigned int end)
+{
+    unsigned int bits = ~LANES::MaskBits(LANES::Greater(LANES::Set(0.0f), nearest)) & ((1u << LANES::Width) - 1);
+    if (end - i < LANES::Width)
+        bits &= (1u << (end - i)) - 1;
+    return bits;
+}
+
+// A sphere is outside when its center is more than its radius behind any plane
+template <typename LANES>
+static unsigned int cullSpheres(const Frustum &frustum, const BoundingSpheres &spheres, unsigned int first, unsigned int end, unsigned int *pOut)
+{
+    typedef typename LANES::Float Float;
+
+    Float planes[6][4];
+    for (int p = 0; p < 6; p++)
+    {
+        for (int j = 0; j < 4; j++)
+            planes[p][j] = LANES::Set(frustum.planes[p][j]);
+    }
+
+    unsigned int n = 0;
+    for (unsigned int i = first; i < end; i += LANES::Width)
+    {
+        Float x = LANES::Load(&spheres.centerX[i]);
+        Float y = LANES::Load(&spheres.centerY[i]);
+        Float z = LANES::Load(&spheres.centerZ[i]);
+        Float nearest = planeDistance<LANES>(planes[0], x, y, z);
+        for (int p = 1; p < 6; p++)
+            nearest = LANES::Min(nearest, planeDistance<LANES>(planes[p], x, y, z));
+        nearest = LANES::Add(nearest, LANES::Load(&spheres.radius[i]));
+        n += LANES::StoreIndices(pOut + n, i, insideBits<LANES>(nearest, i, end));
+    }
+    return n;
+}
+
+// Distance of the box corner furthest along the plane's normal
+template <typename LANES>
+static typename LANES::Float boxDistance(const typename LANES::Float plane[4], const typename LANES::Float absolutePlane[3],
+                                         typename LANES::Float x, typename LANES::Float y, typename LANES::Float z,
+                                         typename LANES::Float ex, typename LANES::Float ey, typename LANES::Float ez)
+{
+    typename LANES::Float distance = planeDistance<LANES>(plane, x, y, z);
+    distance = LANES::MulAdd(absolutePlane[0], ex, distance);
+    distance = LANES::MulAdd(absolutePlane[1], ey, distance);
+    return LANES::MulAdd(absolutePlane[2], ez, distance);
+}
+
+// A box is outside when that corner is behind any plane
+template <typename LANES>
+static unsigned int cullBoxes(const Frustum &frustum, const BoundingBoxes &boxes, unsigned int first, unsigned int end, unsigned int *pOut)
+{
+    typedef typename LANES::Float Float;
+
+    Float planes[6][4];
+    Float absolutePlanes[6][3];
+    for (int p = 0; p < 6; p++)
+    {
+        for (int j = 0; j < 4; j++)
+            planes[p][j] = LANES::Set(frustum.planes[p][j]);
+        for (int j = 0; j < 3; j++)
+            absolutePlanes[p][j] = LANES::Set(fabsf(frustum.planes[p][j]));
+    }
+
+    unsigned int n = 0;
+    for (unsigned int i = first; i < end; i += LANES::Width)
+    {
+        Float x = LANES::Load(&boxes.centerX[i]);
+        Float y = LANES::Load(&boxes.centerY[i]);
+        Float z = LANES::Load(&boxes.centerZ[i]);
+        Float ex = LANES::Load(&boxes.extentX[i]);
+        Float ey = LANES::Load(&boxes.extentY[i]);
+        Float ez = LANES::Load(&boxes.extentZ[i]);
+        Float nearest = boxDistance<LANES>(planes[0], absolutePlanes[0], x, y, z, ex, ey, ez);
+        for (int p = 1; p < 6; p++)
+            nearest = LANES::Min(nearest, boxDistance<LANES>(planes[p], absolutePlanes[p], x, y, z, ex, ey, ez));
+        n += LANES::StoreIndices(pOut + n, i, insideBits<LANES>(nearest, i, end));
+    }
+    return n;
+}
+
+//
+// FrustumCuller
+//
+
+// Constructor
+FrustumCuller::FrustumCuller() : flags(0)
+{
+}
+
+// Destructor
+FrustumCuller::~FrustumCuller()
+{
+    Cleanup();
+}
+
+bool FrustumCuller::Initialize(unsigned int cullFlags)
+{
+    flags = cullFlags;
+    return true;
+}
+
+void FrustumCuller::Cleanup()
+{
+    std::vector<unsigned int>().swap(scratch);
+    chunks.clear();
+}
+
+unsigned int FrustumCuller::CullSpheres(const Frustum &frustum, const BoundingSpheres &spheres, std::vector<unsigned int> &visible)
+{
+    bool bSIMD = (flags & FRUSTUM_CULLER_FLAG_SCALAR) == 0;
+    return gather(spheres.count, visible, [&](unsigned int first, unsigned int end, unsigned int *pOut)
+                  {
+#ifdef SIMD_LANES
+                      if (bSIMD)
+                          return cullSpheres<SIMDLanes>(frustum, spheres, first, end, pOut);
+#else
+                      (void)bSIMD;
+#endif
+                      return cullSpheres<ScalarLanes>(frustum, spheres, first, end, pOut); });
+}
+
+unsigned int FrustumCuller::CullBoxes(const Frustum &frustum, const BoundingBoxes &boxes, std::vector<unsigned int> &visible)
+{
+    bool bSIMD = (flags & FRUSTUM_CULLER_FLAG_SCALAR) == 0;
+    return gather(boxes.count, visible, [&](unsigned int first, unsigned int end, unsigned int *pOut)
+                  {
+#ifdef SIMD_LANES
+                      if (bSIMD)
+                          return cullBoxes<SIMDLanes>(frustum, boxes, first, end, pOut);
+#else
+                      (void)bSIMD;
+#endif
+                      return cullBoxes<ScalarLanes>(frustum, boxes, first, end, pOut); });
+}
+
+// Cull every chunk into scratch at the chunk's own offset, then move each
+// chunk's survivors to its place in the list; one chunk or one thread culls
+// straight into the list
+unsigned int FrustumCuller::gather(unsigned int count, std::vector<unsigned int> &visible, const std::function<unsigned int(unsigned int, unsigned int, unsigned int *)> &cull)
+{
+    size_t padded = paddedCount(count);
+    if (visible.size() < padded)
+        visible.resize(padded);
+
+    unsigned int chunkCount = (count + FRUSTUM_CULLER_CHUNK - 1) / FRUSTUM_CULLER_CHUNK;
+    if (JobsGetThreadCount() <= 1 || chunkCount <= 1)
+        return count == 0 ? 0 : cull(0, count, visible.data());
+
+    if (scratch.size() < padded)
+        scratch.resize(padded);
+    chunks.resize(chunkCount);
+    JobParallelFor(chunkCount, 1, [&](unsigned int firstChunk, unsigned int lastChunk)
+                   {
+                       for (unsigned int c = firstChunk; c < lastChunk; c++)
+                       {
+                           Chunk &chunk = chunks[c];
+                           chunk.first = c * FRUSTUM_CULLER_CHUNK;
+                           unsigned int end = count - chunk.first < FRUSTUM_CULLER_CHUNK ? count : chunk.first + FRUSTUM_CULLER_CHUNK;
+                           chunk.visible = cull(chunk.first, end, &scratch[chunk.first]);
+                       } });
+
+    unsigned int total = 0;
+    for (unsigned int c = 0; c < chunkCount; c++)
+    {
+        chunks[c].offset = total;
+        total += chunks[c].visible;
+    }
+
+    JobParallelFor(chunkCount, 1, [&](unsigned int firstChunk, unsigned int lastChunk)
+                   {
+                       for (unsigned int c = firstChunk; c < lastChunk; c++)
+                       {
+                           const Chunk &chunk = chunks[c];
+                           memcpy(&visible[chunk.offset], &scratch[chunk.first], chunk.visible * sizeof(unsigned int));
+                       } });
+    return total;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+// View frustum culling of large object arrays
+// ExtractFrustum() takes the six planes out of a view * projection matrix
+// (XMMatrixPerspectiveFovLH and friends, D3D depth 0..1). Bounding spheres
+// and boxes are kept as structure of arrays, and FrustumCuller tests them
+// several objects per iteration with the widest SIMDLanes.h type compiled in,
+// writing the indices of the visible ones, in order, to a compacted list.
+// Arrays are split in chunks of FRUSTUM_CULLER_CHUNK objects run as
+// JobSystem.h jobs; a second pass copies each chunk's visible indices to their
+// place in the list.
+//
+// The tests are conservative: an object touching the frustum, or outside it
+// but straddling two planes near a corner, counts as visible.
+
+#include <functional>
+#include <vector>
+
+#include "XMath.h"
+
+#define FRUSTUM_CULLER_PADDING 16  // Bounds arrays hold a multiple of this many objects
+#define FRUSTUM_CULLER_CHUNK 16384 // Objects per task, a multiple of FRUSTUM_CULLER_PADDING
+
+#define FRUSTUM_CULLER_FLAG_SCALAR 0x1 // Skip the SIMD path, for comparing the two
+
+// Planes are (a, b, c, d) with a x + b y + c z + d >= 0 inside and (a, b, c) unit length:
+// left, right, bottom, top, near, far
+struct Frustum
+{
+    float planes[6][4];
+};
+
+void ExtractFrustum(CXMMATRIX viewProjection, Frustum &frustum);
+
+struct BoundingSpheres
+{
+    std::vector<float> centerX;
+    std::vector<float> centerY;
+    std::vector<float> centerZ;
+    std::vector<float> radius;
+    unsigned int count;
+
+    BoundingSpheres() : count(0) {}
+    void Resize(unsigned int objectCount); // Pads the arrays to FRUSTUM_CULLER_PADDING
+};
+
+// Axis aligned, center and half size along each axis
+struct BoundingBoxes
+{
+    std::vector<float> centerX;
+    std::vector<float> centerY;
+    std::vector<float> centerZ;
+    std::vector<float> extentX;
+    std::vector<float> extentY;
+    std::vector<float> extentZ;
+    unsigned int count;
+
+    BoundingBoxes() : count(0) {}
+    void Resize(unsigned int objectCount); // Pads the arrays to FRUSTUM_CULLER_PADDING
+};
+
+class FrustumCuller
+{
+private:
+    struct Chunk
+    {
+        unsigned int first;   // Object index
+        unsigned int visible; // Indices written by the cull pass
+        unsigned int offset;  // Where they go in the list
+    };
+
+    std::vector<unsigned int> scratch; // Per chunk lists of the cull pass, at their chunk's first object
+    std::vector<Chunk> chunks;
+    unsigned int flags;
+
+    unsigned int gather(unsigned int count, std::vector<unsigned int> &visible, const std::function<unsigned int(unsigned int, unsigned int, unsigned int *)> &cull);
+
+public:
+    FrustumCuller();
+    ~FrustumCuller();
+    bool Initialize(unsigned int cullFlags); // FRUSTUM_CULLER_FLAG_*
+    void Cleanup();
+
+    // Return the number of visible objects; their indices, ascending, are the
+    // first entries of visible, which is grown to hold every object
+    unsigned int CullSpheres(const Frustum &frustum, const BoundingSpheres &spheres, std::vector<unsigned int> &visible);
+    unsigned int CullBoxes(const Frustum &frustum, const BoundingBoxes &boxes, std::vector<unsigned int> &visible);
+};
@@ -0,0 +1,67 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "Image.h"
+#include "ImageDecoder.h"
+
+bool ImageLoad(const char *filePath, Image &image)
+{
+    ImageDecoder decoder;
+    if (!decoder.Open(filePath))
+        return false;
+
+    image.width = decoder.GetWidth();
+    image.height = decoder.GetHeight();
+    image.pixels.resize((size_t)image.width * image.height);
+    return decoder.Decode(image.pixels.data(), (size_t)image.width);
+}
+
+bool ImageSaveBMP(const char *filePath, int width, int height, const unsigned int *pPixels, size_t pixelPitch)
+{
+    FILE *pFile = fopen(filePath, "wb");
+    if (pFile == NULL)
+        return false;
+
+    unsigned int imageSize = (unsigned int)(width * height * 4);
+    unsigned char header[54];
+    memset(header, 0, sizeof(header));
+
+    // BITMAPFILEHEADER
+    header[0] = 'B';
+    header[1] = 'M';
+    unsigned int fileSize = sizeof(header) + imageSize;
+    unsigned int dataOffset = sizeof(header);
+    memcpy(&header[2], &fileSize, 4);
+    memcpy(&header[10], &dataOffset, 4);
+
+    // BITMAPINFOHEADER, bottom up 32 bit BI_RGB
+    unsigned int infoSize = 40;
+    unsigned short planes = 1;
+    unsigned short bitCount = 32;
+    memcpy(&header[14], &infoSize, 4);
+    memcpy(&header[18], &width, 4);
+    memcpy(&header[22], &height, 4);
+    memcpy(&header[26], &planes, 2);
+    memcpy(&header[28], &bitCount, 2);
+    memcpy(&header[34], &imageSize, 4);
+    fwrite(header, 1, sizeof(header), pFile);
+
+    // RGBA to BGRA, last row first
+    std::vector<unsigned char> row((size_t)width * 4);
+    for (int y = height - 1; y >= 0; y--)
+    {
+        const unsigned int *pSource = &pPixels[(size_t)y * pixelPitch];
+        for (int x = 0; x < width; x++)
+        {
+            row[x * 4 + 0] = (unsigned char)(pSource[x] >> 16);
+            row[x * 4 + 1] = (unsigned char)(pSource[x] >> 8);
+            row[x * 4 + 2] = (unsigned char)(pSource[x]);
+            row[x * 4 + 3] = (unsigned char)(pSource[x] >> 24);
+        }
+        fwrite(row.data(), 1, row.size(), pFile);
+    }
+
+    bool bWritten = ferror(pFile) == 0;
+    fclose(pFile);
+    return bWritten;
+}
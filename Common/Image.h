@@ -0,0 +1,23 @@
+#pragma once
+
+// 8 bit RGBA images in memory, R in the low byte of every pixel like
+// DXGI_FORMAT_R8G8B8A8_UNORM and the software color buffer, rows top down.
+// Files are read by ImageDecoder (BMP, TGA and PNG), 32 bit BMPs written.
+
+#include <vector>
+
+struct Image
+{
+    int width;
+    int height;
+    std::vector<unsigned int> pixels;
+};
+
+bool ImageLoad(const char *filePath, Image &image);
+
+// pixelPitch is the distance between rows in pixels, a mapped texture's RowPitch / 4
+bool ImageSaveBMP(const char *filePath, int width, int height, const unsigned int *pPixels, size_t pixelPitch);
+inline bool ImageSaveBMP(const char *filePath, const Image &image)
+{
+    return ImageSaveBMP(filePath, image.width, image.height, image.pixels.data(), (size_t)image.width);
+}
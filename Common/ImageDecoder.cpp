@@ -0,0 +1,673 @@
+#include <string.h>
+
+#include "ImageDecoder.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IMAGE_DECODER_SSE2 1
+#endif
+
+// pshufb does a whole swizzle in one instruction; MSVC only defines __AVX__
+#if defined(IMAGE_DECODER_SSE2) && (defined(__SSSE3__) || defined(__AVX__))
+#include <tmmintrin.h>
+#define IMAGE_DECODER_SSSE3 1
+#endif
+
+static const unsigned char gPngSignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+static unsigned int readLE16(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static unsigned int readLE32(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+static unsigned int readBE32(const unsigned char *p)
+{
+    return ((unsigned int)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+// Row converters, each writes count RGBA pixels to pDst
+
+// B, G, R, A to R, G, B, A; pSrc may be pDst. Without bAlpha A becomes 255.
+static void convertBGRA(unsigned int *pDst, const unsigned char *pSrc, size_t count, bool bAlpha)
+{
+    size_t i = 0;
+    unsigned int alpha = bAlpha ? 0 : 0xFF000000;
+#ifdef IMAGE_DECODER_SSSE3
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    const __m128i alphaMask = _mm_set1_epi32((int)alpha);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i pixels = _mm_loadu_si128((const __m128i *)(pSrc + i * 4));
+        pixels = _mm_or_si128(_mm_shuffle_epi8(pixels, shuffle), alphaMask);
+        _mm_storeu_si128((__m128i *)(pDst + i), pixels);
+    }
+#elif defined(IMAGE_DECODER_SSE2)
+    const __m128i keepMask = _mm_set1_epi32((int)0xFF00FF00);
+    const __m128i lowMask = _mm_set1_epi32(0xFF);
+    const __m128i alphaMask = _mm_set1_epi32((int)alpha);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i pixels = _mm_loadu_si128((const __m128i *)(pSrc + i * 4));
+        __m128i red = _mm_and_si128(_mm_srli_epi32(pixels, 16), lowMask);
+        __m128i blue = _mm_slli_epi32(_mm_and_si128(pixels, lowMask), 16);
+        pixels = _mm_or_si128(_mm_or_si128(_mm_and_si128(pixels, keepMask), alphaMask), _mm_or_si128(red, blue));
+        _mm_storeu_si128((__m128i *)(pDst + i), pixels);
+    }
+#endif
+    for (; i < count; i++)
+    {
+        const unsigned char *p = pSrc + i * 4;
+        pDst[i] = (p[2] | (p[1] << 8) | (p[0] << 16) | ((unsigned int)p[3] << 24)) | alpha;
+    }
+}
+
+// Three bytes per pixel to RGBA with A 255, B, G, R like BMP and TGA with bSwapRedBlue
+static void convertRGB(unsigned int *pDst, const unsigned char *pSrc, size_t count, bool bSwapRedBlue)
+{
+    size_t i = 0;
+#ifdef IMAGE_DECODER_SSE2
+    // 16 byte loads cover 5 and a third pixels, stop while a whole load fits
+    const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+#ifdef IMAGE_DECODER_SSSE3
+    const __m128i shuffle = bSwapRedBlue ? _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1)
+                                         : _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    for (; i + 6 <= count; i += 4)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i *)(pSrc + i * 3));
+        _mm_storeu_si128((__m128i *)(pDst + i), _mm_or_si128(_mm_shuffle_epi8(bytes, shuffle), alphaMask));
+    }
+#else
+    // Pixel n starts at byte 3n: shift it down to lane 0 and gather the four lane 0s
+    const __m128i keepMask = _mm_set1_epi32(0x0000FF00);
+    const __m128i lowMask = _mm_set1_epi32(0xFF);
+    for (; i + 6 <= count; i += 4)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i *)(pSrc + i * 3));
+        __m128i pixels01 = _mm_unpacklo_epi32(bytes, _mm_srli_si128(bytes, 3));
+        __m128i pixels23 = _mm_unpacklo_epi32(_mm_srli_si128(bytes, 6), _mm_srli_si128(bytes, 9));
+        __m128i pixels = _mm_unpacklo_epi64(pixels01, pixels23);
+        if (bSwapRedBlue)
+        {
+            __m128i red = _mm_and_si128(_mm_srli_epi32(pixels, 16), lowMask);
+            __m128i blue = _mm_slli_epi32(_mm_and_si128(pixels, lowMask), 16);
+            pixels = _mm_or_si128(_mm_and_si128(pixels, keepMask), _mm_or_si128(red, blue));
+        }
+        else
+            pixels = _mm_and_si128(pixels, _mm_set1_epi32(0x00FFFFFF));
+        _mm_storeu_si128((__m128i *)(pDst + i), _mm_or_si128(pixels, alphaMask));
+    }
+#endif
+#endif
+    for (; i < count; i++)
+    {
+        const unsigned char *p = pSrc + i * 3;
+        if (bSwapRedBlue)
+            pDst[i] = p[2] | (p[1] << 8) | (p[0] << 16) | 0xFF000000;
+        else
+            pDst[i] = p[0] | (p[1] << 8) | (p[2] << 16) | 0xFF000000;
+    }
+}
+
+static void convertGray(unsigned int *pDst, const unsigned char *pSrc, size_t count)
+{
+    size_t i = 0;
+#ifdef IMAGE_DECODER_SSE2
+    // g, g and g, 255 byte pairs interleaved into g, g, g, 255
+    const __m128i opaque = _mm_set1_epi8((char)0xFF);
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i gray = _mm_loadu_si128((const __m128i *)(pSrc + i));
+        __m128i grayGray = _mm_unpacklo_epi8(gray, gray);
+        __m128i grayAlpha = _mm_unpacklo_epi8(gray, opaque);
+        _mm_storeu_si128((__m128i *)(pDst + i), _mm_unpacklo_epi16(grayGray, grayAlpha));
+        _mm_storeu_si128((__m128i *)(pDst + i + 4), _mm_unpackhi_epi16(grayGray, grayAlpha));
+        grayGray = _mm_unpackhi_epi8(gray, gray);
+        grayAlpha = _mm_unpackhi_epi8(gray, opaque);
+        _mm_storeu_si128((__m128i *)(pDst + i + 8), _mm_unpacklo_epi16(grayGray, grayAlpha));
+        _mm_storeu_si128((__m128i *)(pDst + i + 12), _mm_unpackhi_epi16(grayGray, grayAlpha));
+    }
+#endif
+    for (; i < count; i++)
+        pDst[i] = pSrc[i] * 0x010101u | 0xFF000000;
+}
+
+static void convertPalette(unsigned int *pDst, const unsigned char *pSrc, size_t count, const unsigned int *pPalette)
+{
+    for (size_t i = 0; i < count; i++)
+        pDst[i] = pPalette[pSrc[i]];
+}
+
+ImageDecoder::ImageDecoder() :
+    pFile(NULL), buffer(IMAGE_DECODER_BUFFER_SIZE), bufferPosition(0), bufferSize(0), filePosition(0),
+    format(IMAGE_FILE_FORMAT_UNKNOWN), width(0), height(0), bTopDown(false), bitCount(0), channels(0),
+    colorType(0), bAlpha(false), dataOffset(0), pInflate(NULL), chunkRemaining(0), bLastChunk(false)
+{
+    memset(palette, 0, sizeof(palette));
+}
+
+ImageDecoder::~ImageDecoder()
+{
+    Close();
+    delete pInflate;
+}
+
+void ImageDecoder::Close()
+{
+    if (pFile)
+    {
+        fclose(pFile);
+        pFile = NULL;
+    }
+}
+
+// Buffered reads; ones of a buffer or more go straight to the destination
+bool ImageDecoder::read(void *pData, size_t size)
+{
+    unsigned char *pDest = (unsigned char *)pData;
+    while (size > 0)
+    {
+        if (bufferPosition == bufferSize)
+        {
+            if (size >= buffer.size())
+            {
+                size_t count = fread(pDest, 1, size, pFile);
+                filePosition += count;
+                return count == size;
+            }
+            bufferPosition = 0;
+            bufferSize = fread(buffer.data(), 1, buffer.size(), pFile);
+            if (bufferSize == 0)
+                return false;
+        }
+
+        size_t count = bufferSize - bufferPosition;
+        if (count > size)
+            count = size;
+        memcpy(pDest, &buffer[bufferPosition], count);
+        bufferPosition += count;
+        filePosition += count;
+        pDest += count;
+        size -= count;
+    }
+    return true;
+}
+
+bool ImageDecoder::skip(size_t size)
+{
+    size_t count = bufferSize - bufferPosition;
+    if (count >= size)
+    {
+        bufferPosition += size;
+        filePosition += size;
+        return true;
+    }
+    bufferPosition = bufferSize;
+    filePosition += size;
+    return fseek(pFile, (long)(size - count), SEEK_CUR) == 0;
+}
+
+bool ImageDecoder::Open(const char *filePath)
+{
+    Close();
+    format = IMAGE_FILE_FORMAT_UNKNOWN;
+    width = 0;
+    height = 0;
+
+    pFile = fopen(filePath, "rb");
+    if (pFile == NULL)
+        return false;
+
+    // Look at the first bytes without consuming them; TGA has no signature
+    // and is the fallback when the header makes sense as one
+    bufferPosition = 0;
+    filePosition = 0;
+    bufferSize = fread(buffer.data(), 1, buffer.size(), pFile);
+
+    bool bOpened = false;
+    if (bufferSize >= 2 && buffer[0] == 'B' && buffer[1] == 'M')
+        bOpened = openBMP();
+    else if (bufferSize >= 8 && memcmp(buffer.data(), gPngSignature, 8) == 0)
+        bOpened = openPNG();
+    else if (bufferSize >= 18)
+        bOpened = openTGA();
+    if (width > IMAGE_DECODER_MAX_DIMENSION || height > IMAGE_DECODER_MAX_DIMENSION)
+        bOpened = false;
+
+    if (!bOpened)
+    {
+        Close();
+        format = IMAGE_FILE_FORMAT_UNKNOWN;
+        width = 0;
+        height = 0;
+    }
+    return bOpened;
+}
+
+bool ImageDecoder::Decode(unsigned int *pPixels, size_t pixelPitch)
+{
+    if (pFile == NULL)
+        return false;
+
+    bool bDecoded = false;
+    if (format == IMAGE_FILE_FORMAT_BMP)
+        bDecoded = decodeBMP(pPixels, pixelPitch);
+    else if (format == IMAGE_FILE_FORMAT_TGA)
+        bDecoded = decodeTGA(pPixels, pixelPitch);
+    else if (format == IMAGE_FILE_FORMAT_PNG)
+        bDecoded = decodePNG(pPixels, pixelPitch);
+    Close();
+    return bDecoded;
+}
+
+bool ImageDecoder::openBMP()
+{
+    // BITMAPFILEHEADER and the BITMAPINFOHEADER part of any later header,
+    // plus the BI_BITFIELDS masks that follow or are part of it
+    unsigned char header[66];
+    memset(header, 0, sizeof(header));
+    if (!read(header, 54))
+        return false;
+
+    dataOffset = readLE32(&header[10]);
+    unsigned int infoSize = readLE32(&header[14]);
+    width = (int)readLE32(&header[18]);
+    height = (int)readLE32(&header[22]);
+    bitCount = (int)readLE16(&header[28]);
+    unsigned int compression = readLE32(&header[30]);
+    unsigned int colorsUsed = readLE32(&header[46]);
+
+    // Negative height means the rows are stored top-down
+    bTopDown = height < 0;
+    if (bTopDown)
+        height = -height;
+    if (infoSize < 40 || width <= 0 || height <= 0)
+        return false;
+
+    if (compression == 3)
+    {
+        // Only the masks of plain B, G, R, A
+        if (bitCount != 32 || !read(&header[54], 12) ||
+            readLE32(&header[54]) != 0x00FF0000 || readLE32(&header[58]) != 0x0000FF00 || readLE32(&header[62]) != 0x000000FF)
+            return false;
+    }
+    else if (compression != 0 || (bitCount != 8 && bitCount != 24 && bitCount != 32))
+        return false;
+
+    if (bitCount == 8)
+    {
+        if (colorsUsed == 0 || colorsUsed > 256)
+            colorsUsed = 256;
+        if (!skip(14 + infoSize - filePosition))
+            return false;
+        unsigned char entries[256 * 4];
+        if (!read(entries, colorsUsed * 4))
+            return false;
+        for (unsigned int i = 0; i < colorsUsed; i++)
+            palette[i] = entries[i * 4 + 2] | (entries[i * 4 + 1] << 8) | (entries[i * 4] << 16) | 0xFF000000;
+    }
+
+    // The alpha byte of 32 bit files is taken as is, like the files ImageSaveBMP() writes
+    bAlpha = bitCount == 32;
+    format = IMAGE_FILE_FORMAT_BMP;
+    return dataOffset >= filePosition;
+}
+
+bool ImageDecoder::decodeBMP(unsigned int *pPixels, size_t pixelPitch)
+{
+    if (!skip(dataOffset - filePosition))
+        return false;
+
+    size_t rowSize = ((size_t)width * bitCount / 8 + 3) & ~(size_t)3;
+    std::vector<unsigned char> row(bitCount == 32 ? 0 : rowSize);
+    for (int y = 0; y < height; y++)
+    {
+        unsigned int *pDst = pPixels + (size_t)(bTopDown ? y : height - 1 - y) * pixelPitch;
+        if (bitCount == 32)
+        {
+            // Straight into the destination and swizzled in place
+            if (!read(pDst, rowSize))
+                return false;
+            convertBGRA(pDst, (const unsigned char *)pDst, (size_t)width, bAlpha);
+            continue;
+        }
+
+        if (!read(row.data(), rowSize))
+            return false;
+        if (bitCount == 24)
+            convertRGB(pDst, row.data(), (size_t)width, true);
+        else
+            convertPalette(pDst, row.data(), (size_t)width, palette);
+    }
+    return true;
+}
+
+bool ImageDecoder::openTGA()
+{
+    unsigned char header[18];
+    if (!read(header, sizeof(header)))
+        return false;
+
+    unsigned int idLength = header[0];
+    unsigned int colorMapType = header[1];
+    colorType = header[2];
+    unsigned int colorMapLength = readLE16(&header[5]);
+    unsigned int colorMapBits = header[7];
+    width = (int)readLE16(&header[12]);
+    height = (int)readLE16(&header[14]);
+    bitCount = header[16];
+    unsigned int descriptor = header[17];
+
+    // True color or gray, raw or RLE; a color map may be present but unused
+    bool bGray = colorType == 3 || colorType == 11;
+    bool bTrueColor = colorType == 2 || colorType == 10;
+    if ((!bGray && !bTrueColor) || colorMapType > 1 || width == 0 || height == 0 ||
+        (bGray && bitCount != 8) || (bTrueColor && bitCount != 24 && bitCount != 32) ||
+        (descriptor & 0x10) != 0) // Right to left
+        return false;
+
+    // Bit 5 is the origin, bits 0-3 the attribute (alpha) bits
+    bTopDown = (descriptor & 0x20) != 0;
+    bAlpha = bitCount == 32 && (descriptor & 0x0F) != 0;
+    format = IMAGE_FILE_FORMAT_TGA;
+    return skip(idLength + (colorMapType ? colorMapLength * ((colorMapBits + 7) / 8) : 0));
+}
+
+bool ImageDecoder::decodeTGA(unsigned int *pPixels, size_t pixelPitch)
+{
+    size_t bytesPerPixel = (size_t)bitCount / 8;
+    bool bRLE = colorType >= 9;
+    std::vector<unsigned char> row((size_t)width * bytesPerPixel);
+
+    // RLE packets may run across rows
+    unsigned int packetRemaining = 0;
+    bool bRepeat = false;
+    unsigned int repeated = 0;
+
+    for (int y = 0; y < height; y++)
+    {
+        unsigned int *pDst = pPixels + (size_t)(bTopDown ? y : height - 1 - y) * pixelPitch;
+        if (!bRLE)
+        {
+            if (bitCount == 32)
+            {
+                if (!read(pDst, row.size()))
+                    return false;
+                convertBGRA(pDst, (const unsigned char *)pDst, (size_t)width, bAlpha);
+                continue;
+            }
+            if (!read(row.data(), row.size()))
+                return false;
+            if (bitCount == 24)
+                convertRGB(pDst, row.data(), (size_t)width, true);
+            else
+                convertGray(pDst, row.data(), (size_t)width);
+            continue;
+        }
+
+        for (size_t x = 0; x < (size_t)width;)
+        {
+            if (packetRemaining == 0)
+            {
+                unsigned char packet;
+                if (!read(&packet, 1))
+                    return false;
+                packetRemaining = (packet & 0x7F) + 1u;
+                bRepeat = (packet & 0x80) != 0;
+                if (bRepeat)
+                {
+                    // Convert the one pixel once
+                    unsigned char pixel[4];
+                    if (!read(pixel, bytesPerPixel))
+                        return false;
+                    if (bitCount == 32)
+                        convertBGRA(&repeated, pixel, 1, bAlpha);
+                    else if (bitCount == 24)
+                        convertRGB(&repeated, pixel, 1, true);
+                    else
+                        convertGray(&repeated, pixel, 1);
+                }
+            }
+
+            size_t count = (size_t)width - x;
+            if (count > packetRemaining)
+                count = packetRemaining;
+            if (bRepeat)
+            {
+                for (size_t i = 0; i < count; i++)
+                    pDst[x + i] = repeated;
+            }
+            else
+            {
+                if (!read(row.data(), count * bytesPerPixel))
+                    return false;
+                if (bitCount == 32)
+                    convertBGRA(pDst + x, row.data(), count, bAlpha);
+                else if (bitCount == 24)
+                    convertRGB(pDst + x, row.data(), count, true);
+                else
+                    convertGray(pDst + x, row.data(), count);
+            }
+            x += count;
+            packetRemaining -= (unsigned int)count;
+        }
+    }
+    return true;
+}
+
+bool ImageDecoder::openPNG()
+{
+    unsigned char header[8 + 8 + 13];
+    if (!read(header, sizeof(header)) || readBE32(&header[8]) != 13 || memcmp(&header[12], "IHDR", 4) != 0)
+        return false;
+
+    width = (int)readBE32(&header[16]);
+    height = (int)readBE32(&header[20]);
+    bitCount = header[24];
+    colorType = header[25];
+    unsigned int compression = header[26];
+    unsigned int filter = header[27];
+    unsigned int interlace = header[28];
+    bTopDown = true;
+
+    switch (colorType)
+    {
+    case 0: channels = 1; break; // Gray
+    case 2: channels = 3; break; // RGB
+    case 3: channels = 1; break; // Palette
+    case 4: channels = 2; break; // Gray, alpha
+    case 6: channels = 4; break; // RGBA
+    default: return false;
+    }
+
+    // 1, 2 and 4 bit only for gray and palette, 16 bit for all but palette
+    bool bBitCount = bitCount == 8 || (bitCount == 16 && colorType != 3) ||
+                     ((bitCount == 1 || bitCount == 2 || bitCount == 4) && (colorType == 0 || colorType == 3));
+    if (width <= 0 || height <= 0 || !bBitCount || compression != 0 || filter != 0 || interlace != 0)
+        return false;
+    bAlpha = colorType == 4 || colorType == 6;
+
+    // Chunks up to the first IDAT; CRCs are not checked
+    bool bPalette = false;
+    for (unsigned int i = 0; i < 256; i++)
+        palette[i] = 0xFF000000;
+    if (!skip(4))
+        return false;
+    for (;;)
+    {
+        unsigned char chunk[8];
+        if (!read(chunk, sizeof(chunk)))
+            return false;
+        unsigned int length = readBE32(chunk);
+
+        if (memcmp(&chunk[4], "IDAT", 4) == 0)
+        {
+            chunkRemaining = length;
+            break;
+        }
+        if (memcmp(&chunk[4], "PLTE", 4) == 0 && length <= 256 * 3 && length % 3 == 0)
+        {
+            unsigned char entries[256 * 3];
+            if (!read(entries, length))
+                return false;
+            for (unsigned int i = 0; i < length / 3; i++)
+                palette[i] = entries[i * 3] | (entries[i * 3 + 1] << 8) | (entries[i * 3 + 2] << 16) | 0xFF000000;
+            bPalette = true;
+            length = 0;
+        }
+        else if (memcmp(&chunk[4], "tRNS", 4) == 0 && colorType == 3 && length <= 256)
+        {
+            unsigned char alphas[256];
+            if (!read(alphas, length))
+                return false;
+            for (unsigned int i = 0; i < length; i++)
+                palette[i] = (palette[i] & 0x00FFFFFF) | ((unsigned int)alphas[i] << 24);
+            length = 0;
+        }
+        else if (memcmp(&chunk[4], "IEND", 4) == 0)
+            return false;
+        if (!skip(length + 4))
+            return false;
+    }
+    if (colorType == 3 && !bPalette)
+        return false;
+
+    if (pInflate == NULL)
+        pInflate = new Inflate();
+    bLastChunk = false;
+    format = IMAGE_FILE_FORMAT_PNG;
+    return true;
+}
+
+// The zlib stream is split over consecutive IDAT chunks
+size_t ImageDecoder::readIDAT(void *pUser, unsigned char *pBuffer, size_t size)
+{
+    ImageDecoder *pDecoder = (ImageDecoder *)pUser;
+    while (pDecoder->chunkRemaining == 0)
+    {
+        unsigned char chunk[12]; // CRC of the last chunk, length and type of the next
+        if (pDecoder->bLastChunk || !pDecoder->read(chunk, sizeof(chunk)) || memcmp(&chunk[8], "IDAT", 4) != 0)
+        {
+            pDecoder->bLastChunk = true;
+            return 0;
+        }
+        pDecoder->chunkRemaining = readBE32(&chunk[4]);
+    }
+
+    if (size > pDecoder->chunkRemaining)
+        size = pDecoder->chunkRemaining;
+    if (!pDecoder->read(pBuffer, size))
+    {
+        pDecoder->bLastChunk = true;
+        return 0;
+    }
+    pDecoder->chunkRemaining -= (unsigned int)size;
+    return size;
+}
+
+static unsigned char paeth(int a, int b, int c)
+{
+    int p = a + b - c;
+    int pa = p > a ? p - a : a - p;
+    int pb = p > b ? p - b : b - p;
+    int pc = p > c ? p - c : c - p;
+    if (pa <= pb && pa <= pc)
+        return (unsigned char)a;
+    return (unsigned char)(pb <= pc ? b : c);
+}
+
+bool ImageDecoder::decodePNG(unsigned int *pPixels, size_t pixelPitch)
+{
+    pInflate->Reset(readIDAT, this, true);
+
+    // Filters work on whole bytes, bytesPerPixel of them back (at least one).
+    // Both rows start with that many zeros so the first pixel needs no case.
+    size_t bytesPerPixel = ((size_t)channels * bitCount + 7) / 8;
+    size_t rowBytes = ((size_t)width * channels * bitCount + 7) / 8;
+    std::vector<unsigned char> previous(bytesPerPixel + rowBytes, 0);
+    std::vector<unsigned char> current(bytesPerPixel + rowBytes, 0);
+    std::vector<unsigned char> samples(bitCount == 8 ? 0 : (size_t)width * channels);
+
+    for (int y = 0; y < height; y++)
+    {
+        unsigned char filterType;
+        if (pInflate->Read(&filterType, 1) != 1 || pInflate->Read(&current[bytesPerPixel], rowBytes) != rowBytes)
+            return false;
+
+        unsigned char *pRow = &current[bytesPerPixel];
+        const unsigned char *pUp = &previous[bytesPerPixel];
+        switch (filterType)
+        {
+        case 0:
+            break;
+        case 1: // Sub
+            for (size_t i = 0; i < rowBytes; i++)
+                pRow[i] = (unsigned char)(pRow[i] + pRow[i - bytesPerPixel]);
+            break;
+        case 2: // Up
+            for (size_t i = 0; i < rowBytes; i++)
+                pRow[i] = (unsigned char)(pRow[i] + pUp[i]);
+            break;
+        case 3: // Average
+            for (size_t i = 0; i < rowBytes; i++)
+                pRow[i] = (unsigned char)(pRow[i] + ((pRow[i - bytesPerPixel] + pUp[i]) >> 1));
+            break;
+        case 4: // Paeth
+            for (size_t i = 0; i < rowBytes; i++)
+                pRow[i] = (unsigned char)(pRow[i] + paeth(pRow[i - bytesPerPixel], pUp[i], pUp[i - bytesPerPixel]));
+            break;
+        default:
+            return false;
+        }
+
+        // Down to one byte per sample: the high byte of 16 bit ones, sub-byte
+        // ones unpacked MSB first and gray scaled up to 0..255
+        const unsigned char *pSamples = pRow;
+        if (bitCount == 16)
+        {
+            for (size_t i = 0; i < samples.size(); i++)
+                samples[i] = pRow[i * 2];
+            pSamples = samples.data();
+        }
+        else if (bitCount < 8)
+        {
+            unsigned int mask = (1u << bitCount) - 1;
+            unsigned int scale = colorType == 0 ? 255 / mask : 1;
+            for (size_t i = 0; i < samples.size(); i++)
+            {
+                size_t bit = i * bitCount;
+                unsigned int value = (pRow[bit >> 3] >> (8 - bitCount - (bit & 7))) & mask;
+                samples[i] = (unsigned char)(value * scale);
+            }
+            pSamples = samples.data();
+        }
+
+        unsigned int *pDst = pPixels + (size_t)y * pixelPitch;
+        switch (colorType)
+        {
+        case 0:
+            convertGray(pDst, pSamples, (size_t)width);
+            break;
+        case 2:
+            convertRGB(pDst, pSamples, (size_t)width, false);
+            break;
+        case 3:
+            convertPalette(pDst, pSamples, (size_t)width, palette);
+            break;
+        case 4:
+            for (size_t x = 0; x < (size_t)width; x++)
+                pDst[x] = pSamples[x * 2] * 0x010101u | ((unsigned int)pSamples[x * 2 + 1] << 24);
+            break;
+        case 6:
+            memcpy(pDst, pSamples, (size_t)width * 4);
+            break;
+        }
+
+        previous.swap(current);
+    }
+    return !pInflate->HasFailed();
+}
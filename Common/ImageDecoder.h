@@ -0,0 +1,87 @@
+#pragma once
+
+// Streaming BMP, TGA and PNG decoder
+// Open() reads just the header, Decode() then writes the image as 8 bit RGBA
+// (DXGI_FORMAT_R8G8B8A8_UNORM, R in the low byte), rows top down, straight to
+// the caller's memory: a mapped staging texture, the software renderer's
+// texels. The file is read through one 64 KB buffer and converted a row at a
+// time, so there is no whole-image intermediate copy. The BGR(A) to RGBA
+// swizzles run four pixels at a time with SSE2, or SSSE3 when it is enabled.
+//
+// Supported:
+//   BMP  8 bit palette, 24 and 32 bit, BI_RGB or BI_BITFIELDS with the usual
+//        masks, bottom up or top down
+//   TGA  types 2, 3, 10 and 11 (true color and gray, raw or RLE), 8, 24 and
+//        32 bit, either vertical origin
+//   PNG  every color type at 8 bit, gray and palette at 1, 2 and 4 bit, 16 bit
+//        reduced to 8, palette transparency; not interlaced
+// Anything else fails Open() and the caller can fall back to another loader.
+
+#include <stddef.h>
+#include <stdio.h>
+#include <vector>
+
+#include "Inflate.h"
+
+#define IMAGE_DECODER_BUFFER_SIZE 65536
+#define IMAGE_DECODER_MAX_DIMENSION 16384 // D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION, larger is a corrupt header
+
+enum ImageFileFormat
+{
+    IMAGE_FILE_FORMAT_UNKNOWN = 0,
+    IMAGE_FILE_FORMAT_BMP,
+    IMAGE_FILE_FORMAT_TGA,
+    IMAGE_FILE_FORMAT_PNG
+};
+
+class ImageDecoder
+{
+private:
+    FILE *pFile;
+    std::vector<unsigned char> buffer; // IMAGE_DECODER_BUFFER_SIZE
+    size_t bufferPosition;
+    size_t bufferSize;
+    size_t filePosition; // Of the next byte read()
+
+    ImageFileFormat format;
+    int width;
+    int height;
+    bool bTopDown;
+    int bitCount;       // Per pixel in the file, per channel for PNG
+    int channels;       // PNG
+    int colorType;      // PNG color type, TGA image type
+    bool bAlpha;        // The file's alpha is used, otherwise 255
+    size_t dataOffset;  // BMP pixel data
+    unsigned int palette[256];
+
+    // PNG IDAT chunks feeding the inflater
+    Inflate *pInflate; // Allocated on the first PNG, about 55 KB
+    unsigned int chunkRemaining;
+    bool bLastChunk;
+
+    bool read(void *pData, size_t size);
+    bool skip(size_t size);
+    bool openBMP();
+    bool openTGA();
+    bool openPNG();
+    bool decodeBMP(unsigned int *pPixels, size_t pixelPitch);
+    bool decodeTGA(unsigned int *pPixels, size_t pixelPitch);
+    bool decodePNG(unsigned int *pPixels, size_t pixelPitch);
+    static size_t readIDAT(void *pUser, unsigned char *pBuffer, size_t size);
+
+public:
+    ImageDecoder();
+    ~ImageDecoder();
+
+    // The format is found from the file's contents, not its extension
+    bool Open(const char *filePath);
+    void Close();
+
+    int GetWidth() const { return width; }
+    int GetHeight() const { return height; }
+    ImageFileFormat GetFormat() const { return format; }
+
+    // Writes GetHeight() rows of GetWidth() pixels, pixelPitch apart (a mapped
+    // texture's RowPitch / 4), and closes the file. Once per Open().
+    bool Decode(unsigned int *pPixels, size_t pixelPitch);
+};
@@ -0,0 +1,404 @@
+#include <math.h>
+#include <algorithm>
+
+#include "ImageDiff.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IMAGE_DIFF_SSE2 1
+#endif
+
+static const double gPi = 3.14159265358979323846;
+
+struct PixelDiff
+{
+    unsigned int differingPixels;
+    int maxDifference;
+    unsigned long long squaredError;
+};
+
+static void pixelDiffScalar(const unsigned int *pReference, const unsigned int *pTest, size_t count, int tolerance,
+                            PixelDiff &diff, float *pErrorMap)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        int pixelMax = 0;
+        for (int channel = 0; channel < 3; channel++)
+        {
+            int a = (pReference[i] >> (channel * 8)) & 0xFF;
+            int b = (pTest[i] >> (channel * 8)) & 0xFF;
+            int d = a > b ? a - b : b - a;
+            pixelMax = std::max(pixelMax, d);
+            diff.squaredError += (unsigned long long)(d * d);
+        }
+        if (pixelMax > tolerance)
+            diff.differingPixels++;
+        diff.maxDifference = std::max(diff.maxDifference, pixelMax);
+        if (pErrorMap)
+            pErrorMap[i] = pixelMax / 255.0f;
+    }
+}
+
+#ifdef IMAGE_DIFF_SSE2
+// Four pixels per step: the absolute difference is the OR of both saturated
+// subtractions, alpha is masked off, a pixel is over the tolerance when its
+// difference minus the tolerance is not all zero, and the squares come from
+// the differences widened to 16 bits and multiply-added into 32 bit lanes
+static void pixelDiffSSE2(const unsigned int *pReference, const unsigned int *pTest, size_t count, int tolerance,
+                          PixelDiff &diff, float *pErrorMap)
+{
+    const __m128i vRGB = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i vTolerance = _mm_set1_epi8((char)std::min(std::max(tolerance, 0), 255));
+    const __m128i vZero = _mm_setzero_si128();
+    __m128i vMax = vZero;
+
+    size_t i = 0;
+    while (i + 4 <= count)
+    {
+        // A lane gains at most 2 * 255^2 per step, flush to 64 bits before 2^31
+        size_t blockEnd = std::min(count & ~(size_t)3, i + 4 * 4096);
+        __m128i vSquares = vZero;
+        for (; i < blockEnd; i += 4)
+        {
+            __m128i a = _mm_loadu_si128((const __m128i *)(pReference + i));
+            __m128i b = _mm_loadu_si128((const __m128i *)(pTest + i));
+            __m128i d = _mm_and_si128(_mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a)), vRGB);
+            vMax = _mm_max_epu8(vMax, d);
+
+            __m128i equal = _mm_cmpeq_epi32(_mm_subs_epu8(d, vTolerance), vZero);
+            int equalMask = _mm_movemask_ps(_mm_castsi128_ps(equal));
+            diff.differingPixels += 4 - ((equalMask & 1) + ((equalMask >> 1) & 1) + ((equalMask >> 2) & 1) + ((equalMask >> 3) & 1));
+
+            __m128i low = _mm_unpacklo_epi8(d, vZero);
+            __m128i high = _mm_unpackhi_epi8(d, vZero);
+            vSquares = _mm_add_epi32(vSquares, _mm_add_epi32(_mm_madd_epi16(low, low), _mm_madd_epi16(high, high)));
+
+            if (pErrorMap)
+            {
+                // Largest channel per pixel: fold the bytes of each 32 bit lane
+                __m128i m = _mm_max_epu8(d, _mm_srli_epi32(d, 8));
+                m = _mm_max_epu8(m, _mm_srli_epi32(m, 16));
+                m = _mm_and_si128(m, _mm_set1_epi32(0xFF));
+                _mm_storeu_ps(pErrorMap + i, _mm_mul_ps(_mm_cvtepi32_ps(m), _mm_set1_ps(1.0f / 255.0f)));
+            }
+        }
+
+        unsigned int squares[4];
+        _mm_storeu_si128((__m128i *)squares, vSquares);
+        diff.squaredError += (unsigned long long)squares[0] + squares[1] + squares[2] + squares[3];
+    }
+
+    unsigned char maxBytes[16];
+    _mm_storeu_si128((__m128i *)maxBytes, vMax);
+    for (int b = 0; b < 16; b++)
+        diff.maxDifference = std::max(diff.maxDifference, (int)maxBytes[b]);
+
+    pixelDiffScalar(pReference + i, pTest + i, count - i, tolerance, diff, pErrorMap ? pErrorMap + i : NULL);
+}
+#endif
+
+// Perceptual error
+
+// D65 white of the sRGB primaries
+static const float gWhite[3] = {0.950428545f, 1.0f, 1.088900371f};
+
+static float srgbToLinear(float c)
+{
+    return c <= 0.04045f ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+}
+
+static void linearToXYZ(const float rgb[3], float xyz[3])
+{
+    xyz[0] = 0.4124564f * rgb[0] + 0.3575761f * rgb[1] + 0.1804375f * rgb[2];
+    xyz[1] = 0.2126729f * rgb[0] + 0.7151522f * rgb[1] + 0.0721750f * rgb[2];
+    xyz[2] = 0.0193339f * rgb[0] + 0.1191920f * rgb[1] + 0.9503041f * rgb[2];
+}
+
+static void xyzToLinear(const float xyz[3], float rgb[3])
+{
+    rgb[0] = 3.2404542f * xyz[0] - 1.5371385f * xyz[1] - 0.4985314f * xyz[2];
+    rgb[1] = -0.9692660f * xyz[0] + 1.8760108f * xyz[1] + 0.0415560f * xyz[2];
+    rgb[2] = 0.0556434f * xyz[0] - 0.2040259f * xyz[1] + 1.0572252f * xyz[2];
+}
+
+static float labF(float t)
+{
+    const float delta = 6.0f / 29.0f;
+    return t > delta * delta * delta ? cbrtf(t) : t / (3.0f * delta * delta) + 4.0f / 29.0f;
+}
+
+// L*a*b* with a* and b* scaled by L* / 100, the Hunt effect: colors lose
+// chroma as they get darker
+static void xyzToHuntLab(const float xyz[3], float lab[3])
+{
+    float fx = labF(xyz[0] / gWhite[0]);
+    float fy = labF(xyz[1] / gWhite[1]);
+    float fz = labF(xyz[2] / gWhite[2]);
+    lab[0] = 116.0f * fy - 16.0f;
+    lab[1] = 0.01f * lab[0] * 500.0f * (fx - fy);
+    lab[2] = 0.01f * lab[0] * 200.0f * (fy - fz);
+}
+
+static float hyab(const float a[3], const float b[3])
+{
+    float da = a[1] - b[1], db = a[2] - b[2];
+    return fabsf(a[0] - b[0]) + sqrtf(da * da + db * db);
+}
+
+// Normalized Gaussian of standard deviation sigma pixels, 3 sigma wide
+static std::vector<float> gaussianKernel(double sigma)
+{
+    int radius = std::max(1, (int)ceil(3.0 * sigma));
+    std::vector<float> kernel(2 * radius + 1);
+    double sum = 0.0;
+    for (int x = -radius; x <= radius; x++)
+        sum += kernel[x + radius] = (float)exp(-(double)(x * x) / (2.0 * sigma * sigma));
+    for (size_t i = 0; i < kernel.size(); i++)
+        kernel[i] = (float)(kernel[i] / sum);
+    return kernel;
+}
+
+// Positive and negative weights each scaled to a sum of 1, so a step of 1 and
+// a one pixel dot of 1 both give a response of 1 at most
+static void normalizeFeatureKernel(std::vector<float> &kernel)
+{
+    double positive = 0.0, negative = 0.0;
+    for (size_t i = 0; i < kernel.size(); i++)
+        (kernel[i] > 0.0f ? positive : negative) += kernel[i];
+    for (size_t i = 0; i < kernel.size(); i++)
+        kernel[i] = (float)(kernel[i] > 0.0f ? kernel[i] / positive : kernel[i] / -negative);
+}
+
+// Separable convolution of one plane, rows then columns, edges clamped
+static void convolve(const std::vector<float> &source, std::vector<float> &destination, int width, int height,
+                     const std::vector<float> &rowKernel, const std::vector<float> &columnKernel)
+{
+    std::vector<float> rows(source.size());
+    int rowRadius = (int)rowKernel.size() / 2;
+    for (int y = 0; y < height; y++)
+    {
+        const float *pSource = &source[(size_t)y * width];
+        float *pRow = &rows[(size_t)y * width];
+        for (int x = 0; x < width; x++)
+        {
+            float sum = 0.0f;
+            for (int k = -rowRadius; k <= rowRadius; k++)
+                sum += rowKernel[k + rowRadius] * pSource[std::min(std::max(x + k, 0), width - 1)];
+            pRow[x] = sum;
+        }
+    }
+
+    destination.assign(source.size(), 0.0f);
+    int columnRadius = (int)columnKernel.size() / 2;
+    for (int y = 0; y < height; y++)
+    {
+        float *pDestination = &destination[(size_t)y * width];
+        for (int k = -columnRadius; k <= columnRadius; k++)
+        {
+            // Whole rows at a time, the inner loop vectorizes
+            const float *pRow = &rows[(size_t)std::min(std::max(y + k, 0), height - 1) * width];
+            float weight = columnKernel[k + columnRadius];
+            for (int x = 0; x < width; x++)
+                pDestination[x] += weight * pRow[x];
+        }
+    }
+}
+
+struct PerceptualFilters
+{
+    std::vector<float> luminance;  // Achromatic contrast sensitivity
+    std::vector<float> redGreen;
+    std::vector<float> blueYellow[2]; // A sum of two Gaussians, mixed by blueYellowWeight
+    float blueYellowWeight;
+    std::vector<float> edge;   // First derivative of a Gaussian
+    std::vector<float> point;  // Second derivative
+    std::vector<float> smooth; // The Gaussian across the derivative
+};
+
+static void createPerceptualFilters(double pixelsPerDegree, PerceptualFilters &filters)
+{
+    // The contrast sensitivity functions are a * sqrt(pi / b) * exp(-pi^2 x^2 / b)
+    // in degrees, a Gaussian of sigma sqrt(b / 2) / pi; the blue-yellow one is
+    // the sum of two whose weights are their integrals a * sqrt(b / pi)
+    filters.luminance = gaussianKernel(sqrt(0.0047 / 2.0) / gPi * pixelsPerDegree);
+    filters.redGreen = gaussianKernel(sqrt(0.0053 / 2.0) / gPi * pixelsPerDegree);
+    filters.blueYellow[0] = gaussianKernel(sqrt(0.04 / 2.0) / gPi * pixelsPerDegree);
+    filters.blueYellow[1] = gaussianKernel(sqrt(0.025 / 2.0) / gPi * pixelsPerDegree);
+    double weight0 = 34.1 * sqrt(0.04 / gPi), weight1 = 13.5 * sqrt(0.025 / gPi);
+    filters.blueYellowWeight = (float)(weight0 / (weight0 + weight1));
+
+    // Features at the scale of half a cycle of the eye's peak sensitivity
+    double sigma = 0.5 * 0.082 * pixelsPerDegree;
+    filters.smooth = gaussianKernel(sigma);
+    int radius = (int)filters.smooth.size() / 2;
+    filters.edge.resize(filters.smooth.size());
+    filters.point.resize(filters.smooth.size());
+    for (int x = -radius; x <= radius; x++)
+    {
+        double g = exp(-(double)(x * x) / (2.0 * sigma * sigma));
+        filters.edge[x + radius] = (float)(-x * g);
+        filters.point[x + radius] = (float)((x * x / (sigma * sigma) - 1.0) * g);
+    }
+    normalizeFeatureKernel(filters.edge);
+    normalizeFeatureKernel(filters.point);
+}
+
+struct PerceptualImage
+{
+    std::vector<float> planes[3]; // Y, Cx, Cz after contrast sensitivity filtering
+    std::vector<float> edges;     // Gradient magnitude of the luminance
+    std::vector<float> points;
+};
+
+static void preparePerceptualImage(const Image &image, const PerceptualFilters &filters, PerceptualImage &result)
+{
+    size_t count = image.pixels.size();
+    std::vector<float> planes[3];
+    std::vector<float> luminance(count);
+    for (int c = 0; c < 3; c++)
+        planes[c].resize(count);
+
+    float toLinear[256];
+    for (int i = 0; i < 256; i++)
+        toLinear[i] = srgbToLinear(i / 255.0f);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        unsigned int pixel = image.pixels[i];
+        float rgb[3] = {toLinear[pixel & 0xFF], toLinear[(pixel >> 8) & 0xFF], toLinear[(pixel >> 16) & 0xFF]};
+        float xyz[3];
+        linearToXYZ(rgb, xyz);
+        float y = xyz[1] / gWhite[1];
+        planes[0][i] = 116.0f * y - 16.0f;
+        planes[1][i] = 500.0f * (xyz[0] / gWhite[0] - y);
+        planes[2][i] = 200.0f * (y - xyz[2] / gWhite[2]);
+        luminance[i] = y;
+    }
+
+    convolve(planes[0], result.planes[0], image.width, image.height, filters.luminance, filters.luminance);
+    convolve(planes[1], result.planes[1], image.width, image.height, filters.redGreen, filters.redGreen);
+    std::vector<float> blueYellow;
+    convolve(planes[2], result.planes[2], image.width, image.height, filters.blueYellow[0], filters.blueYellow[0]);
+    convolve(planes[2], blueYellow, image.width, image.height, filters.blueYellow[1], filters.blueYellow[1]);
+    for (size_t i = 0; i < count; i++)
+        result.planes[2][i] = filters.blueYellowWeight * result.planes[2][i] + (1.0f - filters.blueYellowWeight) * blueYellow[i];
+
+    std::vector<float> dx, dy;
+    convolve(luminance, dx, image.width, image.height, filters.edge, filters.smooth);
+    convolve(luminance, dy, image.width, image.height, filters.smooth, filters.edge);
+    result.edges.resize(count);
+    for (size_t i = 0; i < count; i++)
+        result.edges[i] = sqrtf(dx[i] * dx[i] + dy[i] * dy[i]);
+
+    convolve(luminance, dx, image.width, image.height, filters.point, filters.smooth);
+    convolve(luminance, dy, image.width, image.height, filters.smooth, filters.point);
+    result.points.resize(count);
+    for (size_t i = 0; i < count; i++)
+        result.points[i] = sqrtf(dx[i] * dx[i] + dy[i] * dy[i]);
+}
+
+// Filtered YCxCz back to clamped linear RGB and on to Hunt adjusted L*a*b*
+static void filteredToHuntLab(const PerceptualImage &image, size_t i, float lab[3])
+{
+    float y = (image.planes[0][i] + 16.0f) / 116.0f;
+    float xyz[3] = {gWhite[0] * (image.planes[1][i] / 500.0f + y), gWhite[1] * y, gWhite[2] * (y - image.planes[2][i] / 200.0f)};
+    float rgb[3];
+    xyzToLinear(xyz, rgb);
+    for (int c = 0; c < 3; c++)
+        rgb[c] = std::min(std::max(rgb[c], 0.0f), 1.0f);
+    linearToXYZ(rgb, xyz);
+    xyzToHuntLab(xyz, lab);
+}
+
+static void perceptualDiff(const Image &reference, const Image &test, double pixelsPerDegree,
+                           std::vector<float> &errors)
+{
+    PerceptualFilters filters;
+    createPerceptualFilters(pixelsPerDegree, filters);
+
+    PerceptualImage filteredReference, filteredTest;
+    preparePerceptualImage(reference, filters, filteredReference);
+    preparePerceptualImage(test, filters, filteredTest);
+
+    // The largest color error is between pure green and pure blue
+    const float colorExponent = 0.7f;
+    float green[3] = {0.0f, 1.0f, 0.0f}, blue[3] = {0.0f, 0.0f, 1.0f}, xyz[3], greenLab[3], blueLab[3];
+    linearToXYZ(green, xyz);
+    xyzToHuntLab(xyz, greenLab);
+    linearToXYZ(blue, xyz);
+    xyzToHuntLab(xyz, blueLab);
+    float maxColorError = powf(hyab(greenLab, blueLab), colorExponent);
+
+    // Errors up to 40% of the maximum take 95% of the range
+    const float compressionPoint = 0.4f, compressionTarget = 0.95f;
+    const float featureExponent = 0.5f;
+
+    errors.resize(reference.pixels.size());
+    for (size_t i = 0; i < errors.size(); i++)
+    {
+        float referenceLab[3], testLab[3];
+        filteredToHuntLab(filteredReference, i, referenceLab);
+        filteredToHuntLab(filteredTest, i, testLab);
+
+        float color = powf(hyab(referenceLab, testLab), colorExponent);
+        if (color < compressionPoint * maxColorError)
+            color *= compressionTarget / (compressionPoint * maxColorError);
+        else
+            color = compressionTarget + (color - compressionPoint * maxColorError) /
+                                            (maxColorError - compressionPoint * maxColorError) * (1.0f - compressionTarget);
+
+        float feature = std::max(fabsf(filteredReference.edges[i] - filteredTest.edges[i]),
+                                 fabsf(filteredReference.points[i] - filteredTest.points[i]));
+        feature = powf(feature / sqrtf(2.0f), featureExponent);
+
+        // Feature differences push the color error towards 1
+        errors[i] = powf(color, 1.0f - std::min(feature, 1.0f));
+    }
+}
+
+bool ImageDiff(const Image &reference, const Image &test, const ImageDiffOptions &options,
+               ImageDiffResult &result, std::vector<float> *pErrorMap)
+{
+    if (reference.width != test.width || reference.height != test.height ||
+        reference.pixels.size() != test.pixels.size())
+        return false;
+
+    size_t count = reference.pixels.size();
+    std::vector<float> errors;
+    bool bChannelMap = pErrorMap && !options.bPerceptual;
+    if (bChannelMap)
+        errors.resize(count);
+
+    PixelDiff diff = {0, 0, 0};
+#ifdef IMAGE_DIFF_SSE2
+    pixelDiffSSE2(reference.pixels.data(), test.pixels.data(), count, options.tolerance, diff, bChannelMap ? errors.data() : NULL);
+#else
+    pixelDiffScalar(reference.pixels.data(), test.pixels.data(), count, options.tolerance, diff, bChannelMap ? errors.data() : NULL);
+#endif
+
+    result.pixels = (unsigned int)count;
+    result.differingPixels = diff.differingPixels;
+    result.maxDifference = diff.maxDifference;
+    result.meanSquaredError = count ? (double)diff.squaredError / (3.0 * count) : 0.0;
+    result.psnr = result.meanSquaredError > 0.0 ? 10.0 * log10(255.0 * 255.0 / result.meanSquaredError) : HUGE_VAL;
+    result.perceptualMean = 0.0;
+    result.perceptualMax = 0.0;
+
+    if (options.bPerceptual && count > 0)
+    {
+        perceptualDiff(reference, test, options.pixelsPerDegree, errors);
+        double sum = 0.0;
+        float maxError = 0.0f;
+        for (size_t i = 0; i < count; i++)
+        {
+            sum += errors[i];
+            maxError = std::max(maxError, errors[i]);
+        }
+        result.perceptualMean = sum / count;
+        result.perceptualMax = maxError;
+    }
+
+    if (pErrorMap)
+        pErrorMap->swap(errors);
+    return true;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+// Image comparison for golden image tests
+// ImageDiff() compares a test image against a reference of the same size on
+// three levels:
+//   - per pixel: how many pixels have an R, G or B channel off by more than a
+//     tolerance and the largest channel difference (alpha is ignored, the
+//     backends do not agree on it)
+//   - PSNR over R, G and B
+//   - a FLIP-like perceptual error in [0, 1] per pixel: both images are
+//     filtered by contrast sensitivity in YCxCz at a viewing distance of
+//     pixelsPerDegree, compared with the Hunt adjusted HyAB color distance
+//     and weighted by the difference in edges and points of the luminance
+//     (Andersson et al., "FLIP: A Difference Evaluator for Alternating
+//     Images", 2020). Useful for changes that move every pixel a little, a
+//     lower precision normal for instance, where the count is all or nothing.
+// The first two run four pixels at a time with SSE2 when it is available.
+
+#include <vector>
+
+#include "Image.h"
+
+#define IMAGE_DIFF_PIXELS_PER_DEGREE 67.0 // 0.7 m from a 24" 4K monitor, the FLIP default
+
+struct ImageDiffOptions
+{
+    int tolerance;          // Largest channel difference still counted as equal
+    bool bPerceptual;       // Compute the FLIP-like error, about 100 times the cost of the rest
+    double pixelsPerDegree;
+
+    ImageDiffOptions() : tolerance(0), bPerceptual(true), pixelsPerDegree(IMAGE_DIFF_PIXELS_PER_DEGREE) {}
+};
+
+struct ImageDiffResult
+{
+    unsigned int pixels;
+    unsigned int differingPixels; // Over the tolerance
+    int maxDifference;            // Largest channel difference, 0..255
+    double meanSquaredError;      // Per channel, 0..65025
+    double psnr;                  // dB, infinite for identical images
+    double perceptualMean;        // Mean of the per pixel perceptual error, 0 unless bPerceptual
+    double perceptualMax;
+};
+
+// False if the sizes differ. pErrorMap, if not NULL, receives the per pixel
+// perceptual error, or with bPerceptual off the largest channel difference
+// divided by 255.
+bool ImageDiff(const Image &reference, const Image &test, const ImageDiffOptions &options,
+               ImageDiffResult &result, std::vector<float> *pErrorMap = NULL);
@@ -0,0 +1,450 @@
+#include <string.h>
+
+#include "Inflate.h"
+
+// RFC 1951 3.2.5, base and extra bits of length codes 257..285 and distance codes 0..29
+static const unsigned short gLengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                               35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const unsigned char gLengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                               3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const unsigned short gDistanceBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                                 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                                 8193, 12289, 16385, 24577};
+static const unsigned char gDistanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                                 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+// Order the code length code lengths are stored in, RFC 1951 3.2.7
+static const unsigned char gCodeLengthOrder[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+Inflate::Inflate()
+{
+    Reset(NULL, NULL, false);
+}
+
+void Inflate::Reset(InflateSource source, void *pUser, bool bZlibHeader)
+{
+    this->source = source;
+    this->pUser = pUser;
+    inputPosition = 0;
+    inputSize = 0;
+    paddedBytes = 0;
+    bitBuffer = 0;
+    bitCount = 0;
+    stage = bZlibHeader ? STAGE_ZLIB_HEADER : STAGE_BLOCK_HEADER;
+    bFinalBlock = false;
+    storedRemaining = 0;
+    matchRemaining = 0;
+    matchDistance = 0;
+    windowPosition = 0;
+}
+
+// Tops the bit buffer up to at least 57 bits, eight bytes at once while the
+// input has them. Past the end of the source it feeds zeros so lookups can
+// peek ahead; a stream that actually consumes more than a few of them is
+// truncated.
+void Inflate::refill()
+{
+    if (inputSize - inputPosition >= 8)
+    {
+        unsigned long long value;
+        memcpy(&value, &input[inputPosition], 8); // Little endian, like every target
+        bitBuffer |= value << bitCount;
+        inputPosition += (63 - bitCount) >> 3;
+        bitCount |= 56;
+        return;
+    }
+
+    while (bitCount <= 56)
+    {
+        if (inputPosition == inputSize)
+        {
+            inputPosition = 0;
+            inputSize = source ? source(pUser, input, sizeof(input)) : 0;
+            if (inputSize == 0)
+            {
+                paddedBytes++;
+                bitCount += 8;
+                continue;
+            }
+        }
+        bitBuffer |= (unsigned long long)input[inputPosition++] << bitCount;
+        bitCount += 8;
+    }
+}
+
+void Inflate::storeWindow(const unsigned char *pData, size_t size)
+{
+    unsigned int start = windowPosition & (INFLATE_WINDOW_SIZE - 1);
+    size_t first = INFLATE_WINDOW_SIZE - start;
+    if (first > size)
+        first = size;
+    memcpy(&window[start], pData, first);
+    memcpy(window, pData + first, size - first);
+    windowPosition += (unsigned int)size;
+}
+
+unsigned int Inflate::bits(unsigned int count)
+{
+    if (bitCount < count)
+        refill();
+    unsigned int value = (unsigned int)(bitBuffer & ((1ull << count) - 1));
+    bitBuffer >>= count;
+    bitCount -= count;
+    return value;
+}
+
+// Canonical Huffman tables, RFC 1951 3.2.2. Short codes go into the fast
+// table with their bits reversed since the stream is read LSB first; longer
+// ones are decoded a bit at a time from the counts.
+bool Inflate::build(Huffman &huffman, const unsigned char *lengths, unsigned int count)
+{
+    memset(huffman.counts, 0, sizeof(huffman.counts));
+    memset(huffman.fast, 0, sizeof(huffman.fast));
+    for (unsigned int i = 0; i < count; i++)
+        huffman.counts[lengths[i]]++;
+    huffman.counts[0] = 0;
+
+    // Over-subscribed sets are corrupt, incomplete ones are allowed (a single distance code)
+    int left = 1;
+    for (int length = 1; length < 16; length++)
+    {
+        left = (left << 1) - huffman.counts[length];
+        if (left < 0)
+            return false;
+    }
+
+    unsigned short offsets[16];
+    offsets[1] = 0;
+    for (int length = 1; length < 15; length++)
+        offsets[length + 1] = (unsigned short)(offsets[length] + huffman.counts[length]);
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (lengths[i] != 0)
+            huffman.symbols[offsets[lengths[i]]++] = (unsigned short)i;
+    }
+
+    unsigned int code = 0;
+    unsigned int index = 0;
+    for (unsigned int length = 1; length <= INFLATE_FAST_BITS; length++)
+    {
+        for (unsigned int i = 0; i < huffman.counts[length]; i++, code++, index++)
+        {
+            unsigned int reversed = 0;
+            for (unsigned int bit = 0; bit < length; bit++)
+                reversed |= ((code >> bit) & 1) << (length - 1 - bit);
+            unsigned short entry = (unsigned short)((huffman.symbols[index] << 4) | length);
+            for (unsigned int fill = reversed; fill < (1u << INFLATE_FAST_BITS); fill += 1u << length)
+                huffman.fast[fill] = entry;
+        }
+        code <<= 1;
+    }
+    return true;
+}
+
+// Needs 15 bits in bitBuffer. Works on the caller's copy of the bit buffer so
+// the hot loop can keep it in registers: every byte written through pOut
+// could alias a member and would force it back to memory.
+int Inflate::decodeSymbol(const Huffman &huffman, unsigned long long &bitBuffer, unsigned int &bitCount)
+{
+    unsigned short entry = huffman.fast[bitBuffer & ((1 << INFLATE_FAST_BITS) - 1)];
+    if (entry != 0)
+    {
+        unsigned int length = entry & 15;
+        bitBuffer >>= length;
+        bitCount -= length;
+        return entry >> 4;
+    }
+
+    int code = 0;
+    int first = 0;
+    int index = 0;
+    for (unsigned int length = 1; length < 16; length++)
+    {
+        code |= (int)((bitBuffer >> (length - 1)) & 1);
+        int count = huffman.counts[length];
+        if (code - first < count)
+        {
+            bitBuffer >>= length;
+            bitCount -= length;
+            return huffman.symbols[index + code - first];
+        }
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+    return -1;
+}
+
+int Inflate::decode(const Huffman &huffman)
+{
+    if (bitCount < 15)
+        refill();
+    return decodeSymbol(huffman, bitBuffer, bitCount);
+}
+
+bool Inflate::readDynamicTables()
+{
+    unsigned int literalCount = bits(5) + 257;
+    unsigned int distanceCount = bits(5) + 1;
+    unsigned int codeLengthCount = bits(4) + 4;
+    if (literalCount > 286 || distanceCount > 30)
+        return false;
+
+    unsigned char lengths[286 + 30];
+    memset(lengths, 0, 19);
+    for (unsigned int i = 0; i < codeLengthCount; i++)
+        lengths[gCodeLengthOrder[i]] = (unsigned char)bits(3);
+    if (!build(literals, lengths, 19))
+        return false;
+
+    unsigned int total = literalCount + distanceCount;
+    for (unsigned int i = 0; i < total;)
+    {
+        int symbol = decode(literals);
+        if (symbol < 0)
+            return false;
+        if (symbol < 16)
+        {
+            lengths[i++] = (unsigned char)symbol;
+            continue;
+        }
+
+        unsigned char repeated = 0;
+        unsigned int repeat;
+        if (symbol == 16)
+        {
+            if (i == 0)
+                return false;
+            repeated = lengths[i - 1];
+            repeat = 3 + bits(2);
+        }
+        else if (symbol == 17)
+            repeat = 3 + bits(3);
+        else
+            repeat = 11 + bits(7);
+        if (i + repeat > total)
+            return false;
+        while (repeat--)
+            lengths[i++] = repeated;
+    }
+
+    // A block without an end of block code could never finish
+    if (lengths[256] == 0)
+        return false;
+    return build(literals, lengths, literalCount) && build(distances, lengths + literalCount, distanceCount);
+}
+
+bool Inflate::readBlockHeader()
+{
+    bFinalBlock = bits(1) != 0;
+    unsigned int type = bits(2);
+    if (type == 0)
+    {
+        // Stored: skip to the byte boundary, then LEN and its complement
+        bits(bitCount & 7);
+        unsigned int length = bits(16);
+        unsigned int complement = bits(16);
+        if ((length ^ 0xFFFF) != complement)
+            return false;
+        storedRemaining = length;
+        stage = STAGE_STORED;
+        return true;
+    }
+    if (type == 1)
+    {
+        // Fixed codes, RFC 1951 3.2.6
+        unsigned char lengths[288];
+        memset(lengths, 8, 144);
+        memset(lengths + 144, 9, 112);
+        memset(lengths + 256, 7, 24);
+        memset(lengths + 280, 8, 8);
+        build(literals, lengths, 288);
+        memset(lengths, 5, 30);
+        build(distances, lengths, 30);
+        stage = STAGE_HUFFMAN;
+        return true;
+    }
+    if (type == 2 && readDynamicTables())
+    {
+        stage = STAGE_HUFFMAN;
+        return true;
+    }
+    return false;
+}
+
+size_t Inflate::Read(unsigned char *pOut, size_t size)
+{
+    const unsigned int windowMask = INFLATE_WINDOW_SIZE - 1;
+    size_t produced = 0;
+
+    while (produced < size)
+    {
+        // A match that did not fit into the last call
+        if (matchRemaining > 0)
+        {
+            size_t count = matchRemaining;
+            if (count > size - produced)
+                count = size - produced;
+            for (size_t i = 0; i < count; i++)
+            {
+                unsigned char value = window[(windowPosition - matchDistance) & windowMask];
+                window[windowPosition++ & windowMask] = value;
+                pOut[produced++] = value;
+            }
+            matchRemaining -= (unsigned int)count;
+            continue;
+        }
+
+        if (stage == STAGE_HUFFMAN)
+        {
+            // Symbols until the output is full or the block ends, with the bit
+            // buffer and window position in locals
+            unsigned long long buffer = bitBuffer;
+            unsigned int count = bitCount;
+            unsigned int position = windowPosition;
+            while (produced < size)
+            {
+                // One refill covers a length and a distance with their extra bits
+                if (count < 48)
+                {
+                    bitBuffer = buffer;
+                    bitCount = count;
+                    refill();
+                    buffer = bitBuffer;
+                    count = bitCount;
+                }
+                int symbol = decodeSymbol(literals, buffer, count);
+                if (symbol < 256)
+                {
+                    if (symbol < 0)
+                    {
+                        stage = STAGE_FAILED;
+                        break;
+                    }
+                    window[position++ & windowMask] = (unsigned char)symbol;
+                    pOut[produced++] = (unsigned char)symbol;
+                    continue;
+                }
+                if (symbol == 256)
+                {
+                    stage = bFinalBlock ? STAGE_DONE : STAGE_BLOCK_HEADER;
+                    break;
+                }
+
+                symbol -= 257;
+                if (symbol >= 29)
+                {
+                    stage = STAGE_FAILED;
+                    break;
+                }
+                unsigned int extra = gLengthExtra[symbol];
+                unsigned int length = gLengthBase[symbol] + (unsigned int)(buffer & ((1u << extra) - 1));
+                buffer >>= extra;
+                count -= extra;
+
+                int distanceSymbol = decodeSymbol(distances, buffer, count);
+                if (distanceSymbol < 0 || distanceSymbol >= 30)
+                {
+                    stage = STAGE_FAILED;
+                    break;
+                }
+                extra = gDistanceExtra[distanceSymbol];
+                unsigned int distance = gDistanceBase[distanceSymbol] + (unsigned int)(buffer & ((1u << extra) - 1));
+                buffer >>= extra;
+                count -= extra;
+                if (distance > position)
+                {
+                    stage = STAGE_FAILED;
+                    break;
+                }
+
+                // What does not fit is left for the next call
+                size_t copy = length;
+                if (copy > size - produced)
+                    copy = size - produced;
+                for (size_t i = 0; i < copy; i++)
+                {
+                    unsigned char value = window[(position - distance) & windowMask];
+                    window[position++ & windowMask] = value;
+                    pOut[produced++] = value;
+                }
+                matchDistance = distance;
+                matchRemaining = length - (unsigned int)copy;
+            }
+            bitBuffer = buffer;
+            bitCount = count;
+            windowPosition = position;
+            if (stage == STAGE_FAILED)
+                break;
+        }
+        else if (stage == STAGE_STORED)
+        {
+            if (storedRemaining == 0)
+            {
+                stage = bFinalBlock ? STAGE_DONE : STAGE_BLOCK_HEADER;
+                continue;
+            }
+
+            // Whole bytes still in the bit buffer, then straight from the input
+            while (bitCount >= 8 && storedRemaining > 0 && produced < size)
+            {
+                unsigned char value = (unsigned char)bits(8);
+                window[windowPosition++ & windowMask] = value;
+                pOut[produced++] = value;
+                storedRemaining--;
+            }
+            if (storedRemaining == 0 || produced == size)
+                continue;
+
+            // The bit buffer is empty but may hold a copy of the bytes ahead
+            bitBuffer = 0;
+            if (inputPosition == inputSize)
+            {
+                inputPosition = 0;
+                inputSize = source ? source(pUser, input, sizeof(input)) : 0;
+                if (inputSize == 0)
+                {
+                    stage = STAGE_FAILED;
+                    break;
+                }
+            }
+            size_t count = inputSize - inputPosition;
+            if (count > storedRemaining)
+                count = storedRemaining;
+            if (count > size - produced)
+                count = size - produced;
+            memcpy(pOut + produced, input + inputPosition, count);
+            storeWindow(input + inputPosition, count);
+            inputPosition += count;
+            produced += count;
+            storedRemaining -= (unsigned int)count;
+        }
+        else if (stage == STAGE_BLOCK_HEADER)
+        {
+            if (!readBlockHeader())
+            {
+                stage = STAGE_FAILED;
+                break;
+            }
+        }
+        else if (stage == STAGE_ZLIB_HEADER)
+        {
+            // CM 8 (deflate), window up to 32 KB, header check, no preset dictionary
+            unsigned int cmf = bits(8);
+            unsigned int flg = bits(8);
+            if ((cmf & 15) != 8 || (cmf >> 4) > 7 || ((cmf << 8) | flg) % 31 != 0 || (flg & 0x20) != 0)
+            {
+                stage = STAGE_FAILED;
+                break;
+            }
+            stage = STAGE_BLOCK_HEADER;
+        }
+        else
+            break; // Done or failed
+    }
+
+    // Decoding on zeros that were never in the stream
+    if (paddedBytes > 8 && stage != STAGE_DONE)
+        stage = STAGE_FAILED;
+    return produced;
+}
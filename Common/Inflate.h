@@ -0,0 +1,79 @@
+#pragma once
+
+// Streaming DEFLATE decoder (RFC 1951), optionally behind a zlib header
+// (RFC 1950) as in PNG. Compressed bytes are pulled from a source callback and
+// Read() produces exactly the bytes asked for, so a caller can inflate one
+// scanline at a time into its own memory; only the 32 KB window and a small
+// input buffer are kept. The zlib Adler-32 checksum is not verified.
+
+#include <stddef.h>
+
+#define INFLATE_WINDOW_SIZE 32768
+#define INFLATE_INPUT_SIZE 16384
+#define INFLATE_FAST_BITS 10 // Codes up to this length decode with one table lookup
+
+// Fills pBuffer with up to size compressed bytes, 0 once the stream is exhausted
+typedef size_t (*InflateSource)(void *pUser, unsigned char *pBuffer, size_t size);
+
+class Inflate
+{
+private:
+    struct Huffman
+    {
+        unsigned short fast[1 << INFLATE_FAST_BITS]; // symbol << 4 | length, 0 for longer codes
+        unsigned short counts[16];                   // Codes of each length
+        unsigned short symbols[288];                 // In canonical order
+    };
+
+    enum Stage
+    {
+        STAGE_ZLIB_HEADER = 0,
+        STAGE_BLOCK_HEADER,
+        STAGE_STORED,
+        STAGE_HUFFMAN,
+        STAGE_DONE,
+        STAGE_FAILED
+    };
+
+    InflateSource source;
+    void *pUser;
+    unsigned char input[INFLATE_INPUT_SIZE];
+    size_t inputPosition;
+    size_t inputSize;
+    unsigned int paddedBytes; // Zeros fed in after the source ran dry
+
+    unsigned long long bitBuffer; // Least significant bit first
+    unsigned int bitCount;
+
+    Stage stage;
+    bool bFinalBlock;
+    unsigned int storedRemaining;
+    unsigned int matchRemaining;
+    unsigned int matchDistance;
+
+    unsigned char window[INFLATE_WINDOW_SIZE];
+    unsigned int windowPosition; // Total bytes produced, the window index is this & (size - 1)
+
+    Huffman literals;
+    Huffman distances;
+
+    void refill();
+    void storeWindow(const unsigned char *pData, size_t size);
+    unsigned int bits(unsigned int count);
+    int decode(const Huffman &huffman);
+    static int decodeSymbol(const Huffman &huffman, unsigned long long &bitBuffer, unsigned int &bitCount);
+    bool build(Huffman &huffman, const unsigned char *lengths, unsigned int count);
+    bool readBlockHeader();
+    bool readDynamicTables();
+
+public:
+    Inflate();
+
+    void Reset(InflateSource source, void *pUser, bool bZlibHeader);
+
+    // Bytes written to pOut, fewer than size only at the end of the stream or
+    // on corrupt data
+    size_t Read(unsigned char *pOut, size_t size);
+    bool HasFailed() const { return stage == STAGE_FAILED; }
+    bool IsDone() const { return stage == STAGE_DONE; }
+};
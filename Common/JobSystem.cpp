@@ -0,0 +1,414 @@
+// Work-stealing job scheduler, see JobSystem.h
+// Idle workers spin on the deques for a while, then sleep on a condition
+// variable. A push only takes the lock when some worker is asleep: pushers
+// and sleepers each put a full fence between their own store and checking the
+// other side, so either the pusher sees the sleeper or the sleeper sees the job.
+
+#include <string.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "JobSystem.h"
+
+#define JOB_IDLE_SPINS 64 // Fruitless steal rounds before a worker sleeps
+
+struct Job
+{
+    JobFunction function;
+    Job *pParent;
+    std::atomic<int> unfinishedJobs; // This job and its unfinished children, 0 once the slot is free
+    std::atomic<int> continuationCount;
+    Job *continuations[JOB_MAX_CONTINUATIONS];
+    union
+    {
+        unsigned char data[JOB_DATA_SIZE];
+        double alignment;
+    };
+
+    Job() : function(NULL), pParent(NULL), unfinishedJobs(0), continuationCount(0) {}
+};
+
+// Chase-Lev work-stealing deque with the memory orders of Le et al., "Correct
+// and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013). The
+// circular array does not grow; a full deque makes the owner run the job itself.
+class JobDeque
+{
+private:
+    std::atomic<long long> top; // Thieves take from here
+    char topPadding[64];
+    std::atomic<long long> bottom; // The owner pushes and pops here
+    char bottomPadding[64];
+    std::atomic<Job *> slots[JOB_DEQUE_SIZE];
+
+public:
+    JobDeque() : top(0), bottom(0)
+    {
+        for (int i = 0; i < JOB_DEQUE_SIZE; i++)
+            slots[i].store(NULL, std::memory_order_relaxed);
+    }
+
+    // Owner only, false when full
+    bool Push(Job *pJob)
+    {
+        long long b = bottom.load(std::memory_order_relaxed);
+        long long t = top.load(std::memory_order_acquire);
+        if (b - t >= JOB_DEQUE_SIZE)
+            return false;
+        slots[b & (JOB_DEQUE_SIZE - 1)].store(pJob, std::memory_order_relaxed);
+        bottom.store(b + 1, std::memory_order_release); // The paper's release fence, as a store thieves acquire
+        return true;
+    }
+
+    // Owner only, newest job first
+    Job *Pop()
+    {
+        long long b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long long t = top.load(std::memory_order_relaxed);
+        if (t > b)
+        {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return NULL;
+        }
+
+        Job *pJob = slots[b & (JOB_DEQUE_SIZE - 1)].load(std::memory_order_relaxed);
+        if (t == b)
+        {
+            // Last job, a thief may be taking it from the top at the same time
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                pJob = NULL;
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return pJob;
+    }
+
+    // Any thread, oldest job first; NULL when empty or another thread won the job
+    Job *Steal()
+    {
+        long long t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long long b = bottom.load(std::memory_order_acquire);
+        if (t >= b)
+            return NULL;
+
+        Job *pJob = slots[t & (JOB_DEQUE_SIZE - 1)].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return NULL;
+        return pJob;
+    }
+
+    bool IsEmpty() const
+    {
+        return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+    }
+};
+
+struct JobWorker
+{
+    JobDeque deque;
+    std::vector<Job> pool; // Ring of JOB_POOL_SIZE jobs, recycled once finished
+    unsigned int poolNext;
+    unsigned int index;
+    unsigned int randomState; // xorshift, picks the first victim to steal from
+    std::thread thread;
+
+    explicit JobWorker(unsigned int workerIndex) : pool(JOB_POOL_SIZE), poolNext(0), index(workerIndex), randomState(workerIndex * 2654435761u + 1) {}
+};
+
+static std::vector<JobWorker *> gJobWorkers; // [0] is the thread that called JobsInitialize()
+static thread_local JobWorker *gpThreadWorker = NULL;
+static std::atomic<bool> gbJobsQuit(false);
+static std::atomic<unsigned int> gJobSleepers(0);
+static std::mutex gJobMutex;
+static std::condition_variable gJobWake;
+static unsigned long long gJobWakeGeneration = 0; // Guarded by gJobMutex
+
+static bool runOneJob(JobWorker *pWorker);
+
+static Job *stealJob(JobWorker *pWorker)
+{
+    unsigned int count = (unsigned int)gJobWorkers.size();
+    if (count <= 1)
+        return NULL;
+
+    pWorker->randomState ^= pWorker->randomState << 13;
+    pWorker->randomState ^= pWorker->randomState >> 17;
+    pWorker->randomState ^= pWorker->randomState << 5;
+    unsigned int first = pWorker->randomState % count;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        JobWorker *pVictim = gJobWorkers[(first + i) % count];
+        if (pVictim == pWorker)
+            continue;
+        Job *pJob = pVictim->deque.Steal();
+        if (pJob != NULL)
+            return pJob;
+    }
+    return NULL;
+}
+
+static bool anyJobQueued()
+{
+    for (size_t i = 0; i < gJobWorkers.size(); i++)
+    {
+        if (!gJobWorkers[i]->deque.IsEmpty())
+            return true;
+    }
+    return false;
+}
+
+static void wakeWorker()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (gJobSleepers.load(std::memory_order_relaxed) == 0)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(gJobMutex);
+        gJobWakeGeneration++;
+    }
+    gJobWake.notify_one();
+}
+
+static void finishJob(Job *pJob)
+{
+    // Read everything first, the slot can be reused once the count is zero.
+    // Continuations are all added before the job runs, so they are stable here.
+    Job *pParent = pJob->pParent;
+    int continuationCount = pJob->continuationCount.load(std::memory_order_relaxed);
+    Job *continuations[JOB_MAX_CONTINUATIONS];
+    for (int i = 0; i < continuationCount; i++)
+        continuations[i] = pJob->continuations[i];
+
+    if (pJob->unfinishedJobs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;
+
+    for (int i = 0; i < continuationCount; i++)
+        JobRun(continuations[i]);
+    if (pParent != NULL)
+        finishJob(pParent);
+}
+
+static void executeJob(Job *pJob)
+{
+    pJob->function(pJob, pJob->data);
+    finishJob(pJob);
+}
+
+static bool runOneJob(JobWorker *pWorker)
+{
+    Job *pJob = pWorker->deque.Pop();
+    if (pJob == NULL)
+        pJob = stealJob(pWorker);
+    if (pJob == NULL)
+        return false;
+    executeJob(pJob);
+    return true;
+}
+
+static void workerMain(JobWorker *pWorker)
+{
+    gpThreadWorker = pWorker;
+    unsigned int idleSpins = 0;
+    while (!gbJobsQuit.load(std::memory_order_acquire))
+    {
+        if (runOneJob(pWorker))
+        {
+            idleSpins = 0;
+            continue;
+        }
+        if (++idleSpins < JOB_IDLE_SPINS)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        idleSpins = 0;
+
+        std::unique_lock<std::mutex> lock(gJobMutex);
+        unsigned long long generation = gJobWakeGeneration;
+        gJobSleepers.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!anyJobQueued())
+        {
+            gJobWake.wait(lock, [&]
+                          { return gbJobsQuit.load(std::memory_order_relaxed) || gJobWakeGeneration != generation; });
+        }
+        gJobSleepers.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+bool JobsInitialize(unsigned int numThreads)
+{
+    if (!gJobWorkers.empty())
+        return false;
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+        if (numThreads == 0)
+            numThreads = 1;
+    }
+
+    // Every deque exists before any thread can try to steal from it
+    gbJobsQuit = false;
+    for (unsigned int i = 0; i < numThreads; i++)
+        gJobWorkers.push_back(new JobWorker(i));
+    gpThreadWorker = gJobWorkers[0];
+
+    // calling thread works too, so spawn one less
+    for (unsigned int i = 1; i < numThreads; i++)
+        gJobWorkers[i]->thread = std::thread(workerMain, gJobWorkers[i]);
+    return true;
+}
+
+void JobsCleanup()
+{
+    {
+        std::lock_guard<std::mutex> lock(gJobMutex);
+        gbJobsQuit = true;
+    }
+    gJobWake.notify_all();
+    for (size_t i = 0; i < gJobWorkers.size(); i++)
+    {
+        if (gJobWorkers[i]->thread.joinable())
+            gJobWorkers[i]->thread.join();
+    }
+
+    // Only once nobody can be stealing from them any more
+    for (size_t i = 0; i < gJobWorkers.size(); i++)
+        delete gJobWorkers[i];
+    gJobWorkers.clear();
+    gpThreadWorker = NULL;
+}
+
+unsigned int JobsGetThreadCount()
+{
+    return gJobWorkers.empty() ? 1 : (unsigned int)gJobWorkers.size();
+}
+
+unsigned int JobsGetWorkerIndex()
+{
+    return gpThreadWorker != NULL ? gpThreadWorker->index : 0;
+}
+
+Job *JobCreate(JobFunction function, const void *pData, size_t dataSize)
+{
+    JobWorker *pWorker = gpThreadWorker;
+    if (pWorker == NULL || dataSize > JOB_DATA_SIZE)
+        return NULL;
+
+    // Skip slots still in flight; if the whole ring is, help until one finishes
+    Job *pJob = NULL;
+    for (;;)
+    {
+        pJob = &pWorker->pool[pWorker->poolNext & (JOB_POOL_SIZE - 1)];
+        pWorker->poolNext++;
+        if (pJob->unfinishedJobs.load(std::memory_order_acquire) == 0)
+            break;
+        if ((pWorker->poolNext & (JOB_POOL_SIZE - 1)) == 0 && !runOneJob(pWorker))
+            std::this_thread::yield();
+    }
+
+    pJob->function = function;
+    pJob->pParent = NULL;
+    pJob->continuationCount.store(0, std::memory_order_relaxed);
+    if (dataSize > 0)
+        memcpy(pJob->data, pData, dataSize);
+    pJob->unfinishedJobs.store(1, std::memory_order_relaxed);
+    return pJob;
+}
+
+Job *JobCreateChild(Job *pParent, JobFunction function, const void *pData, size_t dataSize)
+{
+    Job *pJob = JobCreate(function, pData, dataSize);
+    if (pJob == NULL)
+        return NULL;
+    pParent->unfinishedJobs.fetch_add(1, std::memory_order_relaxed);
+    pJob->pParent = pParent;
+    return pJob;
+}
+
+bool JobAddContinuation(Job *pJob, Job *pContinuation)
+{
+    int index = pJob->continuationCount.fetch_add(1, std::memory_order_relaxed);
+    if (index >= JOB_MAX_CONTINUATIONS)
+    {
+        pJob->continuationCount.fetch_sub(1, std::memory_order_relaxed);
+        return false;
+    }
+    pJob->continuations[index] = pContinuation;
+    return true;
+}
+
+void JobRun(Job *pJob)
+{
+    if (!gpThreadWorker->deque.Push(pJob))
+    {
+        executeJob(pJob); // Deque full, run it here
+        return;
+    }
+    wakeWorker();
+}
+
+void JobWait(const Job *pJob)
+{
+    JobWorker *pWorker = gpThreadWorker;
+    while (pJob->unfinishedJobs.load(std::memory_order_acquire) != 0)
+    {
+        if (pWorker == NULL || !runOneJob(pWorker))
+            std::this_thread::yield();
+    }
+}
+
+bool JobIsFinished(const Job *pJob)
+{
+    return pJob->unfinishedJobs.load(std::memory_order_acquire) == 0;
+}
+
+//
+// Parallel for
+//
+
+struct ParallelForRange
+{
+    const std::function<void(unsigned int, unsigned int)> *pTask;
+    unsigned int begin;
+    unsigned int end;
+    unsigned int grain;
+};
+
+// Queue upper halves until the rest is one grain: the owner pops the smallest
+// back while thieves take the largest from the top
+static void parallelForJob(Job *pJob, const void *pData)
+{
+    ParallelForRange range;
+    memcpy(&range, pData, sizeof(range));
+    while (range.end - range.begin > range.grain)
+    {
+        ParallelForRange upper = range;
+        upper.begin = range.begin + (range.end - range.begin) / 2;
+        range.end = upper.begin;
+        JobRun(JobCreateChild(pJob, parallelForJob, &upper, sizeof(upper)));
+    }
+    (*range.pTask)(range.begin, range.end);
+}
+
+void JobParallelFor(unsigned int count, unsigned int grain, const std::function<void(unsigned int, unsigned int)> &task)
+{
+    if (count == 0)
+        return;
+    if (grain == 0)
+        grain = 1;
+    if (gpThreadWorker == NULL || count <= grain || gJobWorkers.size() <= 1)
+    {
+        task(0, count);
+        return;
+    }
+
+    ParallelForRange range = {&task, 0, count, grain};
+    Job *pRoot = JobCreate(parallelForJob, &range, sizeof(range));
+    executeJob(pRoot);
+    JobWait(pRoot);
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+// Work-stealing job scheduler shared by the renderer core and the samples
+//
+// JobsInitialize() starts one worker thread per core besides the calling
+// thread, which becomes worker 0 and runs jobs whenever it waits. Every worker
+// owns a Chase-Lev deque: it pushes and pops its own jobs at the bottom without
+// locks, and a worker that runs dry steals from the top of a random other one,
+// so work a job spawns stays on its core until some other core is idle.
+//
+// A job counts itself and its unfinished children. When the count reaches zero
+// the parent's count drops and the job's continuations are queued, so follow-up
+// work is chained without a thread blocking or a fiber switch. JobWait() runs
+// other jobs until the one waited for has finished.
+//
+// Jobs are recycled from a ring of JOB_POOL_SIZE per worker, so a finished job
+// may only be waited on until its thread has created that many more. Jobs are
+// created and run from the thread that called JobsInitialize() or from inside
+// jobs; JobParallelFor() from any other thread, or without JobsInitialize(),
+// simply runs the loop on the calling thread.
+
+#include <stddef.h>
+#include <functional>
+
+#define JOB_POOL_SIZE 4096       // Jobs a worker can have in flight, power of two
+#define JOB_DEQUE_SIZE 4096      // Jobs a worker can have queued, power of two
+#define JOB_DATA_SIZE 48         // Bytes of argument copied into the job
+#define JOB_MAX_CONTINUATIONS 4  // Jobs queued when one finishes
+
+struct Job;
+typedef void (*JobFunction)(Job *pJob, const void *pData);
+
+bool JobsInitialize(unsigned int numThreads); // numThreads 0 = all cores, the calling thread counts as one
+void JobsCleanup();                           // Stop the workers, once every job has been waited for
+unsigned int JobsGetThreadCount();            // 1 without JobsInitialize()
+unsigned int JobsGetWorkerIndex();            // 0 .. JobsGetThreadCount() - 1 on job threads, for per thread scratch
+
+// dataSize bytes of pData are copied into the job; NULL when dataSize is over
+// JOB_DATA_SIZE or the calling thread is not a job thread
+Job *JobCreate(JobFunction function, const void *pData, size_t dataSize);
+// pParent does not finish before the child; call before pParent finishes, usually from inside it
+Job *JobCreateChild(Job *pParent, JobFunction function, const void *pData, size_t dataSize);
+// Queue pContinuation once pJob and its children finish; call before JobRun(pJob),
+// false when pJob already has JOB_MAX_CONTINUATIONS
+bool JobAddContinuation(Job *pJob, Job *pContinuation);
+void JobRun(Job *pJob);
+void JobWait(const Job *pJob); // Runs other jobs until pJob and its children have finished
+bool JobIsFinished(const Job *pJob);
+
+// task(begin, end) over [0, count) in ranges of at most grain items, made by
+// splitting in halves so idle workers steal the large ones; returns when all ran
+void JobParallelFor(unsigned int count, unsigned int grain, const std::function<void(unsigned int, unsigned int)> &task);
@@ -0,0 +1,208 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Log.h"
+
+// One message in the ring. sequence tells whose turn the slot is: equal to the
+// claim index when free for that producer, claim index + 1 once the text is
+// ready for the writer thread (bounded MPMC queue, used here with one consumer).
+struct LogSlot
+{
+    std::atomic<unsigned long long> sequence;
+    int level;
+    char text[LOG_MESSAGE_SIZE];
+};
+
+static LogSlot gLogRing[LOG_RING_SIZE];
+static std::atomic<unsigned long long> gLogClaimIndex(0);   // Next slot a producer takes
+static std::atomic<unsigned long long> gLogWrittenIndex(0); // Slots the writer has put in the file
+static std::atomic<unsigned long long> gLogDropped(0);
+static std::atomic<bool> gbLogRunning(false);
+static std::atomic<bool> gbLogStop(false);
+static bool gbLogFlushRequested = false; // Guarded by gLogMutex
+
+static FILE *gpLogFile = NULL;
+static std::thread gLogThread;
+static std::mutex gLogMutex;
+static std::condition_variable gLogWake;    // Producers and LogFlush wake the writer
+static std::condition_variable gLogWritten; // The writer wakes LogFlush
+
+static const char *logLevelPrefix(int level)
+{
+    switch (level)
+    {
+    case LOG_LEVEL_DEBUG:
+        return "Debug: ";
+    case LOG_LEVEL_WARNING:
+        return "Warning: ";
+    case LOG_LEVEL_ERROR:
+        return "Error: ";
+    default:
+        return ""; // Info lines keep the original Log.txt look
+    }
+}
+
+// Writer thread, drains the ring in batches and flushes once per batch
+static void logWriterThread()
+{
+    unsigned long long readIndex = gLogWrittenIndex.load(std::memory_order_relaxed);
+    unsigned long long droppedReported = 0;
+
+    for (;;)
+    {
+        bool bStop = gbLogStop.load(std::memory_order_acquire);
+
+        unsigned long long batchStart = readIndex;
+        for (;;)
+        {
+            LogSlot *pSlot = &gLogRing[readIndex & (LOG_RING_SIZE - 1)];
+            if (pSlot->sequence.load(std::memory_order_acquire) != readIndex + 1)
+                break; // Not published yet
+
+            fputs(logLevelPrefix(pSlot->level), gpLogFile);
+            fputs(pSlot->text, gpLogFile);
+
+            // Hand the slot back to producers for the next lap of the ring
+            pSlot->sequence.store(readIndex + LOG_RING_SIZE, std::memory_order_release);
+            readIndex++;
+        }
+
+        unsigned long long dropped = gLogDropped.load(std::memory_order_relaxed);
+        if (dropped != droppedReported)
+        {
+            fprintf(gpLogFile, "Warning: %llu log messages dropped, ring buffer full\n", dropped - droppedReported);
+            droppedReported = dropped;
+        }
+
+        if (readIndex != batchStart)
+        {
+            fflush(gpLogFile);
+            std::lock_guard<std::mutex> lock(gLogMutex);
+            gLogWrittenIndex.store(readIndex, std::memory_order_release);
+            gLogWritten.notify_all();
+        }
+
+        // Everything claimed before the stop request has been written
+        if (bStop && readIndex == gLogClaimIndex.load(std::memory_order_acquire))
+            break;
+
+        // Errors wake the writer without the mutex, a missed one waits at most one period
+        std::unique_lock<std::mutex> lock(gLogMutex);
+        gLogWake.wait_for(lock, std::chrono::milliseconds(10), []
+                          { return gbLogFlushRequested || gbLogStop.load(); });
+        gbLogFlushRequested = false;
+    }
+}
+
+void LogInitialize(const char *fileName)
+{
+    if (gbLogRunning.load())
+        LogCleanup();
+
+    gpLogFile = fopen(fileName, "w");
+    if (gpLogFile == NULL)
+    {
+        fprintf(stderr, "Log File Cannot be Opened\n");
+        return;
+    }
+    fprintf(gpLogFile, "Log File Created Successfully\n");
+    fflush(gpLogFile);
+
+    for (unsigned long long i = 0; i < LOG_RING_SIZE; i++)
+        gLogRing[i].sequence.store(i, std::memory_order_relaxed);
+    gLogClaimIndex.store(0);
+    gLogWrittenIndex.store(0);
+    gLogDropped.store(0);
+    gbLogStop.store(false);
+
+    gLogThread = std::thread(logWriterThread);
+    gbLogRunning.store(true, std::memory_order_release);
+}
+
+void LogMessage(int level, const char *format, ...)
+{
+    if (!gbLogRunning.load(std::memory_order_acquire))
+        return;
+
+    // Claim a slot, or drop the message when the writer is a full ring behind
+    LogSlot *pSlot = NULL;
+    unsigned long long index = gLogClaimIndex.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        pSlot = &gLogRing[index & (LOG_RING_SIZE - 1)];
+        long long diff = (long long)(pSlot->sequence.load(std::memory_order_acquire) - index);
+        if (diff == 0)
+        {
+            if (gLogClaimIndex.compare_exchange_weak(index, index + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+        {
+            gLogDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        else
+        {
+            index = gLogClaimIndex.load(std::memory_order_relaxed);
+        }
+    }
+
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(pSlot->text, LOG_MESSAGE_SIZE, format, args);
+    va_end(args);
+
+    // Keep truncated messages on their own line
+    if (length >= LOG_MESSAGE_SIZE)
+        pSlot->text[LOG_MESSAGE_SIZE - 2] = '\n';
+
+    pSlot->level = level;
+    pSlot->sequence.store(index + 1, std::memory_order_release);
+
+    // Errors go to disk right away instead of with the next batch
+    if (level >= LOG_LEVEL_ERROR)
+        gLogWake.notify_one();
+}
+
+void LogFlush()
+{
+    if (!gbLogRunning.load(std::memory_order_acquire))
+        return;
+
+    unsigned long long target = gLogClaimIndex.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(gLogMutex);
+    gbLogFlushRequested = true;
+    gLogWake.notify_one();
+    gLogWritten.wait(lock, [target]
+                     { return gLogWrittenIndex.load(std::memory_order_acquire) >= target; });
+}
+
+void LogCleanup()
+{
+    if (!gbLogRunning.load())
+        return;
+
+    Log("Closing log file\n");
+
+    gbLogStop.store(true, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(gLogMutex);
+        gLogWake.notify_one();
+    }
+    gLogThread.join();
+    gbLogRunning.store(false);
+
+    fclose(gpLogFile);
+    gpLogFile = NULL;
+}
+
+unsigned long long LogDroppedCount()
+{
+    return gLogDropped.load(std::memory_order_relaxed);
+}
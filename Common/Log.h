@@ -0,0 +1,63 @@
+#pragma once
+
+// Log.txt helpers shared by the renderer core and the samples
+//
+// Messages are formatted on the calling thread into a fixed ring of slots and
+// written to the file by a background thread, so logging never opens a file
+// or blocks on disk I/O. The ring holds LOG_RING_SIZE messages of at most
+// LOG_MESSAGE_SIZE bytes; when it is full new messages are dropped and counted
+// instead of waiting. Levels below LOG_MIN_LEVEL compile to nothing.
+
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO 1
+#define LOG_LEVEL_WARNING 2
+#define LOG_LEVEL_ERROR 3
+
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_RING_SIZE 512     // Power of two
+#define LOG_MESSAGE_SIZE 512  // Bytes per message including the terminator
+
+void LogInitialize(const char *fileName); // Create or truncate the log file and start the writer thread
+void LogMessage(int level, const char *format, ...);
+void LogFlush();                           // Wait until everything logged so far is in the file
+void LogCleanup();                         // Flush, stop the writer thread and close the file
+unsigned long long LogDroppedCount();      // Messages lost because the ring was full
+
+// A disabled level still type-checks its arguments and counts them as used,
+// the call itself compiles away
+#define LOG_DISABLED(level, ...)                \
+    do                                          \
+    {                                           \
+        if (0)                                  \
+            LogMessage(level, __VA_ARGS__);     \
+    } while (0)
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_DEBUG
+#define LogDebug(...) LogMessage(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LogDebug(...) LOG_DISABLED(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_INFO
+#define LogInfo(...) LogMessage(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LogInfo(...) LOG_DISABLED(LOG_LEVEL_INFO, __VA_ARGS__)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_WARNING
+#define LogWarning(...) LogMessage(LOG_LEVEL_WARNING, __VA_ARGS__)
+#else
+#define LogWarning(...) LOG_DISABLED(LOG_LEVEL_WARNING, __VA_ARGS__)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_ERROR
+#define LogError(...) LogMessage(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LogError(...) LOG_DISABLED(LOG_LEVEL_ERROR, __VA_ARGS__)
+#endif
+
+// Plain progress messages, the "X Successful" lines
+#define Log(...) LogInfo(__VA_ARGS__)
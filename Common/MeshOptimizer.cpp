@@ -0,0 +1,415 @@
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#include "MeshOptimizer.h"
+
+// Forsyth's scoring parameters; the cache modelled while ordering is larger
+// than the hardware one so vertices a few triangles back still attract
+#define FORSYTH_CACHE_SIZE 32
+#define FORSYTH_CACHE_DECAY_POWER 1.5f
+#define FORSYTH_LAST_TRIANGLE_SCORE 0.75f
+#define FORSYTH_VALENCE_BOOST_SCALE 2.0f
+#define FORSYTH_VALENCE_BOOST_POWER 0.5f
+#define FORSYTH_MAX_VALENCE 32 // Valence scores past this are all the same
+
+void AnalyzeVertexCache(const unsigned int *pIndices, unsigned int indexCount, unsigned int vertexCount, unsigned int cacheSize,
+                        VertexCacheStatistics &statistics)
+{
+    memset(&statistics, 0, sizeof(VertexCacheStatistics));
+    if (indexCount < 3 || vertexCount == 0 || cacheSize == 0)
+        return;
+
+    // time stamp of every vertex's entry into the FIFO, a vertex is cached
+    // while fewer than cacheSize misses happened since then
+    std::vector<unsigned int> cachedAt(vertexCount, 0);
+    std::vector<bool> used(vertexCount, false);
+    unsigned int time = cacheSize + 1;
+    unsigned int uniqueVertices = 0;
+
+    for (unsigned int i = 0; i < indexCount; i++)
+    {
+        unsigned int v = pIndices[i];
+        if (v >= vertexCount)
+            continue;
+        if (!used[v])
+        {
+            used[v] = true;
+            uniqueVertices++;
+        }
+        if (time - cachedAt[v] > cacheSize)
+        {
+            cachedAt[v] = time++;
+            statistics.vertexTransforms++;
+        }
+    }
+
+    statistics.acmr = (float)statistics.vertexTransforms / (float)(indexCount / 3);
+    statistics.atvr = uniqueVertices ? (float)statistics.vertexTransforms / (float)uniqueVertices : 0.0f;
+}
+
+// Score tables, position in the cache and number of triangles still to draw
+struct ForsythScores
+{
+    float cache[FORSYTH_CACHE_SIZE + 3];
+    float valence[FORSYTH_MAX_VALENCE + 1];
+
+    ForsythScores()
+    {
+        for (int i = 0; i < FORSYTH_CACHE_SIZE + 3; i++)
+        {
+            if (i < 3)
+                cache[i] = FORSYTH_LAST_TRIANGLE_SCORE; // Fixed so the order within a strip does not matter
+            else
+                cache[i] = powf(1.0f - (float)(i - 3) / (float)FORSYTH_CACHE_SIZE, FORSYTH_CACHE_DECAY_POWER);
+        }
+        valence[0] = 0.0f;
+        for (int i = 1; i <= FORSYTH_MAX_VALENCE; i++)
+            valence[i] = FORSYTH_VALENCE_BOOST_SCALE * powf((float)i, -FORSYTH_VALENCE_BOOST_POWER);
+    }
+
+    float Vertex(int cachePosition, unsigned int liveTriangles) const
+    {
+        if (liveTriangles == 0)
+            return -1.0f;
+        float score = cachePosition >= 0 ? cache[cachePosition] : 0.0f;
+        return score + valence[std::min(liveTriangles, (unsigned int)FORSYTH_MAX_VALENCE)];
+    }
+};
+
+void OptimizeVertexCache(unsigned int *pDestination, const unsigned int *pIndices, unsigned int indexCount, unsigned int vertexCount)
+{
+    static const ForsythScores scores;
+    unsigned int triangleCount = indexCount / 3;
+    std::vector<unsigned int> indices(pIndices, pIndices + triangleCount * 3);
+    for (unsigned int i = 0; i < triangleCount * 3; i++)
+    {
+        if (indices[i] >= vertexCount)
+        {
+            // out of range indices, nothing sensible to reorder
+            memmove(pDestination, pIndices, sizeof(unsigned int) * indexCount);
+            return;
+        }
+    }
+
+    // triangles of every vertex; live ones are kept in front of each list
+    std::vector<unsigned int> liveTriangles(vertexCount, 0);
+    for (unsigned int i = 0; i < triangleCount * 3; i++)
+        liveTriangles[indices[i]]++;
+    std::vector<unsigned int> adjacencyOffsets(vertexCount + 1, 0);
+    for (unsigned int v = 0; v < vertexCount; v++)
+        adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveTriangles[v];
+    std::vector<unsigned int> adjacency(triangleCount * 3);
+    std::vector<unsigned int> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+    for (unsigned int t = 0; t < triangleCount; t++)
+    {
+        for (int k = 0; k < 3; k++)
+            adjacency[fill[indices[t * 3 + k]]++] = t;
+    }
+
+    std::vector<int> cachePosition(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount);
+    for (unsigned int v = 0; v < vertexCount; v++)
+        vertexScore[v] = scores.Vertex(-1, liveTriangles[v]);
+
+    std::vector<float> triangleScore(triangleCount);
+    std::vector<bool> emitted(triangleCount, false);
+    for (unsigned int t = 0; t < triangleCount; t++)
+        triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+
+    unsigned int cache[FORSYTH_CACHE_SIZE + 3];
+    unsigned int newCache[FORSYTH_CACHE_SIZE + 3];
+    unsigned int cacheCount = 0;
+    unsigned int nextUnemitted = 0; // Restart point when the cache holds no live triangle
+
+    unsigned int bestTriangle = 0;
+    for (unsigned int t = 1; t < triangleCount; t++)
+    {
+        if (triangleScore[t] > triangleScore[bestTriangle])
+            bestTriangle = t;
+    }
+
+    for (unsigned int output = 0; output < triangleCount; output++)
+    {
+        const unsigned int *pTriangle = &indices[bestTriangle * 3];
+        memcpy(&pDestination[output * 3], pTriangle, sizeof(unsigned int) * 3);
+        emitted[bestTriangle] = true;
+
+        // remove the triangle from its vertices' live lists
+        for (int k = 0; k < 3; k++)
+        {
+            unsigned int v = pTriangle[k];
+            unsigned int *pList = &adjacency[adjacencyOffsets[v]];
+            unsigned int live = liveTriangles[v];
+            for (unsigned int j = 0; j < live; j++)
+            {
+                if (pList[j] == bestTriangle)
+                {
+                    std::swap(pList[j], pList[live - 1]);
+                    break;
+                }
+            }
+            liveTriangles[v] = live - 1;
+        }
+
+        // the triangle's vertices move to the front, the rest shift back
+        unsigned int newCount = 0;
+        for (int k = 0; k < 3; k++)
+            newCache[newCount++] = pTriangle[k];
+        for (unsigned int j = 0; j < cacheCount; j++)
+        {
+            unsigned int v = cache[j];
+            if (v != pTriangle[0] && v != pTriangle[1] && v != pTriangle[2])
+                newCache[newCount++] = v;
+        }
+        for (unsigned int j = FORSYTH_CACHE_SIZE; j < newCount; j++)
+        {
+            cachePosition[newCache[j]] = -1;
+            vertexScore[newCache[j]] = scores.Vertex(-1, liveTriangles[newCache[j]]);
+        }
+        cacheCount = std::min(newCount, (unsigned int)FORSYTH_CACHE_SIZE);
+        memcpy(cache, newCache, sizeof(unsigned int) * cacheCount);
+        for (unsigned int j = 0; j < cacheCount; j++)
+        {
+            cachePosition[cache[j]] = (int)j;
+            vertexScore[cache[j]] = scores.Vertex((int)j, liveTriangles[cache[j]]);
+        }
+
+        // rescore the live triangles of everything the cache touched and pick the best of them
+        float bestScore = -1.0f;
+        bool bFound = false;
+        for (unsigned int j = 0; j < newCount; j++)
+        {
+            unsigned int v = newCache[j];
+            const unsigned int *pList = &adjacency[adjacencyOffsets[v]];
+            for (unsigned int l = 0; l < liveTriangles[v]; l++)
+            {
+                unsigned int t = pList[l];
+                const unsigned int *pOther = &indices[t * 3];
+                float score = vertexScore[pOther[0]] + vertexScore[pOther[1]] + vertexScore[pOther[2]];
+                triangleScore[t] = score;
+                if (j < cacheCount && score > bestScore)
+                {
+                    bestScore = score;
+                    bestTriangle = t;
+                    bFound = true;
+                }
+            }
+        }
+
+        // dead end, continue with the first triangle not drawn yet
+        if (!bFound)
+        {
+            while (nextUnemitted < triangleCount && emitted[nextUnemitted])
+                nextUnemitted++;
+            bestTriangle = nextUnemitted;
+        }
+    }
+
+    if (indexCount > triangleCount * 3 && pDestination != pIndices)
+        memcpy(&pDestination[triangleCount * 3], &pIndices[triangleCount * 3], sizeof(unsigned int) * (indexCount - triangleCount * 3));
+}
+
+// Hard boundaries are where the cache optimized order has a triangle with
+// three misses, soft ones split a hard cluster once its running ACMR drops
+// below threshold times the cluster's own ACMR
+static void buildClusters(const unsigned int *pIndices, unsigned int triangleCount, unsigned int vertexCount, float threshold,
+                          std::vector<unsigned int> &clusters)
+{
+    std::vector<unsigned int> cachedAt(vertexCount, 0);
+    unsigned int time = MESH_CACHE_SIZE + 1;
+
+    // misses of every triangle in the order as it is
+    std::vector<unsigned char> misses(triangleCount);
+    for (unsigned int t = 0; t < triangleCount; t++)
+    {
+        unsigned int count = 0;
+        for (int k = 0; k < 3; k++)
+        {
+            unsigned int v = pIndices[t * 3 + k];
+            if (time - cachedAt[v] > MESH_CACHE_SIZE)
+            {
+                cachedAt[v] = time++;
+                count++;
+            }
+        }
+        misses[t] = (unsigned char)count;
+    }
+
+    std::vector<unsigned int> hard;
+    for (unsigned int t = 0; t < triangleCount; t++)
+    {
+        if (t == 0 || misses[t] == 3)
+            hard.push_back(t);
+    }
+    hard.push_back(triangleCount);
+
+    clusters.clear();
+    for (size_t h = 0; h + 1 < hard.size(); h++)
+    {
+        unsigned int start = hard[h], end = hard[h + 1];
+        unsigned int clusterMisses = 0;
+        for (unsigned int t = start; t < end; t++)
+            clusterMisses += misses[t];
+        float clusterThreshold = threshold * (float)clusterMisses / (float)(end - start);
+
+        // a split restarts the cache, so replay the misses from a cold cache
+        clusters.push_back(start);
+        time += MESH_CACHE_SIZE + 1;
+        unsigned int runningMisses = 0, runningTriangles = 0;
+        for (unsigned int t = start; t < end; t++)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                unsigned int v = pIndices[t * 3 + k];
+                if (time - cachedAt[v] > MESH_CACHE_SIZE)
+                {
+                    cachedAt[v] = time++;
+                    runningMisses++;
+                }
+            }
+            runningTriangles++;
+            if (t + 1 < end && (float)runningMisses <= clusterThreshold * (float)runningTriangles)
+            {
+                clusters.push_back(t + 1);
+                time += MESH_CACHE_SIZE + 1;
+                runningMisses = runningTriangles = 0;
+            }
+        }
+    }
+    clusters.push_back(triangleCount);
+}
+
+void OptimizeOverdraw(unsigned int *pDestination, const unsigned int *pIndices, unsigned int indexCount,
+                      const float *pPositions, unsigned int positionStride, unsigned int vertexCount, float threshold)
+{
+    unsigned int triangleCount = indexCount / 3;
+    std::vector<unsigned int> indices(pIndices, pIndices + indexCount);
+    for (unsigned int i = 0; i < triangleCount * 3; i++)
+    {
+        if (indices[i] >= vertexCount)
+        {
+            memmove(pDestination, pIndices, sizeof(unsigned int) * indexCount);
+            return;
+        }
+    }
+    if (triangleCount == 0)
+        return;
+
+    std::vector<unsigned int> clusters;
+    buildClusters(indices.data(), triangleCount, vertexCount, threshold, clusters);
+    unsigned int clusterCount = (unsigned int)clusters.size() - 1;
+
+    // area weighted centroids and normals, of the mesh and of every cluster
+    std::vector<float> clusterData(clusterCount * 7, 0.0f); // centroid xyz, normal xyz, area
+    float meshCentroid[3] = {0.0f, 0.0f, 0.0f};
+    float meshArea = 0.0f;
+    for (unsigned int c = 0; c < clusterCount; c++)
+    {
+        float *pCluster = &clusterData[c * 7];
+        for (unsigned int t = clusters[c]; t < clusters[c + 1]; t++)
+        {
+            const float *p[3];
+            for (int k = 0; k < 3; k++)
+                p[k] = (const float *)((const unsigned char *)pPositions + (size_t)indices[t * 3 + k] * positionStride);
+            float e1[3] = {p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2]};
+            float e2[3] = {p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2]};
+            float n[3] = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0]};
+            float area = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            for (int i = 0; i < 3; i++)
+            {
+                float center = (p[0][i] + p[1][i] + p[2][i]) / 3.0f;
+                pCluster[i] += center * area;
+                pCluster[3 + i] += n[i];
+            }
+            pCluster[6] += area;
+        }
+        for (int i = 0; i < 3; i++)
+            meshCentroid[i] += pCluster[i];
+        meshArea += pCluster[6];
+    }
+    for (int i = 0; i < 3; i++)
+        meshCentroid[i] = meshArea > 0.0f ? meshCentroid[i] / meshArea : 0.0f;
+
+    // clusters facing away from the center hide the rest from most directions, draw them first
+    std::vector<float> sortKey(clusterCount);
+    std::vector<unsigned int> order(clusterCount);
+    for (unsigned int c = 0; c < clusterCount; c++)
+    {
+        const float *pCluster = &clusterData[c * 7];
+        float area = pCluster[6] > 0.0f ? pCluster[6] : 1.0f;
+        float normalLength = sqrtf(pCluster[3] * pCluster[3] + pCluster[4] * pCluster[4] + pCluster[5] * pCluster[5]);
+        float key = 0.0f;
+        if (normalLength > 0.0f)
+        {
+            for (int i = 0; i < 3; i++)
+                key += (pCluster[i] / area - meshCentroid[i]) * pCluster[3 + i] / normalLength;
+        }
+        sortKey[c] = key;
+        order[c] = c;
+    }
+    std::stable_sort(order.begin(), order.end(), [&sortKey](unsigned int a, unsigned int b) { return sortKey[a] > sortKey[b]; });
+
+    unsigned int output = 0;
+    for (unsigned int c = 0; c < clusterCount; c++)
+    {
+        unsigned int first = clusters[order[c]], count = clusters[order[c] + 1] - first;
+        memcpy(&pDestination[output], &indices[first * 3], sizeof(unsigned int) * count * 3);
+        output += count * 3;
+    }
+    if (indexCount > output)
+        memcpy(&pDestination[output], &indices[output], sizeof(unsigned int) * (indexCount - output));
+}
+
+unsigned int OptimizeVertexFetch(void *pDestination, unsigned int *pIndices, unsigned int indexCount,
+                                 const void *pVertices, unsigned int vertexCount, unsigned int vertexSize)
+{
+    const unsigned int unused = 0xFFFFFFFF;
+    std::vector<unsigned int> remap(vertexCount, unused);
+    unsigned int next = 0;
+    for (unsigned int i = 0; i < indexCount; i++)
+    {
+        unsigned int v = pIndices[i];
+        if (v >= vertexCount)
+            continue;
+        if (remap[v] == unused)
+        {
+            memcpy((unsigned char *)pDestination + (size_t)next * vertexSize, (const unsigned char *)pVertices + (size_t)v * vertexSize, vertexSize);
+            remap[v] = next++;
+        }
+        pIndices[i] = remap[v];
+    }
+    return next;
+}
+
+void OptimizeMesh(SphereMesh &mesh, MeshOptimizationReport *pReport)
+{
+    unsigned int vertexCount = (unsigned int)mesh.vertices.size();
+    std::vector<unsigned int> indices(mesh.indexCount);
+    for (unsigned int i = 0; i < mesh.indexCount; i++)
+        indices[i] = mesh.indexFormat == INDEX_FORMAT_UINT16 ? mesh.indices16[i] : mesh.indices32[i];
+
+    if (pReport)
+        AnalyzeVertexCache(indices.data(), mesh.indexCount, vertexCount, MESH_CACHE_SIZE, pReport->before);
+
+    OptimizeVertexCache(indices.data(), indices.data(), mesh.indexCount, vertexCount);
+    OptimizeOverdraw(indices.data(), indices.data(), mesh.indexCount, mesh.vertices.empty() ? NULL : mesh.vertices[0].position,
+                     sizeof(SphereVertex), vertexCount, MESH_OVERDRAW_THRESHOLD);
+
+    std::vector<SphereVertex> vertices(vertexCount);
+    unsigned int usedVertices = OptimizeVertexFetch(vertices.data(), indices.data(), mesh.indexCount, mesh.vertices.data(), vertexCount, sizeof(SphereVertex));
+    vertices.resize(usedVertices);
+    mesh.vertices.swap(vertices);
+
+    for (unsigned int i = 0; i < mesh.indexCount; i++)
+    {
+        if (mesh.indexFormat == INDEX_FORMAT_UINT16)
+            mesh.indices16[i] = (unsigned short)indices[i];
+        else
+            mesh.indices32[i] = indices[i];
+    }
+
+    if (pReport)
+        AnalyzeVertexCache(indices.data(), mesh.indexCount, usedVertices, MESH_CACHE_SIZE, pReport->after);
+}
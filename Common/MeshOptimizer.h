@@ -0,0 +1,55 @@
+#pragma once
+
+// Index and vertex buffer reordering for the GPU, run once at load time
+//
+// OptimizeVertexCache  - triangle order for the post-transform vertex cache,
+//                        Tom Forsyth's "Linear-Speed Vertex Cache Optimisation"
+// OptimizeOverdraw     - splits that order into clusters where the cache starts
+//                        cold anyway and draws the most outward facing clusters
+//                        first (Sander et al., "Fast Triangle Reordering for
+//                        Vertex Locality and Reduced Overdraw"), keeping the
+//                        ACMR within threshold of the cache optimized order
+// OptimizeVertexFetch  - renumbers vertices in the order the indices first use
+//                        them so vertex fetch walks the buffer front to back
+//
+// AnalyzeVertexCache simulates a FIFO cache of cacheSize entries and reports
+// ACMR (transformed vertices per triangle, 0.5 is the ideal for a regular grid,
+// 3 means no reuse) and ATVR (transformed vertices per unique vertex, 1 is
+// ideal). Index arrays are 32 bit; OptimizeMesh() handles either format of a
+// SphereMesh.
+
+#include "Sphere.h"
+
+#define MESH_CACHE_SIZE 16            // FIFO entries of the simulated post-transform cache
+#define MESH_OVERDRAW_THRESHOLD 1.05f // ACMR OptimizeMesh lets OptimizeOverdraw give up, relative
+
+struct VertexCacheStatistics
+{
+    unsigned int vertexTransforms; // Cache misses
+    float acmr;
+    float atvr;
+};
+
+struct MeshOptimizationReport
+{
+    VertexCacheStatistics before;
+    VertexCacheStatistics after;
+};
+
+void AnalyzeVertexCache(const unsigned int *pIndices, unsigned int indexCount, unsigned int vertexCount, unsigned int cacheSize,
+                        VertexCacheStatistics &statistics);
+
+// pDestination may be pIndices
+void OptimizeVertexCache(unsigned int *pDestination, const unsigned int *pIndices, unsigned int indexCount, unsigned int vertexCount);
+
+// pIndices should already be cache optimized; pPositions is float3 with positionStride bytes between vertices
+void OptimizeOverdraw(unsigned int *pDestination, const unsigned int *pIndices, unsigned int indexCount,
+                      const float *pPositions, unsigned int positionStride, unsigned int vertexCount, float threshold);
+
+// Rewrites pIndices in place and copies the vertices to pDestination in first
+// use order, returns how many were referenced (unreferenced ones are dropped)
+unsigned int OptimizeVertexFetch(void *pDestination, unsigned int *pIndices, unsigned int indexCount,
+                                 const void *pVertices, unsigned int vertexCount, unsigned int vertexSize);
+
+// All three passes on a sphere, keeping its index format; pReport may be NULL
+void OptimizeMesh(SphereMesh &mesh, MeshOptimizationReport *pReport);
@@ -0,0 +1,1208 @@
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Clock.h"
+#include "EventQueue.h"
+#include "FramePacer.h"
+#include "JobSystem.h"
+#include "Platform.h"
+#include "Profiler.h"
+#include "Renderer.h"
+#include "Scene.h"
+#include "Log.h"
+#include "ShaderCache.h"
+
+#ifdef _WIN32
+#pragma comment(lib, "psapi.lib")
+#endif
+
+#ifndef MYICON
+#define MYICON 101 // Same id every sample's D3D.rc uses
+#endif
+
+#define PACING_REPORT_SECONDS 5.0 // Windowed runs log frame pacing this often
+#define RESIZE_DRAG_EVENTS 16     // Size events per frame of the headless --resize-drag
+#define PROFILE_DEFAULT_FILE "Profile.json" // Chrome trace of --profile without a file name
+#define SYNTHETIC_EVENT_INTERVAL_MS 1 // Headless --synthetic-events send one event step a millisecond, like a 1 kHz mouse
+#define SYNTHETIC_DRAG_STEPS 256      // Steps of one synthetic border drag to half size and back
+
+// Renderer and scene initialization time, split out so cold (shaders compiled)
+// and warm (shaders from ShaderCache/) starts can be compared
+static void logStartup(double milliseconds)
+{
+    ShaderCacheStats stats = ShaderCacheGetStats();
+    Log("Startup %.3f ms, shader cache %u hits, %u misses, %.3f ms compiling\n",
+        milliseconds, stats.hits, stats.misses, stats.compileMilliseconds);
+}
+
+// Frame pacing and presentation settings both loops take
+struct PresentOptions
+{
+    bool bVsync;
+    unsigned int frameRateCap;    // FramePacer target, 0 uncapped
+    unsigned int bufferCount;     // RendererDesc::bufferCount, 0 for the default
+    unsigned int maxFrameLatency; // RendererDesc::maxFrameLatency, 0 for the default
+};
+
+// True when argv[i] was one of the PresentOptions; i is left on its last argument
+static bool parsePresentOption(int argc, char **argv, int &i, PresentOptions &options)
+{
+    if (strcmp(argv[i], "--vsync") == 0)
+        options.bVsync = true;
+    else if (strcmp(argv[i], "--no-vsync") == 0)
+        options.bVsync = false;
+    else if (strcmp(argv[i], "--fps-cap") == 0 && i + 1 < argc)
+        options.frameRateCap = (unsigned int)atoi(argv[++i]);
+    else if (strcmp(argv[i], "--buffers") == 0 && i + 1 < argc)
+        options.bufferCount = (unsigned int)atoi(argv[++i]);
+    else if (strcmp(argv[i], "--max-latency") == 0 && i + 1 < argc)
+        options.maxFrameLatency = (unsigned int)atoi(argv[++i]);
+    else
+        return false;
+    return true;
+}
+
+static void applyPresentOptions(const PresentOptions &options, RendererDesc &desc)
+{
+    desc.bVsync = options.bVsync;
+    desc.bufferCount = options.bufferCount;
+    desc.maxFrameLatency = options.maxFrameLatency;
+}
+
+static void logPacing(const FramePacingStatistics &statistics, const PresentOptions &options)
+{
+    Log("Pacing %s, cap %u fps: %u frames, %.3f ms mean, %.3f ms jitter, %.3f ms max, CPU %.1f%%\n",
+        options.bVsync ? "vsync" : "no vsync", options.frameRateCap, statistics.frames, statistics.meanMilliseconds,
+        statistics.jitterMilliseconds, statistics.maxMilliseconds, statistics.cpuUtilization * 100.0);
+}
+
+// Frames queued ahead of the display and input to photon latency, averaged
+// over frames presented and frames seen reaching the screen
+static void logPresentation(unsigned long long queuedFrames, unsigned long long presentedFrames,
+                            unsigned long long displayedFrames, double inputToPhotonMilliseconds, const RendererDesc &desc)
+{
+    Log("Presentation %u buffers, max frame latency %u: %.2f frames queued, input to photon %.3f ms over %llu frames\n",
+        GetPresentBufferCount(desc), GetPresentMaxFrameLatency(desc),
+        presentedFrames ? (double)queuedFrames / presentedFrames : 0.0,
+        displayedFrames ? inputToPhotonMilliseconds / displayedFrames : 0.0, displayedFrames);
+}
+
+// --profile [file.json], true when argv[i] was it; i is left on its last argument
+static bool parseProfileOption(int argc, char **argv, int &i, const char *&profileFile)
+{
+    if (strcmp(argv[i], "--profile") != 0)
+        return false;
+    profileFile = PROFILE_DEFAULT_FILE;
+    if (i + 1 < argc && strncmp(argv[i + 1], "--", 2) != 0)
+        profileFile = argv[++i];
+#if !PROFILER_ENABLED
+    fprintf(stderr, "Built with PROFILER_ENABLED 0, --profile is ignored\n");
+    profileFile = NULL;
+#endif
+    return true;
+}
+
+// --threads N, job threads counting the one running the frame loop; 0 is every core
+static bool parseThreadsOption(int argc, char **argv, int &i, unsigned int &threads)
+{
+    if (strcmp(argv[i], "--threads") != 0 || i + 1 >= argc)
+        return false;
+    threads = (unsigned int)atoi(argv[++i]);
+    return true;
+}
+
+static void logProfile(const ProfilerSummary &summary)
+{
+    Log("Profile %u frames: frame p50/p95/p99 %.3f/%.3f/%.3f ms, CPU %.3f/%.3f/%.3f ms, GPU %.3f/%.3f/%.3f ms over %u frames\n",
+        summary.frames, summary.frameMilliseconds[0], summary.frameMilliseconds[1], summary.frameMilliseconds[2],
+        summary.cpuMilliseconds[0], summary.cpuMilliseconds[1], summary.cpuMilliseconds[2],
+        summary.gpuMilliseconds[0], summary.gpuMilliseconds[1], summary.gpuMilliseconds[2], summary.gpuFrames);
+}
+
+// Peak resident memory of the process so far, its memory high-water mark
+static unsigned long long peakMemoryBytes()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    ZeroMemory((void *)&counters, sizeof(PROCESS_MEMORY_COUNTERS));
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return counters.PeakWorkingSetSize;
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#ifdef __APPLE__
+    return (unsigned long long)usage.ru_maxrss; // bytes
+#else
+    return (unsigned long long)usage.ru_maxrss * 1024; // kilobytes
+#endif
+#endif
+}
+
+// Everything a headless run measured, written by --json
+struct HeadlessResults
+{
+    const char *renderer;
+    int width;
+    int height;
+    double startupMilliseconds;
+    std::vector<double> frameMilliseconds; // Every frame, pacing and resizes included
+    unsigned long long drawCalls;
+    unsigned long long instances;
+    unsigned long long stateChanges;
+    unsigned long long stateCallsIssued;
+    unsigned long long stateCallsFiltered;
+    unsigned long long constantBytesUploaded;
+    unsigned long long constantUploads;
+    unsigned long long bufferBytesUploaded;
+    unsigned long long peakMemoryBytes;
+};
+
+// One JSON object; frame times as mean and nearest rank percentiles, the
+// counters per frame
+static bool writeResults(const char *filePath, HeadlessResults &results)
+{
+    FILE *pFile = fopen(filePath, "w");
+    if (pFile == NULL)
+        return false;
+
+    std::vector<double> &times = results.frameMilliseconds;
+    size_t frames = times.size();
+    double total = 0.0;
+    for (size_t i = 0; i < frames; i++)
+        total += times[i];
+    std::sort(times.begin(), times.end());
+
+    fprintf(pFile, "{\"renderer\": \"%s\", \"width\": %d, \"height\": %d, \"frames\": %u, \"startupMilliseconds\": %.3f,\n",
+            results.renderer, results.width, results.height, (unsigned int)frames, results.startupMilliseconds);
+    fprintf(pFile, " \"frameMilliseconds\": {\"mean\": %.4f, \"min\": %.4f", frames ? total / frames : 0.0, frames ? times[0] : 0.0);
+    static const double ranks[] = {50.0, 90.0, 95.0, 99.0};
+    for (size_t r = 0; r < sizeof(ranks) / sizeof(ranks[0]); r++)
+    {
+        size_t rank = (size_t)ceil(ranks[r] / 100.0 * frames);
+        fprintf(pFile, ", \"p%.0f\": %.4f", ranks[r], frames ? times[std::max(rank, (size_t)1) - 1] : 0.0);
+    }
+    fprintf(pFile, ", \"max\": %.4f},\n", frames ? times[frames - 1] : 0.0);
+    double perFrame = frames ? 1.0 / frames : 0.0;
+    fprintf(pFile, " \"drawCallsPerFrame\": %.2f, \"instancesPerFrame\": %.2f, \"stateChangesPerFrame\": %.2f,\n \"stateCallsIssuedPerFrame\": %.2f, \"stateCallsFilteredPerFrame\": %.2f, \"constantBytesPerFrame\": %.1f, \"constantUploadsPerFrame\": %.2f, \"bufferBytesPerFrame\": %.1f,\n",
+            results.drawCalls * perFrame, results.instances * perFrame, results.stateChanges * perFrame,
+            results.stateCallsIssued * perFrame, results.stateCallsFiltered * perFrame,
+            results.constantBytesUploaded * perFrame,
+            results.constantUploads * perFrame, results.bufferBytesUploaded * perFrame);
+    fprintf(pFile, " \"peakMemoryBytes\": %llu}\n", results.peakMemoryBytes);
+
+    bool bWritten = ferror(pFile) == 0;
+    fclose(pFile);
+    return bWritten;
+}
+
+// Run the simulation steps that are due after elapsedSeconds, then draw the
+// state interpolated between the last two of them
+static void runFrame(Scene *pScene, Renderer *pRenderer, SimulationClock &simulationClock, double elapsedSeconds)
+{
+    ProfilerBeginFrame();
+    {
+        PROFILE_SCOPE("WaitForFrameSlot");
+        pRenderer->WaitForFrameSlot();
+    }
+    {
+        PROFILE_SCOPE("Update");
+        unsigned int steps = simulationClock.Advance(elapsedSeconds);
+        for (unsigned int i = 0; i < steps; i++)
+        {
+            PROFILE_SCOPE("Step");
+            pScene->Update(simulationClock.GetStepSeconds());
+        }
+        pScene->Interpolate(simulationClock.GetAlpha());
+    }
+    {
+        PROFILE_SCOPE("Render");
+        pScene->Render(pRenderer);
+    }
+    {
+        PROFILE_SCOPE("Present");
+        pRenderer->Present();
+    }
+    ProfilerEndFrame();
+}
+
+// Window size changes. Dragging a border or toggling fullscreen sends a storm
+// of WM_SIZE, so they only record the size and the loop applies the last one
+// once per frame; sizes already applied and a minimized window's 0 x 0 are skipped
+struct PendingResize
+{
+    int width;
+    int height;
+    bool bPending;
+    bool bFailed; // The last Resize() failed, it stays pending and no frame is drawn
+    int appliedWidth;
+    int appliedHeight;
+
+    // Counted for the resize report
+    unsigned int events;
+    unsigned int applied;
+    double stallMilliseconds; // Spent in Renderer::Resize() and Scene::Resize()
+};
+
+static void initializeResize(PendingResize &resize, int width, int height)
+{
+    memset(&resize, 0, sizeof(PendingResize));
+    resize.appliedWidth = width;
+    resize.appliedHeight = height;
+}
+
+static void requestResize(PendingResize &resize, int width, int height)
+{
+    resize.width = width;
+    resize.height = height;
+    resize.bPending = true;
+    resize.events++;
+}
+
+// 0 on success, like Renderer::Resize(); a failure is logged once and kept
+// pending, the renderer may have released its render target so the caller
+// skips the frame and the next one retries
+static int applyResize(PendingResize &resize, Renderer *pRenderer, Scene *pScene)
+{
+    if (!resize.bPending)
+        return 0;
+    if (resize.width <= 0 || resize.height <= 0 ||
+        (!resize.bFailed && resize.width == resize.appliedWidth && resize.height == resize.appliedHeight))
+    {
+        resize.bPending = false;
+        return 0;
+    }
+
+    unsigned long long start = ClockTicks();
+    int result = pRenderer->Resize(resize.width, resize.height);
+    resize.stallMilliseconds += ClockSeconds(ClockTicks() - start) * 1000.0;
+    if (result != 0)
+    {
+        if (!resize.bFailed)
+            LogError("Resize Failed\n");
+        resize.bFailed = true;
+        return result;
+    }
+
+    pScene->Resize(resize.width, resize.height);
+    resize.appliedWidth = resize.width;
+    resize.appliedHeight = resize.height;
+    resize.bPending = false;
+    resize.bFailed = false;
+    resize.applied++;
+    return result;
+}
+
+// Window thread to frame loop
+static EventQueue gEventQueue;
+
+static AppEvent appEvent(AppEventType type)
+{
+    AppEvent event;
+    memset(&event, 0, sizeof(AppEvent));
+    event.type = type;
+    return event;
+}
+
+// For events that must arrive, a quit or the synthetic script, wait for the
+// frame loop to make room instead of dropping them
+static void pushEventWaiting(const AppEvent &event)
+{
+    while (!gEventQueue.Push(event))
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+// What the window's events change, owned by the frame loop
+struct WindowState
+{
+    bool bActive;
+    bool bPaused;          // 'P', the simulation stops but frames are still drawn
+    bool bQuit;
+    unsigned int captures; // 'C' presses, numbering CaptureN.bmp
+
+    // Counted for the event report
+    unsigned int events;
+    double latencyMilliseconds; // Push() to handling, summed
+    double maxLatencyMilliseconds;
+};
+
+static void initializeWindowState(WindowState &state, bool bActive)
+{
+    memset(&state, 0, sizeof(WindowState));
+    state.bActive = bActive;
+}
+
+// Everything the window thread queued before the call; later events wait for
+// the next one, so a window thread sending faster than they are handled cannot
+// keep the frame loop here. Sizes are only recorded for applyResize() before
+// the next frame, unless bCoalesceResize is off and every one is applied as it
+// arrives
+static void handleEvents(WindowState &state, PendingResize &resize, Renderer *pRenderer, Scene *pScene, bool bCoalesceResize)
+{
+    unsigned long long callTicks = ClockTicks();
+    AppEvent event;
+    while (gEventQueue.Pop(event, callTicks))
+    {
+        double latencyMilliseconds = ClockSeconds(ClockTicks() - event.ticks) * 1000.0;
+        state.events++;
+        state.latencyMilliseconds += latencyMilliseconds;
+        state.maxLatencyMilliseconds = std::max(state.maxLatencyMilliseconds, latencyMilliseconds);
+
+        switch (event.type)
+        {
+        case APP_EVENT_KEY_DOWN:
+            if (event.key == 'P') // Pause or resume the simulation on 'P' key press
+            {
+                state.bPaused = !state.bPaused;
+            }
+            else if (event.key == 'C') // Capture the next frame to CaptureN.bmp on 'C' key press
+            {
+                char filePath[32];
+                snprintf(filePath, sizeof(filePath), "Capture%u.bmp", state.captures++);
+                pRenderer->QueueCapture(filePath);
+            }
+            else
+            {
+                pScene->OnKeyDown(event.key);
+            }
+            break;
+        case APP_EVENT_RESIZE:
+            requestResize(resize, event.width, event.height);
+            if (!bCoalesceResize)
+                applyResize(resize, pRenderer, pScene);
+            break;
+        case APP_EVENT_FOCUS:
+            state.bActive = event.bActive;
+            break;
+        case APP_EVENT_QUIT:
+            state.bQuit = true;
+            break;
+        }
+    }
+}
+
+static void logEvents(const WindowState &state)
+{
+    Log("Events %u handled, %llu dropped, queue latency %.3f ms mean, %.3f ms max\n", state.events,
+        gEventQueue.GetDroppedCount(), state.events ? state.latencyMilliseconds / state.events : 0.0,
+        state.maxLatencyMilliseconds);
+}
+
+#ifdef _WIN32
+
+#define WM_APP_DESTROY (WM_APP + 1) // The frame loop has released the window
+
+// Window state of the window thread
+static HWND ghwnd = NULL;
+static BOOL gbFullscreen = FALSE;
+static DWORD dwStyle = 0;
+static WINDOWPLACEMENT wpPrev = {sizeof(WINDOWPLACEMENT)};
+static bool gbQueueEvents = false; // Windowed runs; nothing reads the hidden window of a headless run
+static std::atomic<bool> gbWindowClosed(false); // The window thread's message loop has ended
+
+// Toggle fullscreen mode
+static void ToggleFullscreen()
+{
+    MONITORINFO mi = {sizeof(MONITORINFO)};
+    if (!gbFullscreen)
+    {
+        dwStyle = GetWindowLong(ghwnd, GWL_STYLE);
+        if (dwStyle & WS_OVERLAPPEDWINDOW)
+        {
+            if (GetWindowPlacement(ghwnd, &wpPrev) && GetMonitorInfo(MonitorFromWindow(ghwnd, MONITORINFOF_PRIMARY), &mi))
+            {
+                SetWindowLong(ghwnd, GWL_STYLE, dwStyle & ~WS_OVERLAPPEDWINDOW);
+                SetWindowPos(ghwnd, HWND_TOP, mi.rcMonitor.left, mi.rcMonitor.top,
+                             mi.rcMonitor.right - mi.rcMonitor.left, mi.rcMonitor.bottom - mi.rcMonitor.top,
+                             SWP_NOZORDER | SWP_FRAMECHANGED);
+            }
+        }
+        ShowCursor(FALSE);
+        gbFullscreen = TRUE;
+    }
+    else
+    {
+        SetWindowPlacement(ghwnd, &wpPrev);
+        SetWindowLong(ghwnd, GWL_STYLE, dwStyle | WS_OVERLAPPEDWINDOW);
+        SetWindowPos(ghwnd, HWND_TOP, 0, 0, 0, 0,
+                     SWP_NOMOVE | SWP_NOSIZE | SWP_NOZORDER | SWP_FRAMECHANGED);
+        ShowCursor(TRUE);
+        gbFullscreen = FALSE;
+    }
+}
+
+// Window Procedure
+// Runs on the window thread and only queues what the frame loop needs to know,
+// so it returns at once even while a frame is being drawn
+LRESULT CALLBACK WndProc(HWND hwnd, UINT iMsg, WPARAM wParam, LPARAM lParam)
+{
+    if (!gbQueueEvents)
+        return DefWindowProc(hwnd, iMsg, wParam, lParam);
+
+    AppEvent event;
+    switch (iMsg)
+    {
+    case WM_SETFOCUS:
+    case WM_KILLFOCUS:
+        event = appEvent(APP_EVENT_FOCUS); // The frame loop only draws while the window has focus
+        event.bActive = iMsg == WM_SETFOCUS;
+        gEventQueue.Push(event);
+        break;
+    case WM_SIZE:
+        // Resize before the next frame; a border drag runs a modal loop in
+        // DefWindowProc on this thread while the frame loop keeps drawing
+        event = appEvent(APP_EVENT_RESIZE);
+        event.width = LOWORD(lParam);
+        event.height = HIWORD(lParam);
+        gEventQueue.Push(event);
+        break;
+    case WM_KEYDOWN:
+        if (wParam == VK_ESCAPE) // Exit on ESC key press
+        {
+            pushEventWaiting(appEvent(APP_EVENT_QUIT));
+        }
+        else if (wParam == 'F') // Toggle fullscreen on 'F' key press
+        {
+            ToggleFullscreen();
+        }
+        else
+        {
+            event = appEvent(APP_EVENT_KEY_DOWN);
+            event.key = (unsigned int)wParam;
+            gEventQueue.Push(event);
+        }
+        break;
+    case WM_CLOSE:
+        // The frame loop releases the swap chain first, then sends WM_APP_DESTROY
+        pushEventWaiting(appEvent(APP_EVENT_QUIT));
+        break;
+    case WM_APP_DESTROY:
+        if (gbFullscreen == TRUE)
+            ToggleFullscreen();
+        DestroyWindow(hwnd); // Destroy window once the frame loop is done with it
+        break;
+    case WM_DESTROY:
+        PostQuitMessage(0); // Post quit message
+        break;
+    default:
+        return DefWindowProc(hwnd, iMsg, wParam, lParam); // Default message handling
+    }
+    return 0;
+}
+
+// Define, register and create the application window
+static HWND createAppWindow(HINSTANCE hInstance)
+{
+    WNDCLASSEX wndclass = {sizeof(WNDCLASSEX)};
+    wndclass.style = CS_HREDRAW | CS_VREDRAW | CS_OWNDC;
+    wndclass.cbClsExtra = 0;
+    wndclass.cbWndExtra = 0;
+    wndclass.lpfnWndProc = WndProc;
+    wndclass.hInstance = hInstance;
+    wndclass.hbrBackground = NULL;
+    wndclass.hIcon = LoadIcon(hInstance, MAKEINTRESOURCE(MYICON));
+    wndclass.hCursor = LoadCursor(NULL, IDC_ARROW);
+    wndclass.lpszClassName = TEXT("D3D11App");
+    wndclass.lpszMenuName = NULL;
+    wndclass.hIconSm = LoadIcon(hInstance, MAKEINTRESOURCE(MYICON));
+
+    RegisterClassEx(&wndclass);
+
+    return CreateWindow(TEXT("D3D11App"), TEXT("D3D11 Application"),
+                        WS_OVERLAPPEDWINDOW, CW_USEDEFAULT, CW_USEDEFAULT,
+                        WIN_WIDTH, WIN_HEIGHT, NULL, NULL, hInstance, NULL);
+}
+
+// Window thread: creates the window and pumps its messages until the frame
+// loop is done with it; *pCreated gets the window, NULL when creation failed
+static void windowThread(HINSTANCE hInstance, int iCmdShow, std::promise<HWND> *pCreated)
+{
+    ghwnd = createAppWindow(hInstance);
+    pCreated->set_value(ghwnd);
+    if (ghwnd == NULL)
+        return;
+
+    ShowWindow(ghwnd, iCmdShow);
+    UpdateWindow(ghwnd);
+
+    // Message loop, blocks in GetMessage since nothing else runs on this thread
+    MSG msg;
+    while (GetMessage(&msg, NULL, 0, 0) > 0)
+    {
+        TranslateMessage(&msg);
+        DispatchMessage(&msg);
+    }
+    gbWindowClosed.store(true);
+}
+
+// Have the window thread destroy the window and wait for it to finish; what
+// it still queues is dropped, so a quit waiting for room cannot hold it up
+static void closeWindow(HWND hwnd, std::thread &windowThreadHandle)
+{
+    PostMessage(hwnd, WM_APP_DESTROY, 0, 0);
+    AppEvent event;
+    while (!gbWindowClosed.load())
+    {
+        if (!gEventQueue.Pop(event))
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    windowThreadHandle.join();
+}
+
+// Entry Point
+// The window lives on its own thread and this one runs the frame loop, so
+// dragging a border or any other long message does not stop the drawing
+int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpszCmdLine, int iCmdShow)
+{
+    (void)hPrevInstance;
+
+    if (strstr(lpszCmdLine, "--headless") != NULL)
+        return RunHeadless(__argc, __argv);
+
+    LogInitialize("Log.txt");
+
+    gbQueueEvents = true;
+    std::promise<HWND> windowCreated;
+    std::future<HWND> window = windowCreated.get_future();
+    std::thread windowThreadHandle(windowThread, hInstance, iCmdShow, &windowCreated);
+    HWND hwnd = window.get();
+    if (hwnd == NULL)
+    {
+        LogError("CreateWindow Failed\n");
+        windowThreadHandle.join();
+        LogCleanup();
+        return 0;
+    }
+
+    // Create the renderer with the settings the scene asks for
+    RendererDesc rendererDesc;
+    ZeroMemory((void *)&rendererDesc, sizeof(RendererDesc));
+    rendererDesc.width = WIN_WIDTH;
+    rendererDesc.height = WIN_HEIGHT;
+
+    // Vsync on by default, the other options like headless runs
+    PresentOptions presentOptions;
+    memset(&presentOptions, 0, sizeof(PresentOptions));
+    presentOptions.bVsync = true;
+    const char *profileFile = NULL;
+    unsigned int threads = 0;
+
+    Scene *pScene = CreateScene();
+    for (int i = 1; i < __argc; i++)
+    {
+        if (parsePresentOption(__argc, __argv, i, presentOptions) || parseProfileOption(__argc, __argv, i, profileFile) ||
+            parseThreadsOption(__argc, __argv, i, threads))
+            continue;
+
+        // "--name [value]" reaches the scene like it does in headless runs
+        if (strncmp(__argv[i], "--", 2) != 0 || __argv[i][2] == '\0')
+            continue;
+        const char *value = (i + 1 < __argc && strncmp(__argv[i + 1], "--", 2) != 0) ? __argv[i + 1] : NULL;
+        if (!pScene->SetOption(__argv[i] + 2, value))
+            LogWarning("Unknown option %s\n", __argv[i]);
+        if (value)
+            i++;
+    }
+    applyPresentOptions(presentOptions, rendererDesc);
+    pScene->GetRendererDesc(rendererDesc);
+
+    std::chrono::steady_clock::time_point startupStart = std::chrono::steady_clock::now();
+    JobsInitialize(threads);
+    Log("Job system started with %u threads\n", JobsGetThreadCount());
+    Renderer *pRenderer = CreateRenderer(RENDERER_D3D11);
+    if (pRenderer->Initialize(hwnd, rendererDesc) != 0 || pScene->Initialize(pRenderer) != 0)
+    {
+        MessageBox(hwnd, TEXT("Initialization failed"), TEXT("Error"), MB_OK | MB_ICONERROR);
+        delete pScene;
+        delete pRenderer;
+        JobsCleanup();
+        closeWindow(hwnd, windowThreadHandle);
+        LogCleanup();
+        return 0;
+    }
+    pScene->Resize(WIN_WIDTH, WIN_HEIGHT);
+    logStartup(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startupStart).count());
+
+    // Key presses and sizes queued during startup are handled before the first
+    // frame. The client area is smaller than the window, so that frame already
+    // resizes once
+    ProfilerSetEnabled(profileFile != NULL);
+    RECT clientRect;
+    GetClientRect(hwnd, &clientRect);
+    PendingResize pendingResize;
+    initializeResize(pendingResize, WIN_WIDTH, WIN_HEIGHT);
+    requestResize(pendingResize, clientRect.right - clientRect.left, clientRect.bottom - clientRect.top);
+    WindowState windowState;
+    initializeWindowState(windowState, false);
+
+    // The simulation only runs while the window is active and not paused;
+    // time spent inactive is dropped, not caught up when focus returns
+    SimulationClock simulationClock;
+    unsigned long long lastTicks = ClockTicks();
+
+    FramePacer framePacer;
+    framePacer.SetTargetFrameRate(presentOptions.frameRateCap);
+    unsigned long long lastPacingReport = ClockTicks();
+    unsigned int resizeAllocations = 0;
+    unsigned long long queuedFrames = 0, presentedFrames = 0, displayedFrames = 0;
+    double inputToPhotonMilliseconds = 0.0;
+
+    // Frame loop, until ESC or closing the window queues APP_EVENT_QUIT
+    while (!windowState.bQuit)
+    {
+        if (!windowState.bActive)
+        {
+            // Nothing is drawn until focus returns, so sleep until the window
+            // thread queues an event; the time asleep is not simulated
+            gEventQueue.Wait();
+            handleEvents(windowState, pendingResize, pRenderer, pScene, true);
+            lastTicks = ClockTicks();
+            framePacer.Reset();
+            continue;
+        }
+
+        framePacer.Wait();
+
+        // Events queued up to now reach the frame that samples its input next
+        handleEvents(windowState, pendingResize, pRenderer, pScene, true);
+        if (windowState.bQuit || !windowState.bActive)
+            continue;
+        if (applyResize(pendingResize, pRenderer, pScene) != 0)
+            continue;
+
+        unsigned long long ticks = ClockTicks();
+        double elapsedSeconds = ClockSeconds(ticks - lastTicks);
+        lastTicks = ticks;
+        simulationClock.SetPaused(windowState.bPaused);
+        runFrame(pScene, pRenderer, simulationClock, elapsedSeconds);
+
+        const RendererStatistics &statistics = pRenderer->GetStatistics();
+        resizeAllocations += statistics.resizeAllocations;
+        queuedFrames += statistics.queuedFrames;
+        presentedFrames++;
+        displayedFrames += statistics.displayedFrames;
+        inputToPhotonMilliseconds += statistics.inputToPhotonMilliseconds;
+
+        if (ClockSeconds(ticks - lastPacingReport) >= PACING_REPORT_SECONDS)
+        {
+            FramePacingStatistics pacingStatistics;
+            framePacer.GetStatistics(pacingStatistics);
+            logPacing(pacingStatistics, presentOptions);
+            framePacer.ResetStatistics();
+            logPresentation(queuedFrames, presentedFrames, displayedFrames, inputToPhotonMilliseconds, rendererDesc);
+            queuedFrames = presentedFrames = displayedFrames = 0;
+            inputToPhotonMilliseconds = 0.0;
+            if (pendingResize.events > 0)
+            {
+                Log("Resize %u events, %u applied, %u allocations, %.3f ms stalled\n", pendingResize.events,
+                    pendingResize.applied, resizeAllocations, pendingResize.stallMilliseconds);
+                pendingResize.events = pendingResize.applied = 0;
+                pendingResize.stallMilliseconds = 0.0;
+                resizeAllocations = 0;
+            }
+            if (windowState.events > 0)
+            {
+                logEvents(windowState);
+                windowState.events = 0;
+                windowState.latencyMilliseconds = windowState.maxLatencyMilliseconds = 0.0;
+            }
+            if (profileFile)
+            {
+                ProfilerSummary profilerSummary;
+                ProfilerGetSummary(profilerSummary);
+                logProfile(profilerSummary);
+            }
+            lastPacingReport = ticks;
+        }
+    }
+
+    // The trace holds the last PROFILER_FRAMES frames
+    if (profileFile && !ProfilerWriteTrace(profileFile))
+        LogError("ProfilerWriteTrace Failed\n");
+    ProfilerSetEnabled(false);
+
+    pScene->Cleanup();
+    delete pScene;
+    pRenderer->Cleanup();
+    delete pRenderer;
+    JobsCleanup();
+
+    // The swap chain is gone, the window thread may destroy the window now
+    closeWindow(hwnd, windowThreadHandle);
+    LogCleanup();
+
+    return 0;
+}
+
+#else
+
+// Entry Point
+int main(int argc, char **argv)
+{
+    return RunHeadless(argc, argv);
+}
+
+#endif // _WIN32
+
+// Window thread of a headless --synthetic-events run. Every step is one size
+// of a border drag to half size and back; the focus goes for 10 steps in every
+// 100 and 'L' is pressed every 32. Once the frame loop has drawn all but its
+// last frame the full size, the focus and an even number of presses are
+// restored before the quit, so the last frame matches a run without events.
+static void syntheticEventSource(int width, int height, int frames, const std::atomic<int> *pFramesDrawn)
+{
+    unsigned int keyPresses = 0;
+    AppEvent event;
+    for (unsigned int step = 0; pFramesDrawn->load(std::memory_order_acquire) < frames - 1; step++)
+    {
+        double t = (double)(step % SYNTHETIC_DRAG_STEPS) / SYNTHETIC_DRAG_STEPS;
+        double scale = 0.5 + fabs(t - 0.5);
+        event = appEvent(APP_EVENT_RESIZE);
+        event.width = (int)(width * scale + 0.5);
+        event.height = (int)(height * scale + 0.5);
+        pushEventWaiting(event);
+
+        if (step % 100 == 50 || step % 100 == 60)
+        {
+            event = appEvent(APP_EVENT_FOCUS);
+            event.bActive = step % 100 == 60;
+            pushEventWaiting(event);
+        }
+        if (step % 32 == 0)
+        {
+            event = appEvent(APP_EVENT_KEY_DOWN);
+            event.key = 'L';
+            pushEventWaiting(event);
+            keyPresses++;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(SYNTHETIC_EVENT_INTERVAL_MS));
+    }
+
+    event = appEvent(APP_EVENT_RESIZE);
+    event.width = width;
+    event.height = height;
+    pushEventWaiting(event);
+    event = appEvent(APP_EVENT_FOCUS);
+    event.bActive = true;
+    pushEventWaiting(event);
+    if (keyPresses % 2 != 0)
+    {
+        event = appEvent(APP_EVENT_KEY_DOWN);
+        event.key = 'L';
+        pushEventWaiting(event);
+    }
+    pushEventWaiting(appEvent(APP_EVENT_QUIT));
+}
+
+// Every return once LogInitialize() has run, so the log writer thread is
+// joined before the process exits; bJobs once JobsInitialize() has run
+static int exitHeadless(int result, Scene *pScene, Renderer *pRenderer, bool bJobs)
+{
+    delete pScene;
+    delete pRenderer;
+    if (bJobs)
+        JobsCleanup();
+    LogCleanup();
+    return result;
+}
+
+static void printHeadlessUsage(const char *program)
+{
+    fprintf(stderr, "Usage: %s [--renderer d3d11|software|null] [--frames N] [--width W] [--height H] [--output file.bmp] [--capture-interval N] [--json results.json] [--cold-start] [--simulation-rate N] [--frame-rate N] [--real-time] [--resize-drag] [--no-coalesce] [--synthetic-events] [--vsync] [--fps-cap N] [--buffers N] [--max-latency N] [--profile [file.json]] [--threads N] [--option [value] ...]\n", program);
+}
+
+// Render a fixed number of frames without a visible window
+int RunHeadless(int argc, char **argv)
+{
+    RendererType rendererType = RENDERER_SOFTWARE;
+    int frames = 100;
+    int width = WIN_WIDTH;
+    int height = WIN_HEIGHT;
+    const char *outputFile = NULL;
+    int captureInterval = 0; // Also capture every Nth frame next to outputFile
+    const char *resultsFile = NULL;
+    bool bColdStart = false;
+    unsigned int simulationRate = SIMULATION_RATE;
+    unsigned int frameRate = 0; // Simulated frames per second, simulationRate when 0
+    bool bRealTime = false;
+    bool bResizeDrag = false;
+    bool bCoalesceResize = true;
+    bool bSyntheticEvents = false;
+    const char *profileFile = NULL;
+    unsigned int threads = 0; // Every core
+    PresentOptions presentOptions;
+    memset(&presentOptions, 0, sizeof(PresentOptions));
+    std::vector<int> sceneOptions; // argv index of every option left for the scene
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--headless") == 0)
+            continue;
+        else if (strcmp(argv[i], "--renderer") == 0 && i + 1 < argc)
+        {
+            const char *name = argv[++i];
+            if (strcmp(name, "d3d11") == 0)
+                rendererType = RENDERER_D3D11;
+            else if (strcmp(name, "null") == 0)
+                rendererType = RENDERER_NULL;
+            else if (strcmp(name, "software") == 0)
+                rendererType = RENDERER_SOFTWARE;
+            else
+            {
+                fprintf(stderr, "Unknown renderer %s\n", name);
+                printHeadlessUsage(argv[0]);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+            frames = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--width") == 0 && i + 1 < argc)
+            width = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--height") == 0 && i + 1 < argc)
+            height = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+            outputFile = argv[++i];
+        else if (strcmp(argv[i], "--capture-interval") == 0 && i + 1 < argc)
+            captureInterval = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            resultsFile = argv[++i];
+        else if (strcmp(argv[i], "--cold-start") == 0)
+            bColdStart = true;
+        else if (strcmp(argv[i], "--simulation-rate") == 0 && i + 1 < argc)
+            simulationRate = (unsigned int)atoi(argv[++i]);
+        else if (strcmp(argv[i], "--frame-rate") == 0 && i + 1 < argc)
+            frameRate = (unsigned int)atoi(argv[++i]);
+        else if (strcmp(argv[i], "--real-time") == 0)
+            bRealTime = true;
+        else if (strcmp(argv[i], "--resize-drag") == 0)
+            bResizeDrag = true;
+        else if (strcmp(argv[i], "--no-coalesce") == 0)
+            bCoalesceResize = false;
+        else if (strcmp(argv[i], "--synthetic-events") == 0)
+            bSyntheticEvents = true;
+        else if (parsePresentOption(argc, argv, i, presentOptions) || parseProfileOption(argc, argv, i, profileFile) ||
+                 parseThreadsOption(argc, argv, i, threads))
+            continue;
+        else if (strncmp(argv[i], "--", 2) == 0 && argv[i][2] != '\0')
+        {
+            sceneOptions.push_back(i);
+            if (i + 1 < argc && strncmp(argv[i + 1], "--", 2) != 0)
+                i++; // Its value
+        }
+        else
+        {
+            printHeadlessUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (frames < 1)
+        frames = 1;
+    if (width < 1)
+        width = 1;
+    if (height < 1)
+        height = 1;
+    if (simulationRate < 1)
+        simulationRate = SIMULATION_RATE;
+    if (frameRate < 1)
+        frameRate = simulationRate;
+
+    LogInitialize("Log.txt");
+    if (bColdStart)
+        ShaderCacheClear();
+
+    void *pNativeWindow = NULL;
+#ifdef _WIN32
+    // The D3D11 swap chain still needs a window, it is simply never shown
+    if (rendererType == RENDERER_D3D11)
+    {
+        ghwnd = createAppWindow(GetModuleHandle(NULL));
+        pNativeWindow = ghwnd;
+    }
+#endif
+
+    Renderer *pRenderer = CreateRenderer(rendererType);
+    if (pRenderer == NULL)
+    {
+        fprintf(stderr, "Renderer %s is not available on this platform\n", GetRendererName(rendererType));
+        return exitHeadless(1, NULL, NULL, false);
+    }
+
+    RendererDesc rendererDesc;
+    memset(&rendererDesc, 0, sizeof(rendererDesc));
+    rendererDesc.width = width;
+    rendererDesc.height = height;
+    applyPresentOptions(presentOptions, rendererDesc);
+
+    Scene *pScene = CreateScene();
+    for (size_t i = 0; i < sceneOptions.size(); i++)
+    {
+        int index = sceneOptions[i];
+        const char *value = (index + 1 < argc && strncmp(argv[index + 1], "--", 2) != 0) ? argv[index + 1] : NULL;
+        if (!pScene->SetOption(argv[index] + 2, value))
+        {
+            fprintf(stderr, "Unknown option %s\n", argv[index]);
+            return exitHeadless(1, pScene, pRenderer, false);
+        }
+    }
+    pScene->GetRendererDesc(rendererDesc);
+
+    std::chrono::steady_clock::time_point startupStart = std::chrono::steady_clock::now();
+    JobsInitialize(threads);
+    Log("Job system started with %u threads\n", JobsGetThreadCount());
+    if (pRenderer->Initialize(pNativeWindow, rendererDesc) != 0 || pScene->Initialize(pRenderer) != 0)
+    {
+        fprintf(stderr, "Initialization failed, see Log.txt\n");
+        return exitHeadless(1, pScene, pRenderer, true);
+    }
+    pScene->Resize(width, height);
+    double startupMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startupStart).count();
+    logStartup(startupMilliseconds);
+
+    ShaderCacheStats shaderCacheStats = ShaderCacheGetStats();
+    printf("startup %.3f ms, shader cache %u hits, %u misses, %.3f ms compiling\n",
+           startupMilliseconds, shaderCacheStats.hits, shaderCacheStats.misses, shaderCacheStats.compileMilliseconds);
+
+    unsigned long long constantBytesUploaded = 0;
+    unsigned int constantUploads = 0;
+    unsigned long long bufferBytesUploaded = 0;
+    std::vector<double> frameMilliseconds;
+    frameMilliseconds.reserve(frames);
+    unsigned long long drawCalls = 0;
+    unsigned long long instances = 0;
+    unsigned long long stateChanges = 0, stateCallsIssued = 0, stateCallsFiltered = 0;
+    unsigned long long queuedFrames = 0, displayedFrames = 0;
+    double inputToPhotonMilliseconds = 0.0;
+    unsigned int resizeAllocations = 0;
+    unsigned int capturesWritten = 0, captureStalls = 0;
+    bool bCaptured = false;
+    PendingResize pendingResize;
+    initializeResize(pendingResize, width, height);
+
+    // Every frame stands for 1 / frameRate seconds unless --real-time asks for
+    // the measured time, so by default the output does not depend on how fast
+    // the backend draws
+    SimulationClock simulationClock(simulationRate);
+    unsigned long long lastTicks = ClockTicks();
+    FramePacer framePacer;
+    framePacer.SetTargetFrameRate(presentOptions.frameRateCap);
+    ProfilerSetEnabled(profileFile != NULL);
+
+    // --synthetic-events: this thread runs the frame loop like WinMain's and
+    // another one queues the events a window thread would
+    WindowState windowState;
+    initializeWindowState(windowState, true);
+    std::atomic<int> framesDrawn(0);
+    std::thread eventSource;
+    if (bSyntheticEvents)
+        eventSource = std::thread(syntheticEventSource, width, height, frames, &framesDrawn);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        // Nothing is drawn without focus, and the last frame waits for the
+        // source's quit so it is drawn at the size the source ends on
+        if (bSyntheticEvents)
+        {
+            for (;;)
+            {
+                handleEvents(windowState, pendingResize, pRenderer, pScene, bCoalesceResize);
+                if (windowState.bQuit || (windowState.bActive && frame < frames - 1))
+                    break;
+                gEventQueue.Wait();
+                lastTicks = ClockTicks();
+                framePacer.Reset();
+            }
+            simulationClock.SetPaused(windowState.bPaused);
+        }
+
+        unsigned long long frameStart = ClockTicks();
+        framePacer.Wait();
+
+        // A scripted border drag, RESIZE_DRAG_EVENTS sizes a frame shrinking the
+        // window to half and growing it back so the last frame has the full size;
+        // --no-coalesce resizes on every event the way WM_SIZE used to
+        if (bResizeDrag)
+        {
+            for (int event = 1; event <= RESIZE_DRAG_EVENTS; event++)
+            {
+                double t = (double)(frame * RESIZE_DRAG_EVENTS + event) / (frames * RESIZE_DRAG_EVENTS);
+                double scale = 0.5 + fabs(t - 0.5);
+                requestResize(pendingResize, (int)(width * scale + 0.5), (int)(height * scale + 0.5));
+                if (!bCoalesceResize)
+                    applyResize(pendingResize, pRenderer, pScene);
+            }
+        }
+        if (applyResize(pendingResize, pRenderer, pScene) != 0)
+        {
+            framesDrawn.store(frame + 1, std::memory_order_release);
+            continue;
+        }
+
+        // The last frame goes to outputFile, every captureInterval-th one to
+        // outputFile_<frame>.bmp; they are written while later frames render
+        if (outputFile && frame == frames - 1)
+            bCaptured = pRenderer->QueueCapture(outputFile);
+        else if (outputFile && captureInterval > 0 && frame % captureInterval == 0)
+        {
+            std::string filePath(outputFile);
+            size_t extension = filePath.rfind(".bmp");
+            if (extension != std::string::npos)
+                filePath.erase(extension);
+            char suffix[32];
+            snprintf(suffix, sizeof(suffix), "_%d.bmp", frame);
+            pRenderer->QueueCapture((filePath + suffix).c_str());
+        }
+
+        unsigned long long ticks = ClockTicks();
+        double elapsedSeconds = bRealTime ? ClockSeconds(ticks - lastTicks) : 1.0 / frameRate;
+        lastTicks = ticks;
+        runFrame(pScene, pRenderer, simulationClock, elapsedSeconds);
+
+        const RendererStatistics &statistics = pRenderer->GetStatistics();
+        constantBytesUploaded += statistics.constantBytesUploaded;
+        constantUploads += statistics.constantUploads;
+        bufferBytesUploaded += statistics.bufferBytesUploaded;
+        drawCalls += statistics.drawCalls;
+        instances += statistics.instances;
+        stateChanges += statistics.stateChanges;
+        stateCallsIssued += statistics.stateCallsIssued;
+        stateCallsFiltered += statistics.stateCallsFiltered;
+        queuedFrames += statistics.queuedFrames;
+        displayedFrames += statistics.displayedFrames;
+        inputToPhotonMilliseconds += statistics.inputToPhotonMilliseconds;
+        resizeAllocations += statistics.resizeAllocations;
+        capturesWritten += statistics.capturesWritten;
+        captureStalls += statistics.captureStalls;
+        frameMilliseconds.push_back(ClockSeconds(ClockTicks() - frameStart) * 1000.0);
+        framesDrawn.store(frame + 1, std::memory_order_release);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (bSyntheticEvents)
+        eventSource.join();
+
+    printf("renderer %s, %dx%d, %d frames, %.3f ms/frame, %.1f fps\n",
+           GetRendererName(rendererType), width, height, frames,
+           seconds * 1000.0 / frames, frames / seconds);
+    printf("constants %.1f bytes/frame in %.2f uploads/frame\n",
+           (double)constantBytesUploaded / frames, (double)constantUploads / frames);
+    printf("draws %.1f/frame, instances %.1f/frame, state changes %.1f/frame\n",
+           (double)drawCalls / frames, (double)instances / frames, (double)stateChanges / frames);
+    printf("state filter %.1f bindings/frame issued, %.1f/frame filtered as redundant\n",
+           (double)stateCallsIssued / frames, (double)stateCallsFiltered / frames);
+    unsigned long long memoryBytes = peakMemoryBytes();
+    printf("memory %.1f MB peak\n", memoryBytes / (1024.0 * 1024.0));
+    printf("simulation %llu steps at %u Hz, %.3f s simulated, %llu steps dropped\n",
+           simulationClock.GetSteps(), simulationRate, simulationClock.GetSimulatedSeconds(), simulationClock.GetDroppedSteps());
+
+    FramePacingStatistics pacingStatistics;
+    framePacer.GetStatistics(pacingStatistics);
+    logPacing(pacingStatistics, presentOptions);
+    printf("pacing %s, cap %u fps: %.3f ms mean, %.3f ms jitter, %.3f ms max, CPU %.1f%%\n",
+           presentOptions.bVsync ? "vsync" : "no vsync", presentOptions.frameRateCap, pacingStatistics.meanMilliseconds,
+           pacingStatistics.jitterMilliseconds, pacingStatistics.maxMilliseconds, pacingStatistics.cpuUtilization * 100.0);
+    logPresentation(queuedFrames, frames, displayedFrames, inputToPhotonMilliseconds, rendererDesc);
+    printf("presentation %u buffers, max frame latency %u: %.2f frames queued, input to photon %.3f ms\n",
+           GetPresentBufferCount(rendererDesc), GetPresentMaxFrameLatency(rendererDesc), (double)queuedFrames / frames,
+           displayedFrames ? inputToPhotonMilliseconds / displayedFrames : 0.0);
+    if (pendingResize.events > 0)
+    {
+        Log("Resize %u events, %u applied, %u allocations, %.3f ms stalled\n", pendingResize.events,
+            pendingResize.applied, resizeAllocations, pendingResize.stallMilliseconds);
+        printf("resize %s: %u events, %u applied, %u allocations, %.3f ms stalled\n",
+               bCoalesceResize ? "coalesced" : "every event", pendingResize.events, pendingResize.applied,
+               resizeAllocations, pendingResize.stallMilliseconds);
+    }
+
+    if (bSyntheticEvents)
+    {
+        logEvents(windowState);
+        printf("events %u handled, %llu dropped, queue latency %.3f ms mean, %.3f ms max\n", windowState.events,
+               gEventQueue.GetDroppedCount(), windowState.events ? windowState.latencyMilliseconds / windowState.events : 0.0,
+               windowState.maxLatencyMilliseconds);
+    }
+
+    int result = 0;
+    if (resultsFile)
+    {
+        HeadlessResults results;
+        results.renderer = GetRendererName(rendererType);
+        results.width = width;
+        results.height = height;
+        results.startupMilliseconds = startupMilliseconds;
+        results.frameMilliseconds.swap(frameMilliseconds);
+        results.drawCalls = drawCalls;
+        results.instances = instances;
+        results.stateChanges = stateChanges;
+        results.stateCallsIssued = stateCallsIssued;
+        results.stateCallsFiltered = stateCallsFiltered;
+        results.constantBytesUploaded = constantBytesUploaded;
+        results.constantUploads = constantUploads;
+        results.bufferBytesUploaded = bufferBytesUploaded;
+        results.peakMemoryBytes = memoryBytes;
+        if (writeResults(resultsFile, results))
+            printf("wrote %s\n", resultsFile);
+        else
+        {
+            fprintf(stderr, "Cannot write %s\n", resultsFile);
+            result = 1;
+        }
+    }
+    if (profileFile)
+    {
+        ProfilerSummary profilerSummary;
+        ProfilerGetSummary(profilerSummary);
+        logProfile(profilerSummary);
+        printf("profile %u frames: frame p50/p95/p99 %.3f/%.3f/%.3f ms, CPU %.3f/%.3f/%.3f ms, GPU %.3f/%.3f/%.3f ms\n",
+               profilerSummary.frames, profilerSummary.frameMilliseconds[0], profilerSummary.frameMilliseconds[1],
+               profilerSummary.frameMilliseconds[2], profilerSummary.cpuMilliseconds[0], profilerSummary.cpuMilliseconds[1],
+               profilerSummary.cpuMilliseconds[2], profilerSummary.gpuMilliseconds[0], profilerSummary.gpuMilliseconds[1],
+               profilerSummary.gpuMilliseconds[2]);
+        if (ProfilerWriteTrace(profileFile))
+            printf("wrote %s\n", profileFile);
+        else
+        {
+            fprintf(stderr, "Cannot write %s\n", profileFile);
+            result = 1;
+        }
+        ProfilerSetEnabled(false);
+    }
+    if (outputFile)
+    {
+        if (!bCaptured)
+        {
+            fprintf(stderr, "Renderer %s cannot capture frames\n", GetRendererName(rendererType));
+            result = 1;
+        }
+        else if (pRenderer->FlushCaptures())
+        {
+            if (captureInterval > 0)
+                printf("captures %u written during the run, %u stalls\n", capturesWritten, captureStalls);
+            printf("wrote %s\n", outputFile);
+        }
+        else
+        {
+            fprintf(stderr, "Cannot write %s\n", outputFile);
+            result = 1;
+        }
+    }
+
+    pScene->Cleanup();
+    pRenderer->Cleanup();
+    return exitHeadless(result, pScene, pRenderer, true);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+// Platform layer
+// Owns the entry point: WinMain with the Win32 window and message loop on
+// Windows, a headless frame loop everywhere else (and on Windows when started
+// with --headless). Both drive the sample's Scene through a Renderer.
+//
+// The window and its message loop run on a thread of their own; WndProc only
+// queues key presses, sizes and focus changes on an EventQueue that the frame
+// loop handles before every frame, so a border drag or any other long message
+// never stops the drawing. Headless runs can start a synthetic window thread
+// with --synthetic-events to exercise the same path.
+//
+// Headless options:
+//   --renderer d3d11|software|null   Backend, software by default
+//   --frames N                       Frames to render, 100 by default
+//   --width W --height H             Frame size, 800x600 by default
+//   --output file.bmp                Capture the last frame
+//   --capture-interval N             Also capture every Nth frame to file_<frame>.bmp
+//   --json results.json              Frame time distribution, per frame counters and peak memory as JSON
+//   --cold-start                     Empty ShaderCache/ first, so every shader is compiled
+//   --simulation-rate N              Fixed Scene::Update() steps per second, 60 by default
+//   --frame-rate N                   Seconds every frame stands for, 1 / N; the simulation rate by default
+//   --real-time                      Use the measured frame time instead
+//   --vsync                          Flip on the vertical blank, of a simulated 60 Hz display without D3D11
+//   --fps-cap N                      Sleep until every frame's deadline, 0 (uncapped) by default
+//   --buffers N                      Swap chain buffers, 2 by default; 1 is the blt model
+//   --max-latency N                  Presented frames that may wait for the display, 1 by default
+//   --resize-drag                    Resize along a scripted border drag, 16 sizes a frame
+//   --no-coalesce                    Apply every one of those sizes instead of the last per frame
+//   --synthetic-events               Queue a border drag, focus changes and key presses from another thread
+//   --profile [file.json]            Chrome trace of the frames and p50/p95/p99 frame times, see Profiler.h
+//   --threads N                      Job threads including the frame loop's, every core by default, see JobSystem.h
+//   --name [value]                   Anything else goes to Scene::SetOption
+//
+// Windowed runs take the pacing, presentation, profile and thread options too,
+// and --no-vsync since they default to vsync.
+
+#define WIN_WIDTH 800
+#define WIN_HEIGHT 600
+
+int RunHeadless(int argc, char **argv);
@@ -0,0 +1,100 @@
+#include "Clock.h"
+#include "PresentQueue.h"
+
+PresentQueue::PresentQueue() : bufferCount(PRESENT_DEFAULT_BUFFERS),
+                               maxFrameLatency(PRESENT_DEFAULT_LATENCY),
+                               bVsync(false),
+                               periodTicks(0),
+                               nextVblank(0),
+                               frameInput(0),
+                               displayedFrames(0),
+                               inputToPhotonMilliseconds(0.0)
+{
+}
+
+PresentQueue::~PresentQueue()
+{
+    if (bVsync)
+        ClockEndTimerPeriod();
+}
+
+void PresentQueue::Initialize(const RendererDesc &desc)
+{
+    // The simulated vertical blanks are slept for, on a 1 ms timer period
+    if (desc.bVsync && !bVsync)
+        ClockBeginTimerPeriod();
+    else if (!desc.bVsync && bVsync)
+        ClockEndTimerPeriod();
+
+    bufferCount = GetPresentBufferCount(desc);
+    maxFrameLatency = GetPresentMaxFrameLatency(desc);
+    bVsync = desc.bVsync;
+    periodTicks = ClockTicksFromSeconds(1.0 / SIMULATED_REFRESH_RATE);
+    nextVblank = ClockTicks() + periodTicks;
+    frameInput = ClockTicks();
+    queued.clear();
+    displayedFrames = 0;
+    inputToPhotonMilliseconds = 0.0;
+}
+
+void PresentQueue::display(unsigned long long input, unsigned long long shown)
+{
+    displayedFrames++;
+    inputToPhotonMilliseconds += ClockSeconds(shown - input) * 1000.0;
+}
+
+// Run the vertical blanks up to now, each one flips to the oldest queued frame
+void PresentQueue::retire(unsigned long long now)
+{
+    while (nextVblank <= now)
+    {
+        if (!queued.empty())
+        {
+            display(queued.front(), nextVblank);
+            queued.pop_front();
+            nextVblank += periodTicks;
+        }
+        else
+        {
+            // Nothing to flip to, skip the idle blanks at once
+            nextVblank += ((now - nextVblank) / periodTicks + 1) * periodTicks;
+        }
+    }
+}
+
+void PresentQueue::WaitForSlot()
+{
+    retire(ClockTicks());
+    while (queued.size() >= maxFrameLatency)
+    {
+        ClockSleepUntil(nextVblank);
+        retire(ClockTicks());
+    }
+    frameInput = ClockTicks();
+}
+
+void PresentQueue::Present()
+{
+    unsigned long long now = ClockTicks();
+    if (!bVsync)
+    {
+        display(frameInput, now);
+        return;
+    }
+
+    retire(now);
+    queued.push_back(frameInput);
+    while (queued.size() > bufferCount - 1)
+    {
+        ClockSleepUntil(nextVblank);
+        retire(ClockTicks());
+    }
+}
+
+void PresentQueue::TakeDisplayed(RendererStatistics &statistics)
+{
+    statistics.displayedFrames += displayedFrames;
+    statistics.inputToPhotonMilliseconds += inputToPhotonMilliseconds;
+    displayedFrames = 0;
+    inputToPhotonMilliseconds = 0.0;
+}
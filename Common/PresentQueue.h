@@ -0,0 +1,53 @@
+#pragma once
+
+// Presentation queue of the software and null backends, a simulated display
+// that refreshes SIMULATED_REFRESH_RATE times a second and behaves like a DXGI
+// flip model swap chain:
+//
+// - WaitForSlot() blocks while maxFrameLatency presented frames are still
+//   waiting for the display, like the frame latency waitable object, and
+//   marks the moment the next frame samples its input
+// - Present() queues the frame; with vsync the display takes the oldest
+//   queued frame at every vertical blank. While all bufferCount - 1 back
+//   buffers hold queued frames Present() blocks for the next blank, and a
+//   single buffer waits until its frame is on screen
+// - Without vsync a frame is shown the moment it is presented, nothing waits
+//   and the timer period is left alone
+//
+// The D3D11 backend gets the same numbers from DXGI frame statistics.
+
+#include <deque>
+
+#include "Renderer.h"
+
+#define SIMULATED_REFRESH_RATE 60
+
+class PresentQueue
+{
+private:
+    unsigned int bufferCount;
+    unsigned int maxFrameLatency;
+    bool bVsync; // The timer period is raised while set
+    unsigned long long periodTicks;
+    unsigned long long nextVblank;
+    unsigned long long frameInput;         // When the frame being built sampled its input
+    std::deque<unsigned long long> queued; // Input time of every presented frame not on screen yet
+
+    // Frames shown since the last TakeDisplayed()
+    unsigned int displayedFrames;
+    double inputToPhotonMilliseconds;
+
+    void retire(unsigned long long now);
+    void display(unsigned long long input, unsigned long long shown);
+
+public:
+    PresentQueue();
+    ~PresentQueue();
+
+    void Initialize(const RendererDesc &desc);
+    void WaitForSlot();
+    void Present();
+
+    unsigned int GetQueuedFrames() const { return (unsigned int)queued.size(); }
+    void TakeDisplayed(RendererStatistics &statistics); // Adds displayedFrames and their latency, then resets them
+};
@@ -0,0 +1,302 @@
+#include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "Clock.h"
+#include "Profiler.h"
+
+#if PROFILER_ENABLED
+
+#define PROFILER_GPU_THREAD 1000 // Trace thread id of the GPU track
+
+struct ProfilerRecord
+{
+    const char *name;
+    unsigned long long startTicks;
+    unsigned long long endTicks;
+    unsigned int depth;
+    unsigned int thread;
+};
+
+struct ProfilerFrame
+{
+    bool bValid;
+    unsigned long long index;
+    unsigned long long startTicks;
+    unsigned long long endTicks; // 0 while the frame is recorded
+    unsigned int thread;         // The one that called ProfilerBeginFrame()
+    std::vector<ProfilerRecord> cpuEvents;
+    std::vector<ProfilerRecord> gpuEvents;
+};
+
+static std::atomic<bool> gbEnabled(false);
+static std::mutex gMutex; // Guards everything below, scopes end on any thread
+static ProfilerFrame gFrames[PROFILER_FRAMES];
+static unsigned long long gFrameCount = 0; // Frames begun, the current one is gFrameCount - 1
+static unsigned long long gStartTicks = 0; // Time zero of the trace
+static std::atomic<unsigned int> gNextThread(0);
+
+static thread_local unsigned int tThread = ~0u;
+static thread_local unsigned int tDepth = 0;
+
+// Small per thread number for the trace, in order of first use
+static unsigned int currentThread()
+{
+    if (tThread == ~0u)
+        tThread = gNextThread++;
+    return tThread;
+}
+
+void ProfilerSetEnabled(bool bEnable)
+{
+    if (bEnable && !gbEnabled)
+        ProfilerReset();
+    gbEnabled = bEnable;
+}
+
+bool ProfilerIsEnabled()
+{
+    return gbEnabled;
+}
+
+void ProfilerBeginFrame()
+{
+    if (!gbEnabled)
+        return;
+
+    std::lock_guard<std::mutex> lock(gMutex);
+    ProfilerFrame &frame = gFrames[gFrameCount % PROFILER_FRAMES];
+    frame.bValid = true;
+    frame.index = gFrameCount;
+    frame.startTicks = ClockTicks();
+    frame.endTicks = 0;
+    frame.thread = currentThread();
+    frame.cpuEvents.clear(); // Keeps the capacity, the ring stops allocating once it is warm
+    frame.gpuEvents.clear();
+    gFrameCount++;
+}
+
+void ProfilerEndFrame()
+{
+    if (!gbEnabled)
+        return;
+
+    std::lock_guard<std::mutex> lock(gMutex);
+    if (gFrameCount > 0)
+        gFrames[(gFrameCount - 1) % PROFILER_FRAMES].endTicks = ClockTicks();
+}
+
+unsigned long long ProfilerGetFrameIndex()
+{
+    std::lock_guard<std::mutex> lock(gMutex);
+    return gFrameCount > 0 ? gFrameCount - 1 : 0;
+}
+
+// Scopes belong to the last frame begun, work between frames (pacing) included
+void ProfilerRecordScope(const char *name, unsigned long long startTicks, unsigned long long endTicks, unsigned int depth)
+{
+    ProfilerRecord record;
+    record.name = name;
+    record.startTicks = startTicks;
+    record.endTicks = endTicks;
+    record.depth = depth;
+    record.thread = currentThread();
+
+    std::lock_guard<std::mutex> lock(gMutex);
+    if (gFrameCount > 0)
+        gFrames[(gFrameCount - 1) % PROFILER_FRAMES].cpuEvents.push_back(record);
+}
+
+void ProfilerRecordGpuEvent(unsigned long long frameIndex, const char *name,
+                            unsigned long long startTicks, unsigned long long endTicks)
+{
+    ProfilerRecord record;
+    record.name = name;
+    record.startTicks = startTicks;
+    record.endTicks = endTicks;
+    record.depth = 0;
+    record.thread = PROFILER_GPU_THREAD;
+
+    std::lock_guard<std::mutex> lock(gMutex);
+    ProfilerFrame &frame = gFrames[frameIndex % PROFILER_FRAMES];
+    if (frame.bValid && frame.index == frameIndex)
+        frame.gpuEvents.push_back(record);
+}
+
+// p50, p95 and p99 by nearest rank, sorts values
+static void percentiles(std::vector<double> &values, double result[3])
+{
+    static const double ranks[3] = {0.50, 0.95, 0.99};
+    std::sort(values.begin(), values.end());
+    for (int i = 0; i < 3; i++)
+    {
+        if (values.empty())
+        {
+            result[i] = 0.0;
+            continue;
+        }
+        size_t rank = (size_t)(ranks[i] * values.size() + 0.999999);
+        result[i] = values[std::min(std::max(rank, (size_t)1), values.size()) - 1];
+    }
+}
+
+void ProfilerGetSummary(ProfilerSummary &summary)
+{
+    std::vector<double> frameTimes, cpuTimes, gpuTimes;
+    {
+        std::lock_guard<std::mutex> lock(gMutex);
+        for (unsigned int i = 0; i < PROFILER_FRAMES; i++)
+        {
+            const ProfilerFrame &frame = gFrames[i];
+            if (!frame.bValid || frame.endTicks == 0)
+                continue;
+
+            cpuTimes.push_back(ClockSeconds(frame.endTicks - frame.startTicks) * 1000.0);
+
+            const ProfilerFrame &next = gFrames[(i + 1) % PROFILER_FRAMES];
+            if (next.bValid && next.index == frame.index + 1)
+                frameTimes.push_back(ClockSeconds(next.startTicks - frame.startTicks) * 1000.0);
+
+            if (!frame.gpuEvents.empty())
+            {
+                unsigned long long first = frame.gpuEvents[0].startTicks, last = frame.gpuEvents[0].endTicks;
+                for (size_t e = 1; e < frame.gpuEvents.size(); e++)
+                {
+                    first = std::min(first, frame.gpuEvents[e].startTicks);
+                    last = std::max(last, frame.gpuEvents[e].endTicks);
+                }
+                gpuTimes.push_back(ClockSeconds(last - first) * 1000.0);
+            }
+        }
+    }
+
+    summary.frames = (unsigned int)cpuTimes.size();
+    summary.gpuFrames = (unsigned int)gpuTimes.size();
+    percentiles(frameTimes, summary.frameMilliseconds);
+    percentiles(cpuTimes, summary.cpuMilliseconds);
+    percentiles(gpuTimes, summary.gpuMilliseconds);
+}
+
+static double traceMicroseconds(unsigned long long ticks)
+{
+    return ticks > gStartTicks ? ClockSeconds(ticks - gStartTicks) * 1000000.0 : 0.0;
+}
+
+static void writeTraceEvent(FILE *pFile, bool &bFirst, const char *name, const char *category,
+                            unsigned long long startTicks, unsigned long long endTicks, unsigned int thread)
+{
+    fprintf(pFile, "%s\n{\"name\":\"", bFirst ? "" : ",");
+    for (const char *c = name; *c; c++)
+    {
+        if (*c == '"' || *c == '\\')
+            fputc('\\', pFile);
+        fputc(*c, pFile);
+    }
+    fprintf(pFile, "\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+            category, traceMicroseconds(startTicks),
+            endTicks > startTicks ? ClockSeconds(endTicks - startTicks) * 1000000.0 : 0.0, thread);
+    bFirst = false;
+}
+
+// Complete ("X") events of every frame in the ring, one track per CPU thread
+// and one for the GPU
+bool ProfilerWriteTrace(const char *filePath)
+{
+    FILE *pFile = fopen(filePath, "w");
+    if (pFile == NULL)
+        return false;
+
+    std::lock_guard<std::mutex> lock(gMutex);
+    fprintf(pFile, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    bool bFirst = true;
+    unsigned int threads = gNextThread;
+    for (unsigned int t = 0; t < threads; t++)
+    {
+        fprintf(pFile, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"CPU %u\"}}",
+                bFirst ? "" : ",", t, t);
+        bFirst = false;
+    }
+    fprintf(pFile, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"GPU\"}}",
+            bFirst ? "" : ",", PROFILER_GPU_THREAD);
+    bFirst = false;
+
+    // Oldest frame first
+    unsigned long long first = gFrameCount > PROFILER_FRAMES ? gFrameCount - PROFILER_FRAMES : 0;
+    for (unsigned long long index = first; index < gFrameCount; index++)
+    {
+        const ProfilerFrame &frame = gFrames[index % PROFILER_FRAMES];
+        if (!frame.bValid || frame.endTicks == 0)
+            continue;
+
+        char name[32];
+        snprintf(name, sizeof(name), "Frame %llu", frame.index);
+        writeTraceEvent(pFile, bFirst, name, "frame", frame.startTicks, frame.endTicks, frame.thread);
+        for (size_t e = 0; e < frame.cpuEvents.size(); e++)
+        {
+            const ProfilerRecord &record = frame.cpuEvents[e];
+            writeTraceEvent(pFile, bFirst, record.name, "cpu", record.startTicks, record.endTicks, record.thread);
+        }
+        for (size_t e = 0; e < frame.gpuEvents.size(); e++)
+        {
+            const ProfilerRecord &record = frame.gpuEvents[e];
+            writeTraceEvent(pFile, bFirst, record.name, "gpu", record.startTicks, record.endTicks, record.thread);
+        }
+    }
+    fprintf(pFile, "\n]}\n");
+
+    bool bWritten = ferror(pFile) == 0;
+    fclose(pFile);
+    return bWritten;
+}
+
+void ProfilerReset()
+{
+    std::lock_guard<std::mutex> lock(gMutex);
+    for (unsigned int i = 0; i < PROFILER_FRAMES; i++)
+    {
+        gFrames[i].bValid = false;
+        gFrames[i].cpuEvents.clear();
+        gFrames[i].gpuEvents.clear();
+    }
+    gFrameCount = 0;
+    gStartTicks = ClockTicks();
+}
+
+ProfilerScope::ProfilerScope(const char *name) : name(name),
+                                                 startTicks(0),
+                                                 depth(0),
+                                                 bActive(gbEnabled)
+{
+    if (bActive)
+    {
+        depth = tDepth++;
+        startTicks = ClockTicks();
+    }
+}
+
+ProfilerScope::~ProfilerScope()
+{
+    if (bActive)
+    {
+        ProfilerRecordScope(name, startTicks, ClockTicks(), depth);
+        tDepth--;
+    }
+}
+
+ProfilerGpuScope::ProfilerGpuScope(const char *name) : name(name),
+                                                       startTicks(0),
+                                                       bActive(gbEnabled)
+{
+    if (bActive)
+        startTicks = ClockTicks();
+}
+
+ProfilerGpuScope::~ProfilerGpuScope()
+{
+    if (bActive)
+        ProfilerRecordGpuEvent(ProfilerGetFrameIndex(), name, startTicks, ClockTicks());
+}
+
+#endif // PROFILER_ENABLED
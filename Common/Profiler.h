@@ -0,0 +1,101 @@
+#pragma once
+
+// Frame profiler
+// CPU work is timed with nested scopes, PROFILE_SCOPE("name") until the end of
+// the enclosing block, on any thread. GPU work is reported by the renderer:
+// the D3D11 backend brackets Clear, every draw and Present with timestamp
+// queries inside a disjoint query and hands the results back a few frames
+// later, the software backend times its rasterizer with PROFILE_GPU_SCOPE.
+// Both land in a ring of the last PROFILER_FRAMES frames, which
+// ProfilerGetSummary() turns into p50/p95/p99 frame times and
+// ProfilerWriteTrace() into Chrome trace JSON (chrome://tracing, Perfetto).
+//
+// Profiling is off until ProfilerSetEnabled(true), a scope then costs two
+// ClockTicks() and a locked append. Built with PROFILER_ENABLED 0 the scopes
+// and calls compile to nothing.
+
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+#define PROFILER_FRAMES 512 // Frames kept for the summary and the trace
+
+struct ProfilerSummary
+{
+    unsigned int frames;        // In the ring, the summary covers these
+    double frameMilliseconds[3]; // p50, p95, p99 of the interval between ProfilerBeginFrame() calls
+    double cpuMilliseconds[3];   // ProfilerBeginFrame() to ProfilerEndFrame()
+    double gpuMilliseconds[3];   // First to last GPU event of the frames that reported any
+    unsigned int gpuFrames;
+};
+
+#if PROFILER_ENABLED
+
+void ProfilerSetEnabled(bool bEnable);
+bool ProfilerIsEnabled();
+
+void ProfilerBeginFrame();
+void ProfilerEndFrame();
+unsigned long long ProfilerGetFrameIndex(); // Frame being recorded, tags GPU work read back later
+
+// A CPU scope, name must outlive the profiler (a string literal)
+void ProfilerRecordScope(const char *name, unsigned long long startTicks, unsigned long long endTicks, unsigned int depth);
+
+// GPU work of frame frameIndex on the ClockTicks() time line; ignored once
+// the frame has left the ring
+void ProfilerRecordGpuEvent(unsigned long long frameIndex, const char *name,
+                            unsigned long long startTicks, unsigned long long endTicks);
+
+void ProfilerGetSummary(ProfilerSummary &summary);
+bool ProfilerWriteTrace(const char *filePath);
+void ProfilerReset(); // Forget every recorded frame
+
+class ProfilerScope
+{
+private:
+    const char *name;
+    unsigned long long startTicks;
+    unsigned int depth;
+    bool bActive;
+
+public:
+    explicit ProfilerScope(const char *name);
+    ~ProfilerScope();
+};
+
+// GPU work that runs on the CPU, the software rasterizer's, timed into the
+// GPU track of the current frame
+class ProfilerGpuScope
+{
+private:
+    const char *name;
+    unsigned long long startTicks;
+    bool bActive;
+
+public:
+    explicit ProfilerGpuScope(const char *name);
+    ~ProfilerGpuScope();
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(name) ProfilerScope PROFILE_CONCAT(profilerScope, __LINE__)(name)
+#define PROFILE_GPU_SCOPE(name) ProfilerGpuScope PROFILE_CONCAT(profilerGpuScope, __LINE__)(name)
+
+#else
+
+inline void ProfilerSetEnabled(bool) {}
+inline bool ProfilerIsEnabled() { return false; }
+inline void ProfilerBeginFrame() {}
+inline void ProfilerEndFrame() {}
+inline unsigned long long ProfilerGetFrameIndex() { return 0; }
+inline void ProfilerRecordScope(const char *, unsigned long long, unsigned long long, unsigned int) {}
+inline void ProfilerRecordGpuEvent(unsigned long long, const char *, unsigned long long, unsigned long long) {}
+inline void ProfilerGetSummary(ProfilerSummary &summary) { summary = ProfilerSummary(); }
+inline bool ProfilerWriteTrace(const char *) { return false; }
+inline void ProfilerReset() {}
+
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_GPU_SCOPE(name) ((void)0)
+
+#endif // PROFILER_ENABLED
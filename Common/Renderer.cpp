@@ -0,0 +1,84 @@
+#include <stddef.h>
+#include <vector>
+
+#include "Renderer.h"
+#include "SoftwareRenderer.h"
+#ifdef _WIN32
+#include "D3D11Renderer.h"
+#endif
+
+Renderer *CreateRenderer(RendererType type)
+{
+    switch (type)
+    {
+#ifdef _WIN32
+    case RENDERER_D3D11:
+        return new D3D11Renderer();
+#endif
+    case RENDERER_SOFTWARE:
+        return new SoftwareRenderer(true);
+    case RENDERER_NULL:
+        return new SoftwareRenderer(false);
+    default:
+        return NULL;
+    }
+}
+
+const char *GetRendererName(RendererType type)
+{
+    switch (type)
+    {
+    case RENDERER_D3D11:
+        return "d3d11";
+    case RENDERER_SOFTWARE:
+        return "software";
+    case RENDERER_NULL:
+        return "null";
+    default:
+        return "unknown";
+    }
+}
+
+ShaderHandle CreateShaderPermutation(Renderer *pRenderer, const ShaderDesc &desc, unsigned int featureMask)
+{
+    // scene defines first, then one per feature bit
+    std::vector<ShaderDefine> defines(desc.pDefines, desc.pDefines + desc.numDefines);
+    for (unsigned int bit = 0; bit < SHADER_FEATURE_COUNT; bit++)
+    {
+        if (featureMask & (1u << bit))
+        {
+            ShaderDefine define = {GetShaderFeatureName(1u << bit), "1"};
+            defines.push_back(define);
+        }
+    }
+
+    ShaderDesc variantDesc = desc;
+    variantDesc.pDefines = defines.empty() ? NULL : defines.data();
+    variantDesc.numDefines = (unsigned int)defines.size();
+    return pRenderer->CreateShader(variantDesc);
+}
+
+unsigned int GetPresentBufferCount(const RendererDesc &desc)
+{
+    if (desc.bufferCount == 0)
+        return PRESENT_DEFAULT_BUFFERS;
+    return desc.bufferCount < PRESENT_MAX_BUFFERS ? desc.bufferCount : PRESENT_MAX_BUFFERS;
+}
+
+unsigned int GetPresentMaxFrameLatency(const RendererDesc &desc)
+{
+    return desc.maxFrameLatency == 0 ? PRESENT_DEFAULT_LATENCY : desc.maxFrameLatency;
+}
+
+const char *GetShaderFeatureName(unsigned int feature)
+{
+    switch (feature)
+    {
+    case SHADER_FEATURE_LIGHTING:
+        return "LIGHTING";
+    case SHADER_FEATURE_INSTANCING:
+        return "INSTANCING";
+    default:
+        return "UNKNOWN";
+    }
+}
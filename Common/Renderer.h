@@ -0,0 +1,224 @@
+#pragma once
+
+// Renderer core
+// Backend independent version of the device, swap chain, shader and buffer
+// code every sample used to carry in its own D3D11App. Samples talk to this
+// interface only, so the same scene runs on D3D11 or on the software
+// rasterizer.
+
+#include "SoftwareRasterizer.h"
+#include "ShaderCache.h"
+
+// Handles to renderer owned resources, 0 is never a valid handle
+typedef unsigned int BufferHandle;
+typedef unsigned int ShaderHandle;
+typedef unsigned int TextureHandle;
+
+enum RendererType
+{
+    RENDERER_D3D11 = 0, // Windows only
+    RENDERER_SOFTWARE,  // Portable tile-based rasterizer
+    RENDERER_NULL       // Accepts every call, draws nothing
+};
+
+enum BufferType
+{
+    BUFFER_TYPE_VERTEX = 0,
+    BUFFER_TYPE_INDEX,
+    BUFFER_TYPE_CONSTANT
+};
+
+enum IndexFormat
+{
+    INDEX_FORMAT_UINT16 = 0,
+    INDEX_FORMAT_UINT32
+};
+
+enum VertexFormat
+{
+    VERTEX_FORMAT_FLOAT2 = 0,
+    VERTEX_FORMAT_FLOAT3,
+    VERTEX_FORMAT_FLOAT4,
+    VERTEX_FORMAT_HALF4,     // 4 x 16 bit float, read as float4
+    VERTEX_FORMAT_SNORM16X2, // Read as float2 in [-1, 1]
+    VERTEX_FORMAT_UNORM16X2  // Read as float2 in [0, 1]
+};
+
+enum PrimitiveTopology
+{
+    PRIMITIVE_TOPOLOGY_TRIANGLELIST = 0,
+    PRIMITIVE_TOPOLOGY_TRIANGLESTRIP
+};
+
+// Shader feature toggles, compiled into separate variants instead of being
+// branched on in the shader. A variant key is a mask of these bits; the HLSL
+// sees every set bit as a #define of its name, the software backend gets a C++
+// shader instantiated for the same key.
+#define SHADER_FEATURE_LIGHTING 0x1
+#define SHADER_FEATURE_INSTANCING 0x2 // World matrix and material come from a per-instance vertex buffer
+#define SHADER_FEATURE_COUNT 2
+#define SHADER_PERMUTATION_COUNT (1 << SHADER_FEATURE_COUNT)
+
+enum CullMode
+{
+    CULL_MODE_NONE = 0,
+    CULL_MODE_FRONT,
+    CULL_MODE_BACK
+};
+
+// Constant data lives in one ring buffer per renderer. Uploads take the next
+// CONSTANT_ALIGNMENT aligned range and are bound by offset; when the ring is
+// full it starts over with a new generation and every older allocation is
+// invalid. ConstantBlock.h builds the per-frequency blocks on top of this.
+#define CONSTANT_RING_SIZE (1024 * 1024)
+#define CONSTANT_ALIGNMENT 256 // 16 constants, the granularity of offset binding
+
+struct ConstantAllocation
+{
+    unsigned int offset;     // Bytes from the start of the ring
+    unsigned int size;       // Rounded up to CONSTANT_ALIGNMENT
+    unsigned int generation; // 0 for an allocation that was never made
+};
+
+// Counters of the last presented frame
+struct RendererStatistics
+{
+    unsigned long long constantBytesUploaded; // Ring uploads plus UpdateBuffer on constant buffers
+    unsigned int constantUploads;
+    unsigned long long bufferBytesUploaded;   // UpdateBuffer on vertex and index buffers
+    unsigned int drawCalls;
+    unsigned long long instances; // Summed over all draws, 1 for a non instanced one
+    unsigned int stateChanges;    // Set*() calls: shader, buffers, constants, textures, topology
+    unsigned int stateCallsIssued;   // Bindings that reached the device, a Set*() may make several
+    unsigned int stateCallsFiltered; // Bindings dropped because the same thing was bound already
+
+    // Presentation queue
+    unsigned int queuedFrames;        // Presented but not on screen yet, right after this Present()
+    unsigned int displayedFrames;     // Frames seen reaching the screen since the previous Present()
+    double inputToPhotonMilliseconds; // Summed over displayedFrames, WaitForFrameSlot() to the flip
+
+    // Resize() calls since the previous Present() that changed the size, and
+    // the textures they had to allocate; the software backend's pooled depth
+    // buffer only counts when it grows
+    unsigned int resizes;
+    unsigned int resizeAllocations;
+
+    // QueueCapture() readback
+    unsigned int capturesWritten;
+    unsigned int captureStalls; // Copies that had to wait for a readback buffer still in use
+};
+
+#define CAPTURE_RING_SIZE 3 // Readback buffers of QueueCapture()
+
+// Presentation queue settings, a RendererDesc field of 0 takes the default
+#define PRESENT_DEFAULT_BUFFERS 2
+#define PRESENT_DEFAULT_LATENCY 1
+#define PRESENT_MAX_BUFFERS 16 // DXGI_MAX_SWAP_CHAIN_BUFFERS
+
+// Creation time settings, filled by the platform layer and adjusted by the scene
+struct RendererDesc
+{
+    int width;
+    int height;
+    bool bDepthBuffer; // D32 depth buffer, cleared every frame
+    CullMode cullMode;
+    bool bVsync;       // Frames flip on the vertical blank, a simulated one without D3D11
+    unsigned int bufferCount;     // Swap chain buffers, one is on screen and the rest can queue
+    unsigned int maxFrameLatency; // Presented frames WaitForFrameSlot() lets wait for the display
+};
+
+struct BufferDesc
+{
+    BufferType type;
+    unsigned int byteWidth;
+    const void *pInitialData; // Required for vertex and index buffers
+};
+
+// One entry of the input layout, mirrors D3D11_INPUT_ELEMENT_DESC
+struct VertexElement
+{
+    const char *semanticName;
+    unsigned int semanticIndex;
+    VertexFormat format;
+    unsigned int inputSlot;
+    unsigned int alignedByteOffset;
+};
+
+// A vertex/pixel shader pair with its input layout
+// The D3D11 backend compiles the HLSL files, the software backend runs the
+// C++ port of the same shaders.
+struct ShaderDesc
+{
+    const char *vertexShaderFile;
+    const char *pixelShaderFile;
+    const VertexElement *pElements;
+    unsigned int numElements;
+    const ShaderDefine *pDefines; // Passed to both HLSL files
+    unsigned int numDefines;
+    unsigned int instanceSlotMask; // Bit n set: input slot n holds per-instance data, one element per instance
+
+    SRVertexShader softwareVertexShader;
+    SRPixelShader softwarePixelShader;
+    unsigned int numVaryings; // Floats written by softwareVertexShader
+};
+
+class Renderer
+{
+public:
+    virtual ~Renderer() {}
+
+    virtual int Initialize(void *pNativeWindow, const RendererDesc &desc) = 0; // 0 on success
+    virtual int Resize(int width, int height) = 0;                            // 0 on success
+    virtual void Cleanup() = 0;
+
+    // Resources
+    virtual BufferHandle CreateBuffer(const BufferDesc &desc) = 0;
+    virtual void UpdateBuffer(BufferHandle buffer, const void *pData) = 0; // Whole buffer, like UpdateSubresource
+    virtual ShaderHandle CreateShader(const ShaderDesc &desc) = 0;
+    virtual TextureHandle CreateTextureFromFile(const char *filePath) = 0; // Sampled with a linear wrap sampler
+    // A Texture2DArray with one slice per file, slice i from filePaths[i]; the
+    // files are BMPs of the same size, the shader picks the slice per pixel
+    virtual TextureHandle CreateTextureArrayFromFiles(const char *const *filePaths, unsigned int count) = 0;
+
+    // Constant ring
+    virtual bool UploadConstants(const void *pData, unsigned int size, ConstantAllocation &allocation) = 0; // false when size exceeds the ring
+    virtual bool IsConstantAllocationValid(const ConstantAllocation &allocation) const = 0;               // Not yet recycled by a wrap
+
+    // Pipeline state
+    virtual void SetShader(ShaderHandle shader) = 0;
+    virtual void SetVertexBuffer(unsigned int slot, BufferHandle buffer, unsigned int stride, unsigned int offset) = 0;
+    virtual void SetIndexBuffer(BufferHandle buffer, IndexFormat format) = 0;
+    virtual void SetConstantBuffer(unsigned int slot, BufferHandle buffer) = 0; // Bound to vertex and pixel shader
+    virtual void SetConstants(unsigned int slot, const ConstantAllocation &allocation) = 0; // Ring range, same binding
+    virtual void SetTexture(unsigned int slot, TextureHandle texture) = 0;      // Pixel shader only
+    virtual void SetPrimitiveTopology(PrimitiveTopology topology) = 0;
+
+    // Frame
+    virtual void WaitForFrameSlot() = 0; // Before the frame samples input, blocks while maxFrameLatency frames are queued
+    virtual void Clear(const float clearColor[4]) = 0; // Color and, when present, depth
+    virtual void Draw(unsigned int vertexCount, unsigned int startVertex) = 0;
+    virtual void DrawIndexed(unsigned int indexCount, unsigned int startIndex, int baseVertex) = 0;
+    virtual void DrawIndexedInstanced(unsigned int indexCount, unsigned int instanceCount, unsigned int startIndex, int baseVertex, unsigned int startInstance) = 0;
+    virtual void Present() = 0;
+
+    virtual const RendererStatistics &GetStatistics() const = 0;
+
+    // Frame capture: the frame being drawn is copied into a ring of
+    // CAPTURE_RING_SIZE readback buffers by Present() and written to filePath
+    // as BMP once the copy is done, a frame or more later, so capturing does
+    // not stall the frame. FlushCaptures() waits for and writes the rest, false
+    // when one of them could not be written. QueueCapture() is false when the
+    // backend cannot read back.
+    virtual bool QueueCapture(const char *) { return false; }
+    virtual bool FlushCaptures() { return true; }
+};
+
+Renderer *CreateRenderer(RendererType type);
+const char *GetRendererName(RendererType type);
+unsigned int GetPresentBufferCount(const RendererDesc &desc);      // bufferCount with the default and limit applied
+unsigned int GetPresentMaxFrameLatency(const RendererDesc &desc);  // maxFrameLatency with the default applied
+
+// Create the variant of desc selected by a SHADER_FEATURE_* mask, desc holds
+// the software shaders compiled for that mask
+ShaderHandle CreateShaderPermutation(Renderer *pRenderer, const ShaderDesc &desc, unsigned int featureMask);
+const char *GetShaderFeatureName(unsigned int feature);
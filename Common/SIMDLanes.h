@@ -0,0 +1,247 @@
+#pragma once
+
+// Lane operations for kernels written once for every vector width
+// A kernel is a template on LANES and runs Width objects per iteration,
+// keeping one float of every object in a Float. ScalarLanes is one object
+// at a time; SIMDLanes is the widest type compiled in: 16 lanes with AVX-512
+// (-mavx512f), 8 with AVX2 and FMA (-mavx2 -mfma), 4 with SSE2, and is not
+// defined at all without one (SIMD_LANES is then undefined too). MulAdd is
+// fused only where FMA is, so the narrower paths round like scalar code.
+// StoreIndices() appends first + i for each set bit i of a MaskBits() value
+// and returns how many it appended; pOut needs room for Width of them.
+
+#include <math.h>
+
+#include "XMath.h"
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#define SIMD_LANES_AVX512 1
+#elif defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#include <immintrin.h>
+#define SIMD_LANES_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SIMD_LANES_SSE2 1
+#endif
+
+#if defined(SIMD_LANES_AVX512) || defined(SIMD_LANES_AVX2) || defined(SIMD_LANES_SSE2)
+#define SIMD_LANES 1
+#endif
+
+// StoreIndices() without a compress store, branch free: every index is
+// written and the count only moves past the kept ones
+static inline unsigned int StoreIndexBits(unsigned int *pOut, unsigned int first, unsigned int bits, unsigned int width)
+{
+    unsigned int n = 0;
+    for (unsigned int i = 0; i < width; i++)
+    {
+        pOut[n] = first + i;
+        n += (bits >> i) & 1;
+    }
+    return n;
+}
+
+struct ScalarLanes
+{
+    typedef float Float;
+    typedef bool Mask;
+    static const unsigned int Width = 1;
+
+    static Float Load(const float *p) { return *p; }
+    static Float Set(float value) { return value; }
+    static Float Add(Float a, Float b) { return a + b; }
+    static Float Sub(Float a, Float b) { return a - b; }
+    static Float Mul(Float a, Float b) { return a * b; }
+    static Float MulAdd(Float a, Float b, Float c) { return a * b + c; }
+    static Float Abs(Float a) { return fabsf(a); }
+    static Float Round(Float a) { return nearbyintf(a); }
+    static Mask Greater(Float a, Float b) { return a > b; }
+    static Float Select(Mask mask, Float a, Float b) { return mask ? a : b; }
+    static Float Min(Float a, Float b) { return a < b ? a : b; }
+    static unsigned int MaskBits(Mask mask) { return mask ? 1 : 0; }
+    static unsigned int StoreIndices(unsigned int *pOut, unsigned int first, unsigned int bits) { *pOut = first; return bits & 1; }
+
+    static void StoreMatrices(const Float m[16], XMMATRIX *pOut)
+    {
+        for (int i = 0; i < 16; i++)
+            pOut->m[i / 4][i % 4] = m[i];
+    }
+};
+
+#if defined(SIMD_LANES_AVX512)
+struct SIMDLanes
+{
+    typedef __m512 Float;
+    typedef __mmask16 Mask;
+    static const unsigned int Width = 16;
+
+    static Float Load(const float *p) { return _mm512_loadu_ps(p); }
+    static Float Set(float value) { return _mm512_set1_ps(value); }
+    static Float Add(Float a, Float b) { return _mm512_add_ps(a, b); }
+    static Float Sub(Float a, Float b) { return _mm512_sub_ps(a, b); }
+    static Float Mul(Float a, Float b) { return _mm512_mul_ps(a, b); }
+    static Float MulAdd(Float a, Float b, Float c) { return _mm512_fmadd_ps(a, b, c); }
+    static Float Abs(Float a) { return _mm512_abs_ps(a); }
+    static Float Round(Float a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static Mask Greater(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+    static Float Select(Mask mask, Float a, Float b) { return _mm512_mask_blend_ps(mask, b, a); }
+    static Float Min(Float a, Float b) { return _mm512_min_ps(a, b); }
+    static unsigned int MaskBits(Mask mask) { return mask; }
+
+    // Writes only the kept indices
+    static unsigned int StoreIndices(unsigned int *pOut, unsigned int first, unsigned int bits)
+    {
+        __m512i indices = _mm512_add_epi32(_mm512_set1_epi32((int)first), _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        _mm512_mask_compressstoreu_epi32(pOut, (__mmask16)bits, indices);
+        return (unsigned int)_mm_popcnt_u32(bits);
+    }
+
+    // 16 x 16 transpose: pairs, then quads within 128 bit lanes, then the lanes themselves
+    static void StoreMatrices(const Float m[16], XMMATRIX *pOut)
+    {
+        __m512 t[16];
+        __m512 r[16];
+        for (int i = 0; i < 16; i += 2)
+        {
+            t[i] = _mm512_unpacklo_ps(m[i], m[i + 1]);
+            t[i + 1] = _mm512_unpackhi_ps(m[i], m[i + 1]);
+        }
+        for (int i = 0; i < 16; i += 4)
+        {
+            r[i] = _mm512_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+            r[i + 1] = _mm512_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+            r[i + 2] = _mm512_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+            r[i + 3] = _mm512_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+        }
+        for (int i = 0; i < 4; i++)
+        {
+            t[i] = _mm512_shuffle_f32x4(r[i], r[i + 4], _MM_SHUFFLE(2, 0, 2, 0));
+            t[i + 4] = _mm512_shuffle_f32x4(r[i], r[i + 4], _MM_SHUFFLE(3, 1, 3, 1));
+            t[i + 8] = _mm512_shuffle_f32x4(r[i + 8], r[i + 12], _MM_SHUFFLE(2, 0, 2, 0));
+            t[i + 12] = _mm512_shuffle_f32x4(r[i + 8], r[i + 12], _MM_SHUFFLE(3, 1, 3, 1));
+        }
+        for (int i = 0; i < 8; i++)
+        {
+            _mm512_storeu_ps(pOut[i].m[0], _mm512_shuffle_f32x4(t[i], t[i + 8], _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm512_storeu_ps(pOut[i + 8].m[0], _mm512_shuffle_f32x4(t[i], t[i + 8], _MM_SHUFFLE(3, 1, 3, 1)));
+        }
+    }
+};
+#elif defined(SIMD_LANES_AVX2)
+struct SIMDLanes
+{
+    typedef __m256 Float;
+    typedef __m256 Mask;
+    static const unsigned int Width = 8;
+
+    static Float Load(const float *p) { return _mm256_loadu_ps(p); }
+    static Float Set(float value) { return _mm256_set1_ps(value); }
+    static Float Add(Float a, Float b) { return _mm256_add_ps(a, b); }
+    static Float Sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+    static Float Mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+    static Float MulAdd(Float a, Float b, Float c) { return _mm256_fmadd_ps(a, b, c); }
+    static Float Abs(Float a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static Float Round(Float a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static Mask Greater(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static Float Select(Mask mask, Float a, Float b) { return _mm256_blendv_ps(b, a, mask); }
+    static Float Min(Float a, Float b) { return _mm256_min_ps(a, b); }
+    static unsigned int MaskBits(Mask mask) { return (unsigned int)_mm256_movemask_ps(mask); }
+
+    // Writes all 8 lanes, the kept indices first: the lane numbers of each
+    // mask's set bits come 4 bits apiece from a table
+    static unsigned int StoreIndices(unsigned int *pOut, unsigned int first, unsigned int bits)
+    {
+        struct LeftPackTable
+        {
+            unsigned int lanes[256];
+
+            LeftPackTable()
+            {
+                for (unsigned int mask = 0; mask < 256; mask++)
+                {
+                    lanes[mask] = 0;
+                    unsigned int n = 0;
+                    for (unsigned int i = 0; i < 8; i++)
+                    {
+                        if (mask & (1u << i))
+                            lanes[mask] |= i << (4 * n++);
+                    }
+                }
+            }
+        };
+        static const LeftPackTable table;
+
+        __m256i lanes = _mm256_srlv_epi32(_mm256_set1_epi32((int)table.lanes[bits]), _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+        lanes = _mm256_and_si256(lanes, _mm256_set1_epi32(0xF));
+        _mm256_storeu_si256((__m256i *)pOut, _mm256_add_epi32(lanes, _mm256_set1_epi32((int)first)));
+        return (unsigned int)_mm_popcnt_u32(bits);
+    }
+
+    // Two 8 x 8 transposes, elements 0-7 and 8-15 of each matrix
+    static void StoreMatrices(const Float m[16], XMMATRIX *pOut)
+    {
+        for (int half = 0; half < 2; half++)
+        {
+            const __m256 *r = m + half * 8;
+            __m256 t[8];
+            __m256 s[8];
+            for (int i = 0; i < 8; i += 2)
+            {
+                t[i] = _mm256_unpacklo_ps(r[i], r[i + 1]);
+                t[i + 1] = _mm256_unpackhi_ps(r[i], r[i + 1]);
+            }
+            for (int i = 0; i < 8; i += 4)
+            {
+                s[i] = _mm256_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+                s[i + 1] = _mm256_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+                s[i + 2] = _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+                s[i + 3] = _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+            }
+            for (int i = 0; i < 4; i++)
+            {
+                _mm256_storeu_ps(pOut[i].m[half * 2], _mm256_permute2f128_ps(s[i], s[i + 4], 0x20));
+                _mm256_storeu_ps(pOut[i + 4].m[half * 2], _mm256_permute2f128_ps(s[i], s[i + 4], 0x31));
+            }
+        }
+    }
+};
+#elif defined(SIMD_LANES_SSE2)
+struct SIMDLanes
+{
+    typedef __m128 Float;
+    typedef __m128 Mask;
+    static const unsigned int Width = 4;
+
+    static Float Load(const float *p) { return _mm_loadu_ps(p); }
+    static Float Set(float value) { return _mm_set1_ps(value); }
+    static Float Add(Float a, Float b) { return _mm_add_ps(a, b); }
+    static Float Sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+    static Float Mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+    static Float MulAdd(Float a, Float b, Float c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static Float Abs(Float a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static Float Round(Float a) { return _mm_cvtepi32_ps(_mm_cvtps_epi32(a)); } // Nearest even, like nearbyintf
+    static Mask Greater(Float a, Float b) { return _mm_cmpgt_ps(a, b); }
+    static Float Select(Mask mask, Float a, Float b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+    static Float Min(Float a, Float b) { return _mm_min_ps(a, b); }
+    static unsigned int MaskBits(Mask mask) { return (unsigned int)_mm_movemask_ps(mask); }
+    static unsigned int StoreIndices(unsigned int *pOut, unsigned int first, unsigned int bits) { return StoreIndexBits(pOut, first, bits, Width); }
+
+    // Every row is a 4 x 4 transpose of one element quad
+    static void StoreMatrices(const Float m[16], XMMATRIX *pOut)
+    {
+        for (int row = 0; row < 4; row++)
+        {
+            __m128 r0 = m[row * 4];
+            __m128 r1 = m[row * 4 + 1];
+            __m128 r2 = m[row * 4 + 2];
+            __m128 r3 = m[row * 4 + 3];
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(pOut[0].m[row], r0);
+            _mm_storeu_ps(pOut[1].m[row], r1);
+            _mm_storeu_ps(pOut[2].m[row], r2);
+            _mm_storeu_ps(pOut[3].m[row], r3);
+        }
+    }
+};
+#endif
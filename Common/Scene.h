@@ -0,0 +1,40 @@
+#pragma once
+
+// What a sample provides to the platform layer: resources to create, what to
+// draw each frame and how to react to input. Everything device related goes
+// through the Renderer it is handed.
+
+#include "Renderer.h"
+
+class Scene
+{
+public:
+    virtual ~Scene() {}
+
+    // Adjust the creation settings, defaults are a depth buffer and no culling
+    virtual void GetRendererDesc(RendererDesc &desc)
+    {
+        desc.bDepthBuffer = true;
+        desc.cullMode = CULL_MODE_NONE;
+    }
+
+    virtual int Initialize(Renderer *pRenderer) = 0; // 0 on success
+    virtual void Resize(int width, int height) = 0;  // Rebuild the projection
+    virtual void Render(Renderer *pRenderer) = 0;    // Clear and draw, the platform layer presents
+    virtual void Update(float stepSeconds) { (void)stepSeconds; } // One fixed simulation step, SimulationClock in Clock.h
+    virtual void Interpolate(float alpha) { (void)alpha; }          // Before Render, 0..1 from the previous step to the last one
+    virtual void OnKeyDown(unsigned int key) { (void)key; } // Upper case for letters, like WM_KEYDOWN
+
+    // Sample specific command line option, "--name value" or a bare "--name"
+    // with value NULL; called before Initialize, false for an unknown option
+    virtual bool SetOption(const char *name, const char *value)
+    {
+        (void)name;
+        (void)value;
+        return false;
+    }
+    virtual void Cleanup() {}
+};
+
+// Implemented once by every sample
+Scene *CreateScene();
@@ -0,0 +1,246 @@
+#ifdef _WIN32
+#include <windows.h>
+#include <d3dcompiler.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+#include "ShaderCache.h"
+#include "Log.h"
+
+#ifdef _MSC_VER
+#pragma comment(lib, "d3dcompiler.lib")
+#endif
+
+// Header in front of the bytecode, a blob whose header does not match is
+// treated as a miss and rebuilt
+struct ShaderCacheHeader
+{
+    char magic[4]; // "SHC1"
+    unsigned int size;
+    unsigned long long key;
+    unsigned long long contentHash;
+};
+
+static ShaderCacheStats gShaderCacheStats = {0, 0, 0.0};
+
+// FNV-1a, 64 bit
+static unsigned long long hashBytes(unsigned long long hash, const void *pData, size_t size)
+{
+    const unsigned char *pBytes = (const unsigned char *)pData;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= pBytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Strings are hashed with their terminator so "ab" + "c" and "a" + "bc" differ
+static unsigned long long hashString(unsigned long long hash, const char *string)
+{
+    if (string == NULL)
+        string = "";
+    return hashBytes(hash, string, strlen(string) + 1);
+}
+
+static std::string cachePath(unsigned long long key, const char *extension)
+{
+    char fileName[64];
+    snprintf(fileName, sizeof(fileName), "%016llx%s", key, extension);
+    return std::string(SHADER_CACHE_DIRECTORY) + "/" + fileName;
+}
+
+unsigned long long ShaderCacheKey(const ShaderCompileDesc &desc, const std::string &source)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    hash = hashBytes(hash, source.data(), source.size());
+    hash = hashBytes(hash, &desc.numDefines, sizeof(desc.numDefines));
+    for (unsigned int i = 0; i < desc.numDefines; i++)
+    {
+        hash = hashString(hash, desc.pDefines[i].name);
+        hash = hashString(hash, desc.pDefines[i].value);
+    }
+    hash = hashString(hash, desc.entryPoint);
+    hash = hashString(hash, desc.target);
+    hash = hashBytes(hash, &desc.flags, sizeof(desc.flags));
+#ifdef D3D_COMPILER_VERSION
+    unsigned int compilerVersion = D3D_COMPILER_VERSION;
+    hash = hashBytes(hash, &compilerVersion, sizeof(compilerVersion));
+#endif
+    return hash;
+}
+
+bool ShaderCacheLoad(unsigned long long key, std::vector<unsigned char> &bytecode)
+{
+    FILE *pFile = fopen(cachePath(key, ".cso").c_str(), "rb");
+    if (pFile == NULL)
+        return false;
+
+    ShaderCacheHeader header;
+    bool bValid = fread(&header, sizeof(header), 1, pFile) == 1 &&
+                  memcmp(header.magic, "SHC1", 4) == 0 &&
+                  header.key == key &&
+                  header.size > 0;
+    if (bValid)
+    {
+        bytecode.resize(header.size);
+        bValid = fread(bytecode.data(), 1, header.size, pFile) == header.size &&
+                 hashBytes(14695981039346656037ULL, bytecode.data(), header.size) == header.contentHash;
+    }
+    fclose(pFile);
+
+    if (!bValid)
+        bytecode.clear();
+    return bValid;
+}
+
+bool ShaderCacheStore(unsigned long long key, const void *pBytecode, size_t size)
+{
+#ifdef _WIN32
+    CreateDirectoryA(SHADER_CACHE_DIRECTORY, NULL);
+#else
+    mkdir(SHADER_CACHE_DIRECTORY, 0755);
+#endif
+
+    ShaderCacheHeader header;
+    memcpy(header.magic, "SHC1", 4);
+    header.size = (unsigned int)size;
+    header.key = key;
+    header.contentHash = hashBytes(14695981039346656037ULL, pBytecode, size);
+
+    // Write next to the final name and rename, so a reader never sees half a blob
+    std::string tempPath = cachePath(key, ".tmp");
+    std::string finalPath = cachePath(key, ".cso");
+    FILE *pFile = fopen(tempPath.c_str(), "wb");
+    if (pFile == NULL)
+        return false;
+    bool bWritten = fwrite(&header, sizeof(header), 1, pFile) == 1 &&
+                    fwrite(pBytecode, 1, size, pFile) == size;
+    fclose(pFile);
+    if (!bWritten)
+    {
+        remove(tempPath.c_str());
+        return false;
+    }
+
+#ifdef _WIN32
+    return MoveFileExA(tempPath.c_str(), finalPath.c_str(), MOVEFILE_REPLACE_EXISTING) != FALSE;
+#else
+    return rename(tempPath.c_str(), finalPath.c_str()) == 0;
+#endif
+}
+
+void ShaderCacheClear()
+{
+#ifdef _WIN32
+    WIN32_FIND_DATAA findData;
+    HANDLE hFind = FindFirstFileA(SHADER_CACHE_DIRECTORY "\\*.cso", &findData);
+    if (hFind == INVALID_HANDLE_VALUE)
+        return;
+    do
+    {
+        std::string path = std::string(SHADER_CACHE_DIRECTORY) + "\\" + findData.cFileName;
+        DeleteFileA(path.c_str());
+    } while (FindNextFileA(hFind, &findData));
+    FindClose(hFind);
+#else
+    DIR *pDirectory = opendir(SHADER_CACHE_DIRECTORY);
+    if (pDirectory == NULL)
+        return;
+    struct dirent *pEntry;
+    while ((pEntry = readdir(pDirectory)) != NULL)
+    {
+        size_t length = strlen(pEntry->d_name);
+        if (length > 4 && strcmp(pEntry->d_name + length - 4, ".cso") == 0)
+            unlink((std::string(SHADER_CACHE_DIRECTORY) + "/" + pEntry->d_name).c_str());
+    }
+    closedir(pDirectory);
+#endif
+}
+
+ShaderCacheStats ShaderCacheGetStats()
+{
+    return gShaderCacheStats;
+}
+
+#ifdef _WIN32
+
+bool ShaderCacheCompile(const ShaderCompileDesc &desc, std::vector<unsigned char> &bytecode)
+{
+    std::ifstream shaderFile(desc.filePath, std::ios::in | std::ios::binary);
+    if (!shaderFile.is_open())
+    {
+        LogError("Failed to open shader file: %s\n", desc.filePath);
+        return false;
+    }
+    std::stringstream shaderStream;
+    shaderStream << shaderFile.rdbuf();
+    std::string source = shaderStream.str();
+
+    unsigned long long key = ShaderCacheKey(desc, source);
+    if (ShaderCacheLoad(key, bytecode))
+    {
+        gShaderCacheStats.hits++;
+        Log("Shader Cache Hit for %s %s\n", desc.filePath, desc.target);
+        return true;
+    }
+    gShaderCacheStats.misses++;
+
+    // D3DCompile wants a NULL terminated macro list
+    std::vector<D3D_SHADER_MACRO> macros(desc.numDefines + 1);
+    for (unsigned int i = 0; i < desc.numDefines; i++)
+    {
+        macros[i].Name = desc.pDefines[i].name;
+        macros[i].Definition = desc.pDefines[i].value;
+    }
+    macros[desc.numDefines].Name = NULL;
+    macros[desc.numDefines].Definition = NULL;
+
+    ID3DBlob *pID3DBlob_Code = NULL;
+    ID3DBlob *pID3DBlob_Error = NULL;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    HRESULT hr = D3DCompile(source.c_str(),
+                            source.length(),
+                            desc.filePath,
+                            macros.data(),
+                            D3D_COMPILE_STANDARD_FILE_INCLUDE,
+                            desc.entryPoint,
+                            desc.target,
+                            desc.flags,
+                            0,
+                            &pID3DBlob_Code,
+                            &pID3DBlob_Error);
+    gShaderCacheStats.compileMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    if (FAILED(hr))
+    {
+        LogError("%s Compiling Error = %s\n", desc.filePath, pID3DBlob_Error ? (char *)pID3DBlob_Error->GetBufferPointer() : "");
+        if (pID3DBlob_Error)
+            pID3DBlob_Error->Release();
+        return false;
+    }
+    Log("%s Compiling Successful\n", desc.filePath);
+
+    // warnings only, nothing to report
+    if (pID3DBlob_Error)
+        pID3DBlob_Error->Release();
+
+    const unsigned char *pCode = (const unsigned char *)pID3DBlob_Code->GetBufferPointer();
+    bytecode.assign(pCode, pCode + pID3DBlob_Code->GetBufferSize());
+    pID3DBlob_Code->Release();
+
+    if (!ShaderCacheStore(key, bytecode.data(), bytecode.size()))
+        LogWarning("Shader Cache Store Failed for %s\n", desc.filePath);
+    return true;
+}
+
+#endif // _WIN32
@@ -0,0 +1,54 @@
+#pragma once
+
+// Compiled shader cache
+// Bytecode is kept in ShaderCache/<key>.cso next to the sample, where key is a
+// hash of everything that changes the compiler output: source text, defines,
+// entry point, target profile, compile flags and compiler version. A warm start
+// reads the blob instead of calling D3DCompile; editing a shader or changing a
+// define produces a new key, so stale blobs are simply never looked up again.
+// Tools/ShaderCompiler fills the cache at build time through the same
+// ShaderCacheCompile() the D3D11 backend uses at run time.
+//
+// The key covers the top level file only, #include'd files are not hashed.
+
+#include <string>
+#include <vector>
+
+#define SHADER_CACHE_DIRECTORY "ShaderCache"
+#define SHADER_CACHE_COMPILE_FLAGS 0 // D3DCOMPILE_* flags every shader is built with
+
+// Same pair as D3D_SHADER_MACRO
+struct ShaderDefine
+{
+    const char *name;
+    const char *value;
+};
+
+struct ShaderCompileDesc
+{
+    const char *filePath;
+    const ShaderDefine *pDefines;
+    unsigned int numDefines;
+    const char *entryPoint; // "main" in every sample
+    const char *target;     // vs_5_0 or ps_5_0
+    unsigned int flags;
+};
+
+struct ShaderCacheStats
+{
+    unsigned int hits;
+    unsigned int misses;
+    double compileMilliseconds; // Time spent in D3DCompile for the misses
+};
+
+unsigned long long ShaderCacheKey(const ShaderCompileDesc &desc, const std::string &source);
+bool ShaderCacheLoad(unsigned long long key, std::vector<unsigned char> &bytecode);
+bool ShaderCacheStore(unsigned long long key, const void *pBytecode, size_t size);
+void ShaderCacheClear(); // Delete every cached blob, the next start is a cold one
+ShaderCacheStats ShaderCacheGetStats();
+
+#ifdef _WIN32
+// Read desc.filePath and return its bytecode from the cache, compiling and
+// storing it on a miss. Compile errors go to Log.txt.
+bool ShaderCacheCompile(const ShaderCompileDesc &desc, std::vector<unsigned char> &bytecode);
+#endif
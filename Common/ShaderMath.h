@@ -0,0 +1,57 @@
+#pragma once
+
+// Helpers for the C++ ports of the HLSL shaders run by the software renderer.
+// Matrices in the cbuffers are XMMATRIX (row major) and the shaders use
+// mul(matrix, vector), which for that layout is row vector * matrix.
+
+#include <math.h>
+
+// mul(m, float4(v, 1.0)) for a position
+static inline void MulPosition(float out[4], const float v[3], const void *pMatrix)
+{
+    const float *m = (const float *)pMatrix;
+    for (int c = 0; c < 4; c++)
+        out[c] = v[0] * m[c] + v[1] * m[4 + c] + v[2] * m[8 + c] + m[12 + c];
+}
+
+// mul(m, v) for a float4
+static inline void MulVector4(float out[4], const float v[4], const void *pMatrix)
+{
+    const float *m = (const float *)pMatrix;
+    for (int c = 0; c < 4; c++)
+        out[c] = v[0] * m[c] + v[1] * m[4 + c] + v[2] * m[8 + c] + v[3] * m[12 + c];
+}
+
+// mul((float3x3)m, v) for a normal
+static inline void MulVector3(float out[3], const float v[3], const void *pMatrix)
+{
+    const float *m = (const float *)pMatrix;
+    for (int c = 0; c < 3; c++)
+        out[c] = v[0] * m[c] + v[1] * m[4 + c] + v[2] * m[8 + c];
+}
+
+static inline float Dot3(const float a[3], const float b[3])
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static inline void Normalize3(float v[3])
+{
+    float length = sqrtf(Dot3(v, v));
+    if (length > 0.0f)
+    {
+        float invLength = 1.0f / length;
+        v[0] *= invLength;
+        v[1] *= invLength;
+        v[2] *= invLength;
+    }
+}
+
+// reflect(i, n) = i - 2 * dot(n, i) * n
+static inline void Reflect3(float out[3], const float i[3], const float n[3])
+{
+    float d = 2.0f * Dot3(n, i);
+    out[0] = i[0] - d * n[0];
+    out[1] = i[1] - d * n[1];
+    out[2] = i[2] - d * n[2];
+}
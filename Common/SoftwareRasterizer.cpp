@@ -0,0 +1,557 @@
+// Portable tile-based software rasterizer
+// Pipeline per draw:
+//  1. vertex phase   - run the vertex shader once per vertex, in parallel
+//  2. setup phase    - assemble, clip and cull triangles, bin them into tiles
+//  3. raster phase   - every thread walks whole tiles, so no two threads touch the same pixel
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <atomic>
+
+#include "JobSystem.h"
+#include "SoftwareRasterizer.h"
+#include "VertexEncoding.h"
+
+// Fixed point precision of screen positions
+#define SUBPIXEL_BITS 8
+#define SUBPIXEL_ONE (1 << SUBPIXEL_BITS)
+
+// Guard band in multiples of w, keeps fixed point coordinates inside int range
+#define GUARD_BAND 32.0f
+
+// Triangles per setup job
+#define TRIANGLES_PER_CHUNK 1024
+
+// Clip planes as (a, b, c, d), inside when a*x + b*y + c*z + d*w >= 0
+static const float clipPlanes[][4] = {
+    {0.0f, 0.0f, 1.0f, 0.0f},        // near, D3D clip space z >= 0
+    {0.0f, 0.0f, -1.0f, 1.0f},       // far, z <= w
+    {1.0f, 0.0f, 0.0f, GUARD_BAND},  // left guard band
+    {-1.0f, 0.0f, 0.0f, GUARD_BAND}, // right guard band
+    {0.0f, 1.0f, 0.0f, GUARD_BAND},  // bottom guard band
+    {0.0f, -1.0f, 0.0f, GUARD_BAND}, // top guard band
+};
+static const int numClipPlanes = sizeof(clipPlanes) / sizeof(clipPlanes[0]);
+
+static inline float planeDistance(const float plane[4], const float position[4])
+{
+    return plane[0] * position[0] + plane[1] * position[1] + plane[2] * position[2] + plane[3] * position[3];
+}
+
+static inline int floorDiv(int a, int b)
+{
+    return (a >= 0) ? (a / b) : -((-a + b - 1) / b);
+}
+
+static inline unsigned int packColor(const float color[4])
+{
+    unsigned int packed = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        float c = std::min(std::max(color[i], 0.0f), 1.0f);
+        packed |= ((unsigned int)(c * 255.0f + 0.5f)) << (8 * i);
+    }
+    return packed;
+}
+
+// Constructor
+SoftwareRasterizer::SoftwareRasterizer() : width(0),
+                                           height(0),
+                                           tilesX(0),
+                                           tilesY(0),
+                                           depthPitch(0),
+                                           depthRows(0)
+{
+    ResetStatistics();
+}
+
+// Destructor
+SoftwareRasterizer::~SoftwareRasterizer()
+{
+    Cleanup();
+}
+
+bool SoftwareRasterizer::Initialize(int width, int height)
+{
+    Resize(width, height);
+    return true;
+}
+
+unsigned int SoftwareRasterizer::Resize(int width, int height)
+{
+    this->width = std::max(width, 1);
+    this->height = std::max(height, 1);
+    tilesX = (this->width + SR_TILE_SIZE - 1) / SR_TILE_SIZE;
+    tilesY = (this->height + SR_TILE_SIZE - 1) / SR_TILE_SIZE;
+
+    // the color buffer is the presented image and always matches the size,
+    // it only allocates when it outgrows its capacity
+    unsigned int allocations = 0;
+    size_t pixels = (size_t)this->width * this->height;
+    if (pixels > colorBuffer.capacity())
+        allocations++;
+    colorBuffer.assign(pixels, 0);
+
+    // the depth buffer keeps the largest size seen, smaller frames use its top left corner
+    if (this->width > depthPitch || this->height > depthRows)
+    {
+        depthPitch = std::max(depthPitch, this->width);
+        depthRows = std::max(depthRows, this->height);
+        depthBuffer.assign((size_t)depthPitch * depthRows, 1.0f);
+        allocations++;
+    }
+
+    // bins depend on tile count
+    chunks.clear();
+    return allocations;
+}
+
+void SoftwareRasterizer::Clear(const float color[4], float depth)
+{
+    std::fill(colorBuffer.begin(), colorBuffer.end(), packColor(color));
+    for (int y = 0; y < height; y++)
+    {
+        float *pDepthRow = &depthBuffer[(size_t)y * depthPitch];
+        std::fill(pDepthRow, pDepthRow + width, depth);
+    }
+}
+
+void SoftwareRasterizer::ResetStatistics()
+{
+    memset(&statistics, 0, sizeof(SRStatistics));
+}
+
+// Expand one packed attribute to float4, missing components read as 0 and w as 1
+static void decodeAttribute(SRVertexFormat format, const void *pElement, float out[4])
+{
+    out[0] = out[1] = out[2] = 0.0f;
+    out[3] = 1.0f;
+    switch (format)
+    {
+    case SR_VERTEX_FORMAT_HALF4:
+        for (int i = 0; i < 4; i++)
+            out[i] = HalfToFloat(((const unsigned short *)pElement)[i]);
+        break;
+    case SR_VERTEX_FORMAT_SNORM16X2:
+        out[0] = Snorm16ToFloat(((const short *)pElement)[0]);
+        out[1] = Snorm16ToFloat(((const short *)pElement)[1]);
+        break;
+    case SR_VERTEX_FORMAT_UNORM16X2:
+        out[0] = Unorm16ToFloat(((const unsigned short *)pElement)[0]);
+        out[1] = Unorm16ToFloat(((const unsigned short *)pElement)[1]);
+        break;
+    default:
+        break; // Float streams are never decoded
+    }
+}
+
+void SoftwareRasterizer::Draw(const SRDrawDesc &desc)
+{
+    unsigned int numPrimitiveVertices = (desc.pIndices16 || desc.pIndices32) ? desc.indexCount : desc.vertexCount;
+    unsigned int numTriangles = 0;
+    if (desc.topology == SR_TOPOLOGY_TRIANGLE_STRIP)
+        numTriangles = (numPrimitiveVertices >= 3) ? numPrimitiveVertices - 2 : 0;
+    else
+        numTriangles = numPrimitiveVertices / 3;
+    if (numTriangles == 0 || desc.vertexShader == NULL || desc.pixelShader == NULL)
+        return;
+
+    // 1. vertex phase
+    if (vertexCache.size() < desc.vertexCount)
+        vertexCache.resize(desc.vertexCount);
+
+    const unsigned int verticesPerJob = 1024;
+    JobParallelFor(desc.vertexCount, verticesPerJob, [&](unsigned int first, unsigned int last)
+                   {
+        SRVertexInput input;
+        memset(&input, 0, sizeof(SRVertexInput));
+        float decoded[SR_MAX_ATTRIBUTES][4];
+        for (unsigned int v = first; v < last; v++)
+        {
+            for (unsigned int a = 0; a < desc.numAttributes; a++)
+            {
+                const void *pElement = (const char *)desc.streams[a].pData + (size_t)v * desc.streams[a].stride;
+                if (desc.streams[a].format == SR_VERTEX_FORMAT_FLOAT)
+                    input.attributes[a] = (const float *)pElement;
+                else
+                {
+                    decodeAttribute(desc.streams[a].format, pElement, decoded[a]);
+                    input.attributes[a] = decoded[a];
+                }
+            }
+            desc.vertexShader(desc.context, input, vertexCache[v]);
+        } });
+
+    // 2. setup phase
+    unsigned int numChunks = (numTriangles + TRIANGLES_PER_CHUNK - 1) / TRIANGLES_PER_CHUNK;
+    if (chunks.size() < numChunks)
+        chunks.resize(numChunks);
+
+    JobParallelFor(numChunks, 1, [&](unsigned int firstChunk, unsigned int lastChunk)
+                   {
+        for (unsigned int c = firstChunk; c < lastChunk; c++)
+        {
+            TriangleChunk &chunk = chunks[c];
+            chunk.triangles.clear();
+            chunk.bins.resize((size_t)tilesX * tilesY);
+            for (size_t b = 0; b < chunk.bins.size(); b++)
+                chunk.bins[b].clear();
+
+            unsigned int first = c * TRIANGLES_PER_CHUNK;
+            unsigned int last = std::min(first + TRIANGLES_PER_CHUNK, numTriangles);
+            for (unsigned int t = first; t < last; t++)
+            {
+                // strips flip the winding of every odd triangle back to the first one
+                unsigned int corners[3] = {3 * t, 3 * t + 1, 3 * t + 2};
+                if (desc.topology == SR_TOPOLOGY_TRIANGLE_STRIP)
+                {
+                    corners[0] = (t & 1) ? t + 1 : t;
+                    corners[1] = (t & 1) ? t : t + 1;
+                    corners[2] = t + 2;
+                }
+
+                const SRVertexOutput *pVertices[3];
+                for (int i = 0; i < 3; i++)
+                {
+                    unsigned int index = corners[i];
+                    if (desc.pIndices16)
+                        index = desc.pIndices16[index];
+                    else if (desc.pIndices32)
+                        index = desc.pIndices32[index];
+                    if (index >= desc.vertexCount)
+                        index = 0;
+                    pVertices[i] = &vertexCache[index];
+                }
+                setupTriangle(desc, pVertices, chunk);
+            }
+        } });
+
+    // 3. raster phase
+    std::atomic<unsigned long long> fragments(0);
+    JobParallelFor((unsigned int)(tilesX * tilesY), 1, [&](unsigned int firstTile, unsigned int lastTile)
+                   {
+        for (unsigned int tile = firstTile; tile < lastTile; tile++)
+            fragments += rasterizeTile(desc, tile); });
+
+    unsigned long long rasterized = 0;
+    for (unsigned int c = 0; c < numChunks; c++)
+        rasterized += chunks[c].triangles.size();
+
+    statistics.drawCalls++;
+    statistics.verticesShaded += desc.vertexCount;
+    statistics.trianglesSubmitted += numTriangles;
+    statistics.trianglesRasterized += rasterized;
+    statistics.fragmentsShaded += fragments;
+
+    // unused chunks keep stale triangles, make sure the next raster pass ignores them
+    for (size_t c = numChunks; c < chunks.size(); c++)
+        chunks[c].triangles.clear();
+}
+
+// Trivially accept, reject or clip one triangle and pass the pieces on to emitTriangle
+void SoftwareRasterizer::setupTriangle(const SRDrawDesc &desc, const SRVertexOutput *pVertices[3], TriangleChunk &chunk)
+{
+    int outsideAll = ~0;
+    int outsideAny = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        int outcode = 0;
+        for (int p = 0; p < numClipPlanes; p++)
+        {
+            if (planeDistance(clipPlanes[p], pVertices[i]->position) < 0.0f)
+                outcode |= (1 << p);
+        }
+        outsideAll &= outcode;
+        outsideAny |= outcode;
+    }
+
+    // whole triangle outside one plane
+    if (outsideAll)
+        return;
+
+    // x and y outside the view frustum (but inside the guard band) are handled by the scissor
+    if (outsideAny == 0)
+    {
+        emitTriangle(desc, *pVertices[0], *pVertices[1], *pVertices[2], chunk);
+        return;
+    }
+
+    // Sutherland-Hodgman against the planes the triangle crosses
+    SRVertexOutput polygon[2][3 + numClipPlanes];
+    int count = 3;
+    int current = 0;
+    for (int i = 0; i < 3; i++)
+        polygon[0][i] = *pVertices[i];
+
+    unsigned int numFloats = 4 + desc.numVaryings;
+    for (int p = 0; p < numClipPlanes && count >= 3; p++)
+    {
+        if ((outsideAny & (1 << p)) == 0)
+            continue;
+
+        const SRVertexOutput *pIn = polygon[current];
+        SRVertexOutput *pOut = polygon[current ^ 1];
+        int outCount = 0;
+        for (int i = 0; i < count; i++)
+        {
+            const SRVertexOutput &a = pIn[i];
+            const SRVertexOutput &b = pIn[(i + 1) % count];
+            float da = planeDistance(clipPlanes[p], a.position);
+            float db = planeDistance(clipPlanes[p], b.position);
+            if (da >= 0.0f)
+                pOut[outCount++] = a;
+            if ((da >= 0.0f) != (db >= 0.0f))
+            {
+                float t = da / (da - db);
+                const float *pa = a.position;
+                const float *pb = b.position;
+                float *po = pOut[outCount].position;
+                // position and varyings are laid out back to back
+                for (unsigned int f = 0; f < numFloats; f++)
+                    po[f] = pa[f] + t * (pb[f] - pa[f]);
+                outCount++;
+            }
+        }
+        count = outCount;
+        current ^= 1;
+    }
+
+    // triangulate as a fan
+    for (int i = 1; i + 1 < count; i++)
+    {
+        emitTriangle(desc, polygon[current][0], polygon[current][i], polygon[current][i + 1], chunk);
+    }
+}
+
+// Project to screen space, cull and bin a triangle that is fully inside the clip volume
+void SoftwareRasterizer::emitTriangle(const SRDrawDesc &desc, const SRVertexOutput &v0, const SRVertexOutput &v1, const SRVertexOutput &v2, TriangleChunk &chunk)
+{
+    const SRVertexOutput *pVertices[3] = {&v0, &v1, &v2};
+    SetupTriangle triangle;
+
+    for (int i = 0; i < 3; i++)
+    {
+        const float *position = pVertices[i]->position;
+        float invW = 1.0f / position[3];
+        float ndcX = position[0] * invW;
+        float ndcY = position[1] * invW;
+
+        // viewport transform, y points down on screen
+        float screenX = (ndcX * 0.5f + 0.5f) * (float)width;
+        float screenY = (0.5f - ndcY * 0.5f) * (float)height;
+        triangle.x[i] = (int)lrintf(screenX * SUBPIXEL_ONE);
+        triangle.y[i] = (int)lrintf(screenY * SUBPIXEL_ONE);
+        triangle.z[i] = position[2] * invW;
+        triangle.invW[i] = invW;
+        for (unsigned int v = 0; v < desc.numVaryings; v++)
+            triangle.varyings[i][v] = pVertices[i]->varyings[v] * invW;
+    }
+
+    // signed area, positive for clockwise triangles on screen (D3D front faces)
+    long long area = (long long)(triangle.x[1] - triangle.x[0]) * (triangle.y[2] - triangle.y[0]) -
+                     (long long)(triangle.x[2] - triangle.x[0]) * (triangle.y[1] - triangle.y[0]);
+    if (area == 0)
+        return;
+    if (desc.cullMode == SR_CULL_BACK && area < 0)
+        return;
+    if (desc.cullMode == SR_CULL_FRONT && area > 0)
+        return;
+
+    // rasterizer expects positive area, swap winding
+    if (area < 0)
+    {
+        std::swap(triangle.x[1], triangle.x[2]);
+        std::swap(triangle.y[1], triangle.y[2]);
+        std::swap(triangle.z[1], triangle.z[2]);
+        std::swap(triangle.invW[1], triangle.invW[2]);
+        for (unsigned int v = 0; v < desc.numVaryings; v++)
+            std::swap(triangle.varyings[1][v], triangle.varyings[2][v]);
+    }
+
+    // pixel bounding box, pixel centers sit at +0.5
+    int minFx = std::min(triangle.x[0], std::min(triangle.x[1], triangle.x[2]));
+    int maxFx = std::max(triangle.x[0], std::max(triangle.x[1], triangle.x[2]));
+    int minFy = std::min(triangle.y[0], std::min(triangle.y[1], triangle.y[2]));
+    int maxFy = std::max(triangle.y[0], std::max(triangle.y[1], triangle.y[2]));
+    const int half = SUBPIXEL_ONE / 2;
+    triangle.minX = std::max(floorDiv(minFx - half + SUBPIXEL_ONE - 1, SUBPIXEL_ONE), 0);
+    triangle.minY = std::max(floorDiv(minFy - half + SUBPIXEL_ONE - 1, SUBPIXEL_ONE), 0);
+    triangle.maxX = std::min(floorDiv(maxFx - half, SUBPIXEL_ONE), width - 1);
+    triangle.maxY = std::min(floorDiv(maxFy - half, SUBPIXEL_ONE), height - 1);
+    if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+        return;
+
+    unsigned int index = (unsigned int)chunk.triangles.size();
+    chunk.triangles.push_back(triangle);
+
+    int tileX0 = triangle.minX / SR_TILE_SIZE;
+    int tileX1 = triangle.maxX / SR_TILE_SIZE;
+    int tileY0 = triangle.minY / SR_TILE_SIZE;
+    int tileY1 = triangle.maxY / SR_TILE_SIZE;
+    for (int ty = tileY0; ty <= tileY1; ty++)
+    {
+        for (int tx = tileX0; tx <= tileX1; tx++)
+        {
+            chunk.bins[ty * tilesX + tx].push_back(index);
+        }
+    }
+}
+
+// Rasterize every binned triangle overlapping one tile, in submission order
+unsigned long long SoftwareRasterizer::rasterizeTile(const SRDrawDesc &desc, unsigned int tile)
+{
+    int tileMinX = (int)(tile % tilesX) * SR_TILE_SIZE;
+    int tileMinY = (int)(tile / tilesX) * SR_TILE_SIZE;
+    int tileMaxX = std::min(tileMinX + SR_TILE_SIZE, width) - 1;
+    int tileMaxY = std::min(tileMinY + SR_TILE_SIZE, height) - 1;
+    unsigned long long fragments = 0;
+
+    float varyings[SR_MAX_VARYINGS];
+    float color[4];
+
+    for (size_t c = 0; c < chunks.size(); c++)
+    {
+        const TriangleChunk &chunk = chunks[c];
+        if (chunk.triangles.empty())
+            continue;
+
+        const std::vector<unsigned int> &bin = chunk.bins[tile];
+        for (size_t b = 0; b < bin.size(); b++)
+        {
+            const SetupTriangle &tri = chunk.triangles[bin[b]];
+            int minX = std::max(tri.minX, tileMinX);
+            int maxX = std::min(tri.maxX, tileMaxX);
+            int minY = std::max(tri.minY, tileMinY);
+            int maxY = std::min(tri.maxY, tileMaxY);
+            if (minX > maxX || minY > maxY)
+                continue;
+
+            // edge equations, edge i is opposite to vertex i
+            long long edgeA[3], edgeB[3], edgeRow[3];
+            long long px = (long long)minX * SUBPIXEL_ONE + SUBPIXEL_ONE / 2;
+            long long py = (long long)minY * SUBPIXEL_ONE + SUBPIXEL_ONE / 2;
+            for (int e = 0; e < 3; e++)
+            {
+                int a = (e + 1) % 3;
+                int bIndex = (e + 2) % 3;
+                long long dx = tri.x[bIndex] - tri.x[a];
+                long long dy = tri.y[bIndex] - tri.y[a];
+                edgeA[e] = -dy * SUBPIXEL_ONE; // step per pixel in x
+                edgeB[e] = dx * SUBPIXEL_ONE;  // step per pixel in y
+                edgeRow[e] = dx * (py - tri.y[a]) - dy * (px - tri.x[a]);
+
+                // top-left fill rule, bias the edges that do not own their pixels
+                bool bTopLeft = (dy < 0) || (dy == 0 && dx > 0);
+                if (!bTopLeft)
+                    edgeRow[e] -= 1;
+            }
+            long long area = (long long)(tri.x[1] - tri.x[0]) * (tri.y[2] - tri.y[0]) -
+                   (long long)(tri.x[2] - tri.x[0]) * (tri.y[1] - tri.y[0]);
+            float invArea = 1.0f / (float)area;
+
+            for (int y = minY; y <= maxY; y++)
+            {
+                long long w0 = edgeRow[0];
+                long long w1 = edgeRow[1];
+                long long w2 = edgeRow[2];
+                unsigned int *pColorRow = &colorBuffer[(size_t)y * width];
+                float *pDepthRow = &depthBuffer[(size_t)y * depthPitch];
+
+                for (int x = minX; x <= maxX; x++)
+                {
+                    if ((w0 | w1 | w2) >= 0)
+                    {
+                        // the one unit fill rule bias is far below float precision here
+                        float b0 = (float)w0 * invArea;
+                        float b1 = (float)w1 * invArea;
+                        float b2 = 1.0f - b0 - b1;
+
+                        float z = b0 * tri.z[0] + b1 * tri.z[1] + b2 * tri.z[2];
+                        if ((!desc.bDepthTest || z < pDepthRow[x]) && z >= 0.0f && z <= 1.0f)
+                        {
+                            float invW = b0 * tri.invW[0] + b1 * tri.invW[1] + b2 * tri.invW[2];
+                            float w = 1.0f / invW;
+                            for (unsigned int v = 0; v < desc.numVaryings; v++)
+                            {
+                                varyings[v] = (b0 * tri.varyings[0][v] + b1 * tri.varyings[1][v] + b2 * tri.varyings[2][v]) * w;
+                            }
+
+                            desc.pixelShader(desc.context, varyings, color);
+                            if (desc.bDepthTest)
+                                pDepthRow[x] = z;
+                            pColorRow[x] = packColor(color);
+                            fragments++;
+                        }
+                    }
+                    w0 += edgeA[0];
+                    w1 += edgeA[1];
+                    w2 += edgeA[2];
+                }
+                edgeRow[0] += edgeB[0];
+                edgeRow[1] += edgeB[1];
+                edgeRow[2] += edgeB[2];
+            }
+        }
+    }
+    return fragments;
+}
+
+void SRSampleTexture(const SRTexture *pTexture, float u, float v, float color[4])
+{
+    SRSampleTextureArray(pTexture, u, v, 0.0f, color);
+}
+
+void SRSampleTextureArray(const SRTexture *pTexture, float u, float v, float layer, float color[4])
+{
+    if (pTexture == NULL || pTexture->texels.empty())
+    {
+        color[0] = color[1] = color[2] = 0.0f;
+        color[3] = 1.0f;
+        return;
+    }
+
+    int slice = (int)floorf(layer + 0.5f);
+    slice = slice < 0 ? 0 : (slice >= pTexture->layers ? pTexture->layers - 1 : slice);
+    const unsigned int *pTexels = &pTexture->texels[(size_t)slice * pTexture->width * pTexture->height];
+
+    // texel centers sit at +0.5
+    float x = u * (float)pTexture->width - 0.5f;
+    float y = v * (float)pTexture->height - 0.5f;
+    float floorX = floorf(x);
+    float floorY = floorf(y);
+    float fracX = x - floorX;
+    float fracY = y - floorY;
+
+    int x0 = (int)floorX % pTexture->width;
+    int y0 = (int)floorY % pTexture->height;
+    if (x0 < 0)
+        x0 += pTexture->width;
+    if (y0 < 0)
+        y0 += pTexture->height;
+    int x1 = (x0 + 1) % pTexture->width;
+    int y1 = (y0 + 1) % pTexture->height;
+
+    unsigned int t00 = pTexels[(size_t)y0 * pTexture->width + x0];
+    unsigned int t10 = pTexels[(size_t)y0 * pTexture->width + x1];
+    unsigned int t01 = pTexels[(size_t)y1 * pTexture->width + x0];
+    unsigned int t11 = pTexels[(size_t)y1 * pTexture->width + x1];
+
+    for (int c = 0; c < 4; c++)
+    {
+        int shift = 8 * c;
+        float top = (float)((t00 >> shift) & 0xFF) * (1.0f - fracX) + (float)((t10 >> shift) & 0xFF) * fracX;
+        float bottom = (float)((t01 >> shift) & 0xFF) * (1.0f - fracX) + (float)((t11 >> shift) & 0xFF) * fracX;
+        color[c] = (top * (1.0f - fracY) + bottom * fracY) * (1.0f / 255.0f);
+    }
+}
+
+// Release the buffers, the workers belong to JobSystem
+void SoftwareRasterizer::Cleanup()
+{
+    width = height = tilesX = tilesY = 0;
+    depthPitch = depthRows = 0;
+    std::vector<unsigned int>().swap(colorBuffer);
+    std::vector<float>().swap(depthBuffer);
+    std::vector<SRVertexOutput>().swap(vertexCache);
+    chunks.clear();
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+// Portable tile-based software rasterizer
+// Runs the same vertex/index streams the D3D11 samples upload, with the
+// HLSL vertex and pixel shaders replaced by equivalent C++ functions, so a
+// frame can be rendered and timed on machines without a GPU.
+
+#include <vector>
+
+// Limits
+#define SR_MAX_ATTRIBUTES 8 // Matches the number of input slots the samples use
+#define SR_MAX_VARYINGS 16  // Floats passed from vertex to pixel shader
+#define SR_MAX_CONSTANT_BUFFERS 4
+#define SR_MAX_TEXTURES 8
+#define SR_TILE_SIZE 64 // Tile edge in pixels, each tile is owned by one thread
+
+// R8G8B8A8 texture, first row is the top of the image like a D3D11 texture.
+// An array texture stores its layers one after another.
+struct SRTexture
+{
+    int width;
+    int height;
+    int layers;
+    std::vector<unsigned int> texels;
+};
+
+// Bilinear sample with wrap addressing (D3D11_FILTER_MIN_MAG_MIP_LINEAR without mips)
+void SRSampleTexture(const SRTexture *pTexture, float u, float v, float color[4]);
+
+// Texture2DArray sample, layer rounded to the nearest slice and clamped like D3D11
+void SRSampleTextureArray(const SRTexture *pTexture, float u, float v, float layer, float color[4]);
+
+// Resources bound to the shader stages, like the VS/PS Set*ConstantBuffers and PSSetShaderResources slots
+struct SRShaderContext
+{
+    const void *pConstants[SR_MAX_CONSTANT_BUFFERS]; // Constant buffer contents, same layout as the HLSL cbuffer
+    const SRTexture *pTextures[SR_MAX_TEXTURES];
+};
+
+// Vertex shader input, one pointer per input element (like D3D11_INPUT_ELEMENT_DESC)
+struct SRVertexInput
+{
+    const float *attributes[SR_MAX_ATTRIBUTES];
+};
+
+// Vertex shader output, SV_POSITION plus the interpolated varyings
+struct SRVertexOutput
+{
+    float position[4];
+    float varyings[SR_MAX_VARYINGS];
+};
+
+typedef void (*SRVertexShader)(const SRShaderContext &context, const SRVertexInput &input, SRVertexOutput &output);
+typedef void (*SRPixelShader)(const SRShaderContext &context, const float *varyings, float color[4]);
+
+enum SRTopology
+{
+    SR_TOPOLOGY_TRIANGLE_LIST = 0,
+    SR_TOPOLOGY_TRIANGLE_STRIP
+};
+
+enum SRCullMode
+{
+    SR_CULL_NONE = 0,
+    SR_CULL_FRONT,
+    SR_CULL_BACK
+};
+
+// How a stream stores its attribute; float streams are handed to the vertex
+// shader in place, the others are expanded to floats first like the IA does
+enum SRVertexFormat
+{
+    SR_VERTEX_FORMAT_FLOAT = 0,
+    SR_VERTEX_FORMAT_HALF4,     // DXGI_FORMAT_R16G16B16A16_FLOAT
+    SR_VERTEX_FORMAT_SNORM16X2, // DXGI_FORMAT_R16G16_SNORM
+    SR_VERTEX_FORMAT_UNORM16X2  // DXGI_FORMAT_R16G16_UNORM
+};
+
+// One vertex stream bound to an input slot
+struct SRVertexStream
+{
+    const void *pData;   // Start of the first element
+    unsigned int stride; // Bytes between consecutive vertices
+    SRVertexFormat format;
+};
+
+// Everything needed to issue one draw call
+struct SRDrawDesc
+{
+    SRVertexShader vertexShader;
+    SRPixelShader pixelShader;
+    SRShaderContext context;
+    unsigned int numVaryings;
+
+    SRVertexStream streams[SR_MAX_ATTRIBUTES];
+    unsigned int numAttributes;
+    unsigned int vertexCount;
+
+    const unsigned short *pIndices16; // Either 16 bit indices ...
+    const unsigned int *pIndices32;   // ... or 32 bit indices, NULL for non indexed draw
+    unsigned int indexCount;
+
+    SRTopology topology;
+    SRCullMode cullMode;
+    bool bDepthTest; // false when no depth buffer is bound
+};
+
+// Counters accumulated since the last ResetStatistics()
+struct SRStatistics
+{
+    unsigned long long drawCalls;
+    unsigned long long verticesShaded;
+    unsigned long long trianglesSubmitted;
+    unsigned long long trianglesRasterized; // After clipping and culling
+    unsigned long long fragmentsShaded;     // Fragments that passed the depth test
+};
+
+class SoftwareRasterizer
+{
+private:
+    // Triangle after clipping and setup, in 24.8 fixed point screen space
+    struct SetupTriangle
+    {
+        int x[3];
+        int y[3];
+        float z[3];
+        float invW[3];
+        int minX, minY, maxX, maxY;
+        float varyings[3][SR_MAX_VARYINGS]; // Pre divided by w for perspective correction
+    };
+
+    // Triangles produced by one chunk of the index buffer
+    struct TriangleChunk
+    {
+        std::vector<SetupTriangle> triangles;
+        std::vector<std::vector<unsigned int>> bins; // Triangle indices per tile
+    };
+
+    int width;
+    int height;
+    int tilesX;
+    int tilesY;
+    std::vector<unsigned int> colorBuffer; // R8G8B8A8_UNORM
+    std::vector<float> depthBuffer;        // D32_FLOAT, depthPitch x depthRows of which width x height is used
+    int depthPitch;                        // Largest size seen, so shrinking never reallocates
+    int depthRows;
+    std::vector<SRVertexOutput> vertexCache;
+    std::vector<TriangleChunk> chunks;
+    SRStatistics statistics;
+
+public:
+    SoftwareRasterizer();
+    ~SoftwareRasterizer();
+    bool Initialize(int width, int height); // Phases run on the JobSystem.h threads
+    unsigned int Resize(int width, int height); // Buffers that had to be allocated for the new size
+    void Clear(const float color[4], float depth);
+    void Draw(const SRDrawDesc &desc);
+    void Cleanup();
+
+    int GetWidth() const { return width; }
+    int GetHeight() const { return height; }
+    const unsigned int *GetColorBuffer() const { return colorBuffer.data(); }
+    const SRStatistics &GetStatistics() const { return statistics; }
+    void ResetStatistics();
+
+private:
+    void setupTriangle(const SRDrawDesc &desc, const SRVertexOutput *pVertices[3], TriangleChunk &chunk);
+    void emitTriangle(const SRDrawDesc &desc, const SRVertexOutput &v0, const SRVertexOutput &v1, const SRVertexOutput &v2, TriangleChunk &chunk);
+    unsigned long long rasterizeTile(const SRDrawDesc &desc, unsigned int tile);
+};
@@ -0,0 +1,536 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "SoftwareRenderer.h"
+#include "Image.h"
+#include "ImageDecoder.h"
+#include "JobSystem.h"
+#include "Log.h"
+#include "Profiler.h"
+
+SoftwareRenderer::SoftwareRenderer(bool bRasterize) : bRasterize(bRasterize),
+                                                      captureNext(0),
+                                                      currentShader(0),
+                                                      indexBuffer(0),
+                                                      indexFormat(INDEX_FORMAT_UINT16),
+                                                      topology(PRIMITIVE_TOPOLOGY_TRIANGLELIST)
+{
+    memset(&rendererDesc, 0, sizeof(rendererDesc));
+    memset(vertexBindings, 0, sizeof(vertexBindings));
+    memset(constantBuffers, 0, sizeof(constantBuffers));
+    memset(&frameStatistics, 0, sizeof(frameStatistics));
+    memset(&statistics, 0, sizeof(statistics));
+    memset(boundTextures, 0, sizeof(boundTextures));
+    for (unsigned int i = 0; i < CAPTURE_RING_SIZE; i++)
+        captureSlots[i].bPending = false;
+}
+
+SoftwareRenderer::~SoftwareRenderer()
+{
+    Cleanup();
+}
+
+int SoftwareRenderer::Initialize(void *pNativeWindow, const RendererDesc &desc)
+{
+    // Nothing is presented to a window, the frame stays in the color buffer
+    (void)pNativeWindow;
+    rendererDesc = desc;
+
+    constantRing.Reset(CONSTANT_RING_SIZE);
+    presentQueue.Initialize(desc);
+    Log("Simulated display %u Hz, %u buffers, max frame latency %u, vsync %s\n", SIMULATED_REFRESH_RATE,
+        GetPresentBufferCount(desc), GetPresentMaxFrameLatency(desc), desc.bVsync ? "on" : "off");
+
+    if (bRasterize)
+    {
+        if (!rasterizer.Initialize(desc.width, desc.height))
+        {
+            LogError("SoftwareRasterizer::Initialize() Failed\n");
+            return -1;
+        }
+        Log("Software Renderer Initialized with %u threads\n", JobsGetThreadCount());
+    }
+    else
+    {
+        Log("Null Renderer Initialized\n");
+    }
+    return 0;
+}
+
+int SoftwareRenderer::Resize(int width, int height)
+{
+    if (height <= 0)
+        height = 1;
+    if (width <= 0)
+        width = 1;
+
+    if (width == rendererDesc.width && height == rendererDesc.height)
+        return 0;
+
+    rendererDesc.width = width;
+    rendererDesc.height = height;
+    frameStatistics.resizes++;
+    if (bRasterize)
+        frameStatistics.resizeAllocations += rasterizer.Resize(width, height);
+    return 0;
+}
+
+void SoftwareRenderer::Cleanup()
+{
+    rasterizer.Cleanup();
+    buffers.clear();
+    shaders.clear();
+    textures.clear();
+    constantRing.Reset(0);
+}
+
+BufferHandle SoftwareRenderer::CreateBuffer(const BufferDesc &desc)
+{
+    Buffer buffer;
+    buffer.type = desc.type;
+    buffer.data.resize(desc.byteWidth);
+    if (desc.pInitialData)
+        memcpy(buffer.data.data(), desc.pInitialData, desc.byteWidth);
+
+    buffers.push_back(buffer);
+    return (BufferHandle)buffers.size();
+}
+
+void SoftwareRenderer::UpdateBuffer(BufferHandle buffer, const void *pData)
+{
+    if (buffer == 0 || buffer > buffers.size())
+        return;
+    Buffer &target = buffers[buffer - 1];
+    memcpy(target.data.data(), pData, target.data.size());
+
+    if (target.type == BUFFER_TYPE_CONSTANT)
+    {
+        frameStatistics.constantBytesUploaded += target.data.size();
+        frameStatistics.constantUploads++;
+    }
+    else
+        frameStatistics.bufferBytesUploaded += target.data.size();
+}
+
+bool SoftwareRenderer::UploadConstants(const void *pData, unsigned int size, ConstantAllocation &allocation)
+{
+    // Draws finish before they return, so the ring memory is free to reuse right away
+    bool bWrapped = false;
+    if (!constantRing.Upload(pData, size, allocation, bWrapped))
+    {
+        LogError("UploadConstants() Failed : %u bytes do not fit the constant ring\n", size);
+        return false;
+    }
+
+    frameStatistics.constantBytesUploaded += size;
+    frameStatistics.constantUploads++;
+    return true;
+}
+
+bool SoftwareRenderer::IsConstantAllocationValid(const ConstantAllocation &allocation) const
+{
+    return constantRing.IsValid(allocation);
+}
+
+ShaderHandle SoftwareRenderer::CreateShader(const ShaderDesc &desc)
+{
+    if (bRasterize && (desc.softwareVertexShader == NULL || desc.softwarePixelShader == NULL))
+    {
+        LogError("CreateShader() Failed : no software shader for %s\n", desc.vertexShaderFile);
+        return 0;
+    }
+    if (desc.numElements > SR_MAX_ATTRIBUTES || desc.numVaryings > SR_MAX_VARYINGS)
+    {
+        LogError("CreateShader() Failed : too many attributes or varyings\n");
+        return 0;
+    }
+
+    Shader shader;
+    shader.desc = desc;
+    shader.elements.assign(desc.pElements, desc.pElements + desc.numElements);
+    shader.desc.pElements = NULL; // Points into the caller's memory, use elements instead
+
+    shaders.push_back(shader);
+    return (ShaderHandle)shaders.size();
+}
+
+TextureHandle SoftwareRenderer::CreateTextureFromFile(const char *filePath)
+{
+    return CreateTextureArrayFromFiles(&filePath, 1);
+}
+
+// Every slice is decoded straight into the texels, one job per slice once the
+// first file has given the size
+TextureHandle SoftwareRenderer::CreateTextureArrayFromFiles(const char *const *filePaths, unsigned int count)
+{
+    if (count == 0)
+        return 0;
+
+    SRTexture texture;
+    texture.layers = (int)count;
+    ImageDecoder decoder;
+    if (!decoder.Open(filePaths[0]))
+    {
+        LogError("CreateTextureArrayFromFiles() Failed for %s\n", filePaths[0]);
+        return 0;
+    }
+    texture.width = decoder.GetWidth();
+    texture.height = decoder.GetHeight();
+    texture.texels.resize((size_t)texture.width * texture.height * count);
+
+    std::vector<unsigned char> sliceDecoded(count, 0);
+    JobParallelFor(count, 1, [&](unsigned int first, unsigned int last)
+                   {
+        for (unsigned int i = first; i < last; i++)
+        {
+            ImageDecoder sliceDecoder;
+            ImageDecoder *pDecoder = &decoder;
+            if (i > 0)
+            {
+                if (!sliceDecoder.Open(filePaths[i]))
+                {
+                    LogError("CreateTextureArrayFromFiles() Failed for %s\n", filePaths[i]);
+                    continue;
+                }
+                pDecoder = &sliceDecoder;
+            }
+            if (pDecoder->GetWidth() != texture.width || pDecoder->GetHeight() != texture.height)
+            {
+                LogError("CreateTextureArrayFromFiles() Failed, %s is %dx%d instead of %dx%d\n",
+                         filePaths[i], pDecoder->GetWidth(), pDecoder->GetHeight(), texture.width, texture.height);
+                continue;
+            }
+
+            size_t sliceSize = (size_t)texture.width * texture.height;
+            if (!pDecoder->Decode(&texture.texels[sliceSize * i], (size_t)texture.width))
+            {
+                LogError("CreateTextureArrayFromFiles() Failed for %s\n", filePaths[i]);
+                continue;
+            }
+            sliceDecoded[i] = 1;
+        } });
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (!sliceDecoded[i])
+            return 0;
+    }
+    if (count == 1)
+        Log("CreateTextureFromFile() Successful for %s\n", filePaths[0]);
+    else
+        Log("CreateTextureArrayFromFiles() Successful for %u slices of %dx%d\n", count, texture.width, texture.height);
+
+    textures.push_back(texture);
+    return (TextureHandle)textures.size();
+}
+
+// The same redundant state filter as the D3D11 backend, so both report the
+// same counts; here it only saves the assignments
+bool SoftwareRenderer::isRedundant(bool bSame)
+{
+    if (bSame)
+        frameStatistics.stateCallsFiltered++;
+    else
+        frameStatistics.stateCallsIssued++;
+    return bSame;
+}
+
+void SoftwareRenderer::SetShader(ShaderHandle shader)
+{
+    frameStatistics.stateChanges++;
+    if (isRedundant(currentShader == shader))
+        return;
+    currentShader = shader;
+}
+
+void SoftwareRenderer::SetVertexBuffer(unsigned int slot, BufferHandle buffer, unsigned int stride, unsigned int offset)
+{
+    frameStatistics.stateChanges++;
+    if (slot >= SR_MAX_ATTRIBUTES)
+        return;
+    const VertexBinding &binding = vertexBindings[slot];
+    if (isRedundant(binding.buffer == buffer && binding.stride == stride && binding.offset == offset))
+        return;
+    vertexBindings[slot].buffer = buffer;
+    vertexBindings[slot].stride = stride;
+    vertexBindings[slot].offset = offset;
+}
+
+void SoftwareRenderer::SetIndexBuffer(BufferHandle buffer, IndexFormat format)
+{
+    frameStatistics.stateChanges++;
+    if (isRedundant(indexBuffer == buffer && indexFormat == format))
+        return;
+    indexBuffer = buffer;
+    indexFormat = format;
+}
+
+void SoftwareRenderer::SetConstantBuffer(unsigned int slot, BufferHandle buffer)
+{
+    frameStatistics.stateChanges++;
+    if (slot >= SR_MAX_CONSTANT_BUFFERS)
+        return;
+    if (isRedundant(constantBuffers[slot] == buffer && constantRing.GetBound(slot) == NULL))
+        return;
+    constantBuffers[slot] = buffer;
+    constantRing.Unbind(slot);
+}
+
+void SoftwareRenderer::SetConstants(unsigned int slot, const ConstantAllocation &allocation)
+{
+    frameStatistics.stateChanges++;
+    if (slot >= SR_MAX_CONSTANT_BUFFERS || !constantRing.IsValid(allocation))
+        return;
+    const ConstantAllocation *pBound = constantRing.GetBound(slot);
+    if (isRedundant(pBound && pBound->offset == allocation.offset && pBound->size == allocation.size &&
+                    pBound->generation == allocation.generation))
+        return;
+    constantBuffers[slot] = 0;
+    constantRing.Bind(slot, allocation);
+}
+
+void SoftwareRenderer::SetTexture(unsigned int slot, TextureHandle texture)
+{
+    frameStatistics.stateChanges++;
+    if (slot < SR_MAX_TEXTURES && !isRedundant(boundTextures[slot] == texture))
+        boundTextures[slot] = texture;
+}
+
+void SoftwareRenderer::SetPrimitiveTopology(PrimitiveTopology topology)
+{
+    frameStatistics.stateChanges++;
+    if (isRedundant(this->topology == topology))
+        return;
+    this->topology = topology;
+}
+
+void SoftwareRenderer::Clear(const float clearColor[4])
+{
+    if (bRasterize)
+    {
+        PROFILE_GPU_SCOPE("Clear");
+        rasterizer.Clear(clearColor, 1.0f);
+    }
+}
+
+void SoftwareRenderer::Draw(unsigned int vertexCount, unsigned int startVertex)
+{
+    draw(vertexCount, startVertex, 0, false, 1, 0);
+}
+
+void SoftwareRenderer::DrawIndexed(unsigned int indexCount, unsigned int startIndex, int baseVertex)
+{
+    draw(indexCount, startIndex, baseVertex, true, 1, 0);
+}
+
+void SoftwareRenderer::DrawIndexedInstanced(unsigned int indexCount, unsigned int instanceCount, unsigned int startIndex, int baseVertex, unsigned int startInstance)
+{
+    draw(indexCount, startIndex, baseVertex, true, instanceCount, startInstance);
+}
+
+void SoftwareRenderer::WaitForFrameSlot()
+{
+    presentQueue.WaitForSlot();
+}
+
+void SoftwareRenderer::Present()
+{
+    // copies made by earlier frames are done by now
+    for (unsigned int i = 0; i < CAPTURE_RING_SIZE; i++)
+    {
+        CaptureSlot &slot = captureSlots[(captureNext + i) % CAPTURE_RING_SIZE];
+        if (slot.bPending)
+            writeCapture(slot);
+    }
+    if (!captureRequest.empty())
+    {
+        CaptureSlot &slot = captureSlots[captureNext];
+        slot.width = rasterizer.GetWidth();
+        slot.height = rasterizer.GetHeight();
+        const unsigned int *pColor = rasterizer.GetColorBuffer();
+        slot.pixels.assign(pColor, pColor + (size_t)slot.width * slot.height);
+        slot.filePath.swap(captureRequest);
+        captureRequest.clear();
+        slot.bPending = true;
+        captureNext = (captureNext + 1) % CAPTURE_RING_SIZE;
+    }
+
+    // The color buffer is the presented image; the queue only models when
+    // the display would show it
+    presentQueue.Present();
+    frameStatistics.queuedFrames = presentQueue.GetQueuedFrames();
+    presentQueue.TakeDisplayed(frameStatistics);
+
+    statistics = frameStatistics;
+    memset(&frameStatistics, 0, sizeof(frameStatistics));
+}
+
+const RendererStatistics &SoftwareRenderer::GetStatistics() const
+{
+    return statistics;
+}
+
+bool SoftwareRenderer::QueueCapture(const char *filePath)
+{
+    if (!bRasterize)
+        return false;
+    captureRequest = filePath;
+    return true;
+}
+
+bool SoftwareRenderer::FlushCaptures()
+{
+    bool bWritten = true;
+    for (unsigned int i = 0; i < CAPTURE_RING_SIZE; i++)
+    {
+        CaptureSlot &slot = captureSlots[(captureNext + i) % CAPTURE_RING_SIZE];
+        if (slot.bPending && !writeCapture(slot))
+            bWritten = false;
+    }
+    return bWritten;
+}
+
+bool SoftwareRenderer::writeCapture(CaptureSlot &slot)
+{
+    slot.bPending = false;
+    if (!ImageSaveBMP(slot.filePath.c_str(), slot.width, slot.height, slot.pixels.data(), (size_t)slot.width))
+    {
+        LogError("ImageSaveBMP() Failed for %s\n", slot.filePath.c_str());
+        return false;
+    }
+    frameStatistics.capturesWritten++;
+    return true;
+}
+
+static SRVertexFormat streamFormat(VertexFormat format)
+{
+    switch (format)
+    {
+    case VERTEX_FORMAT_HALF4:
+        return SR_VERTEX_FORMAT_HALF4;
+    case VERTEX_FORMAT_SNORM16X2:
+        return SR_VERTEX_FORMAT_SNORM16X2;
+    case VERTEX_FORMAT_UNORM16X2:
+        return SR_VERTEX_FORMAT_UNORM16X2;
+    default:
+        return SR_VERTEX_FORMAT_FLOAT;
+    }
+}
+
+void SoftwareRenderer::draw(unsigned int count, unsigned int start, int baseVertex, bool bIndexed, unsigned int instanceCount, unsigned int startInstance)
+{
+    frameStatistics.drawCalls++;
+    frameStatistics.instances += instanceCount;
+    if (!bRasterize || count == 0 || instanceCount == 0)
+        return;
+    if (currentShader == 0 || currentShader > shaders.size())
+        return;
+    PROFILE_GPU_SCOPE("Draw");
+
+    const Shader &shader = shaders[currentShader - 1];
+
+    SRDrawDesc desc;
+    memset(&desc, 0, sizeof(desc));
+    desc.vertexShader = shader.desc.softwareVertexShader;
+    desc.pixelShader = shader.desc.softwarePixelShader;
+    desc.numVaryings = shader.desc.numVaryings;
+    desc.numAttributes = (unsigned int)shader.elements.size();
+    desc.topology = (topology == PRIMITIVE_TOPOLOGY_TRIANGLESTRIP) ? SR_TOPOLOGY_TRIANGLE_STRIP : SR_TOPOLOGY_TRIANGLE_LIST;
+    desc.bDepthTest = rendererDesc.bDepthBuffer;
+    switch (rendererDesc.cullMode)
+    {
+    case CULL_MODE_FRONT:
+        desc.cullMode = SR_CULL_FRONT;
+        break;
+    case CULL_MODE_BACK:
+        desc.cullMode = SR_CULL_BACK;
+        break;
+    default:
+        desc.cullMode = SR_CULL_NONE;
+        break;
+    }
+
+    for (unsigned int i = 0; i < SR_MAX_CONSTANT_BUFFERS; i++)
+    {
+        BufferHandle cb = constantBuffers[i];
+        const ConstantAllocation *pRange = constantRing.GetBound(i);
+        if (pRange)
+            desc.context.pConstants[i] = constantRing.GetData(*pRange);
+        else
+            desc.context.pConstants[i] = (cb != 0 && cb <= buffers.size()) ? buffers[cb - 1].data.data() : NULL;
+    }
+    for (unsigned int i = 0; i < SR_MAX_TEXTURES; i++)
+    {
+        TextureHandle texture = boundTextures[i];
+        desc.context.pTextures[i] = (texture != 0 && texture <= textures.size()) ? &textures[texture - 1] : NULL;
+    }
+
+    // One stream per input element, the first vertex is startVertex (or baseVertex for indexed draws).
+    // Per-instance streams start at startInstance and are moved along below
+    long long firstVertex = bIndexed ? baseVertex : start;
+    unsigned int vertexCount = 0xffffffffu;
+    unsigned int instancesAvailable = instanceCount;
+    for (unsigned int i = 0; i < desc.numAttributes; i++)
+    {
+        const VertexElement &element = shader.elements[i];
+        const VertexBinding &binding = vertexBindings[element.inputSlot];
+        if (binding.buffer == 0 || binding.buffer > buffers.size() || binding.stride == 0)
+            return;
+
+        bool bPerInstance = (shader.desc.instanceSlotMask & (1u << element.inputSlot)) != 0;
+        long long first = bPerInstance ? (long long)startInstance : firstVertex;
+        const std::vector<unsigned char> &data = buffers[binding.buffer - 1].data;
+        long long byteOffset = binding.offset + element.alignedByteOffset + first * binding.stride;
+        if (byteOffset < 0 || byteOffset >= (long long)data.size())
+            return;
+
+        desc.streams[i].pData = data.data() + byteOffset;
+        desc.streams[i].stride = bPerInstance ? 0 : binding.stride; // Every vertex of an instance reads the same element
+        desc.streams[i].format = streamFormat(element.format);
+
+        unsigned int available = (unsigned int)((data.size() - byteOffset) / binding.stride);
+        if (bPerInstance)
+        {
+            if (available < instancesAvailable)
+                instancesAvailable = available;
+        }
+        else if (available < vertexCount)
+            vertexCount = available;
+    }
+
+    if (bIndexed)
+    {
+        if (indexBuffer == 0 || indexBuffer > buffers.size())
+            return;
+
+        const std::vector<unsigned char> &data = buffers[indexBuffer - 1].data;
+        unsigned int indexSize = (indexFormat == INDEX_FORMAT_UINT32) ? 4 : 2;
+        if ((unsigned long long)(start + count) * indexSize > data.size())
+            return;
+
+        if (indexFormat == INDEX_FORMAT_UINT32)
+            desc.pIndices32 = (const unsigned int *)data.data() + start;
+        else
+            desc.pIndices16 = (const unsigned short *)data.data() + start;
+        desc.indexCount = count;
+        desc.vertexCount = vertexCount;
+    }
+    else
+    {
+        desc.vertexCount = (count < vertexCount) ? count : vertexCount;
+    }
+
+    // the rasterizer has no instancing of its own, so every instance is a draw
+    // with the per-instance streams advanced by one element
+    for (unsigned int instance = 0; instance < instancesAvailable; instance++)
+    {
+        if (instance > 0)
+        {
+            for (unsigned int i = 0; i < desc.numAttributes; i++)
+            {
+                if (shader.desc.instanceSlotMask & (1u << shader.elements[i].inputSlot))
+                    desc.streams[i].pData = (const unsigned char *)desc.streams[i].pData + vertexBindings[shader.elements[i].inputSlot].stride;
+            }
+        }
+        rasterizer.Draw(desc);
+    }
+}
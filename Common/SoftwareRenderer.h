@@ -0,0 +1,113 @@
+#pragma once
+
+// Portable backend, runs the C++ shader ports on SoftwareRasterizer.
+// Constructed with bRasterize = false it becomes the null backend: resources
+// are created and state is tracked but nothing is drawn.
+
+#include <string>
+#include <vector>
+
+#include "Renderer.h"
+#include "ConstantRing.h"
+#include "PresentQueue.h"
+#include "SoftwareRasterizer.h"
+
+class SoftwareRenderer : public Renderer
+{
+private:
+    struct Buffer
+    {
+        BufferType type;
+        std::vector<unsigned char> data;
+    };
+
+    struct Shader
+    {
+        ShaderDesc desc;
+        std::vector<VertexElement> elements;
+    };
+
+    struct VertexBinding
+    {
+        BufferHandle buffer;
+        unsigned int stride;
+        unsigned int offset;
+    };
+
+    bool bRasterize;
+    SoftwareRasterizer rasterizer;
+    RendererDesc rendererDesc;
+
+    std::vector<Buffer> buffers; // Handle n lives at index n - 1
+    std::vector<Shader> shaders;
+    std::vector<SRTexture> textures;
+
+    ConstantRing constantRing; // Draws read their ring ranges straight from its memory
+    RendererStatistics frameStatistics; // Being counted
+    RendererStatistics statistics;      // Last presented frame
+    PresentQueue presentQueue;          // Simulated display
+
+    // Captures copy the color buffer at Present() and are written on the next
+    // one, like a GPU copy read back a frame later
+    struct CaptureSlot
+    {
+        std::vector<unsigned int> pixels;
+        int width;
+        int height;
+        std::string filePath;
+        bool bPending;
+    };
+    CaptureSlot captureSlots[CAPTURE_RING_SIZE];
+    unsigned int captureNext;
+    std::string captureRequest; // Set by QueueCapture() for the frame being drawn
+
+    // Bound state
+    ShaderHandle currentShader;
+    VertexBinding vertexBindings[SR_MAX_ATTRIBUTES];
+    BufferHandle indexBuffer;
+    IndexFormat indexFormat;
+    BufferHandle constantBuffers[SR_MAX_CONSTANT_BUFFERS];
+    TextureHandle boundTextures[SR_MAX_TEXTURES];
+    PrimitiveTopology topology;
+
+public:
+    SoftwareRenderer(bool bRasterize);
+    ~SoftwareRenderer();
+
+    int Initialize(void *pNativeWindow, const RendererDesc &desc);
+    int Resize(int width, int height);
+    void Cleanup();
+
+    BufferHandle CreateBuffer(const BufferDesc &desc);
+    void UpdateBuffer(BufferHandle buffer, const void *pData);
+    ShaderHandle CreateShader(const ShaderDesc &desc);
+    TextureHandle CreateTextureFromFile(const char *filePath);
+    TextureHandle CreateTextureArrayFromFiles(const char *const *filePaths, unsigned int count);
+
+    bool UploadConstants(const void *pData, unsigned int size, ConstantAllocation &allocation);
+    bool IsConstantAllocationValid(const ConstantAllocation &allocation) const;
+
+    void SetShader(ShaderHandle shader);
+    void SetVertexBuffer(unsigned int slot, BufferHandle buffer, unsigned int stride, unsigned int offset);
+    void SetIndexBuffer(BufferHandle buffer, IndexFormat format);
+    void SetConstantBuffer(unsigned int slot, BufferHandle buffer);
+    void SetConstants(unsigned int slot, const ConstantAllocation &allocation);
+    void SetTexture(unsigned int slot, TextureHandle texture);
+    void SetPrimitiveTopology(PrimitiveTopology topology);
+
+    void WaitForFrameSlot();
+    void Clear(const float clearColor[4]);
+    void Draw(unsigned int vertexCount, unsigned int startVertex);
+    void DrawIndexed(unsigned int indexCount, unsigned int startIndex, int baseVertex);
+    void DrawIndexedInstanced(unsigned int indexCount, unsigned int instanceCount, unsigned int startIndex, int baseVertex, unsigned int startInstance);
+    void Present();
+
+    const RendererStatistics &GetStatistics() const;
+    bool QueueCapture(const char *filePath);
+    bool FlushCaptures();
+
+private:
+    void draw(unsigned int count, unsigned int start, int baseVertex, bool bIndexed, unsigned int instanceCount, unsigned int startInstance);
+    bool writeCapture(CaptureSlot &slot);
+    bool isRedundant(bool bSame); // Counts the Set*() call as filtered or issued
+};
@@ -0,0 +1,451 @@
+// Procedural UV sphere and icosphere, replaces the prebuilt Sphere.lib
+// The default desc reproduces the library's 20 x 20 sphere of radius 0.5;
+// rings now repeat their first vertex at u = 1 so texture coordinates do not
+// wrap backwards across the seam, and the poles get one vertex per slice.
+
+#include <math.h>
+#include <string.h>
+
+#include "JobSystem.h"
+#include "Sphere.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SPHERE_SSE2 1
+#endif
+
+// Vertices per job when a UV sphere's rings and bands are split across threads
+#define SPHERE_VERTICES_PER_JOB 16384
+
+static const float gPi = 3.141592654f;
+
+const void *SphereMesh::GetIndexData() const
+{
+    if (indexFormat == INDEX_FORMAT_UINT16)
+        return indices16.empty() ? NULL : indices16.data();
+    return indices32.empty() ? NULL : indices32.data();
+}
+
+unsigned int SphereMesh::GetIndexDataSize() const
+{
+    return indexCount * (indexFormat == INDEX_FORMAT_UINT16 ? (unsigned int)sizeof(unsigned short) : (unsigned int)sizeof(unsigned int));
+}
+
+void GetDefaultSphereDesc(SphereDesc &desc)
+{
+    memset(&desc, 0, sizeof(SphereDesc));
+    desc.type = SPHERE_TYPE_UV;
+    desc.slices = SPHERE_SLICES;
+    desc.stacks = SPHERE_STACKS;
+    desc.radius = SPHERE_RADIUS;
+}
+
+static unsigned int ringsPerSphereJob(unsigned int slices)
+{
+    unsigned int rings = SPHERE_VERTICES_PER_JOB / (slices + 1);
+    return rings > 0 ? rings : 1;
+}
+
+static void setVertex(SphereVertex &vertex, const float n[3], float radius, float u, float v)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        vertex.normal[i] = n[i];
+        vertex.position[i] = n[i] * radius;
+    }
+    vertex.texcoord[0] = u;
+    vertex.texcoord[1] = v;
+}
+
+// One ring of the UV sphere, columns [first, columns)
+static void uvRingScalar(SphereVertex *pRing, unsigned int first, unsigned int columns, float sinPhi, float cosPhi, float v,
+                         const float *cosTheta, const float *sinTheta, const float *u, float radius)
+{
+    for (unsigned int c = first; c < columns; c++)
+    {
+        float n[3] = {sinPhi * cosTheta[c], cosPhi, sinPhi * sinTheta[c]};
+        setVertex(pRing[c], n, radius, u[c], v);
+    }
+}
+
+#ifdef SPHERE_SSE2
+// Four columns per step: build position/normal/texcoord as four rows and
+// transpose them into the interleaved layout, two 16 byte stores per vertex
+static void uvRingSSE2(SphereVertex *pRing, unsigned int columns, float sinPhi, float cosPhi, float v,
+                       const float *cosTheta, const float *sinTheta, const float *u, float radius)
+{
+    const __m128 vSinPhi = _mm_set1_ps(sinPhi);
+    const __m128 vRadius = _mm_set1_ps(radius);
+    const __m128 vNy = _mm_set1_ps(cosPhi);
+    const __m128 vPy = _mm_mul_ps(vNy, vRadius);
+    const __m128 vV = _mm_set1_ps(v);
+
+    unsigned int c = 0;
+    for (; c + 4 <= columns; c += 4)
+    {
+        __m128 nx = _mm_mul_ps(vSinPhi, _mm_loadu_ps(&cosTheta[c]));
+        __m128 nz = _mm_mul_ps(vSinPhi, _mm_loadu_ps(&sinTheta[c]));
+        __m128 px = _mm_mul_ps(nx, vRadius);
+        __m128 py = vPy;
+        __m128 pz = _mm_mul_ps(nz, vRadius);
+        __m128 ny = vNy;
+        __m128 tu = _mm_loadu_ps(&u[c]);
+        __m128 tv = vV;
+
+        // px py pz nx | ny nz u v
+        _MM_TRANSPOSE4_PS(px, py, pz, nx);
+        _MM_TRANSPOSE4_PS(ny, nz, tu, tv);
+        float *pOut = pRing[c].position;
+        _mm_storeu_ps(pOut + 0, px);
+        _mm_storeu_ps(pOut + 4, ny);
+        _mm_storeu_ps(pOut + 8, py);
+        _mm_storeu_ps(pOut + 12, nz);
+        _mm_storeu_ps(pOut + 16, pz);
+        _mm_storeu_ps(pOut + 20, tu);
+        _mm_storeu_ps(pOut + 24, nx);
+        _mm_storeu_ps(pOut + 28, tv);
+    }
+    uvRingScalar(pRing, c, columns, sinPhi, cosPhi, v, cosTheta, sinTheta, u, radius);
+}
+#endif
+
+// Two triangles per quad of one band, a-b on one ring and c-d on the next,
+// stride vertices further on
+template <typename INDEX>
+static INDEX *uvBandScalar(INDEX *pOut, unsigned int first, unsigned int quads, unsigned int stride)
+{
+    for (unsigned int q = 0; q < quads; q++)
+    {
+        unsigned int a = first + q;
+        unsigned int b = a + 1;
+        unsigned int c = a + stride;
+        unsigned int d = c + 1;
+        *pOut++ = (INDEX)a;
+        *pOut++ = (INDEX)b;
+        *pOut++ = (INDEX)c;
+        *pOut++ = (INDEX)c;
+        *pOut++ = (INDEX)b;
+        *pOut++ = (INDEX)d;
+    }
+    return pOut;
+}
+
+#ifdef SPHERE_SSE2
+// The 6 indices of quad q are first + q + {0, 1, S, S, 1, S + 1}, so four
+// quads are a constant pattern plus first + q, 24 indices per step
+static void uvBandPattern(unsigned int pattern[24], unsigned int stride)
+{
+    const unsigned int offsets[6] = {0, 1, stride, stride, 1, stride + 1};
+    for (int i = 0; i < 24; i++)
+        pattern[i] = (unsigned int)(i / 6) + offsets[i % 6];
+}
+
+static unsigned short *uvBandSSE2(unsigned short *pOut, unsigned int first, unsigned int quads, unsigned int stride)
+{
+    unsigned int pattern[24];
+    uvBandPattern(pattern, stride);
+    unsigned short pattern16[24];
+    for (int i = 0; i < 24; i++)
+        pattern16[i] = (unsigned short)pattern[i];
+    const __m128i p0 = _mm_loadu_si128((const __m128i *)&pattern16[0]);
+    const __m128i p1 = _mm_loadu_si128((const __m128i *)&pattern16[8]);
+    const __m128i p2 = _mm_loadu_si128((const __m128i *)&pattern16[16]);
+
+    unsigned int q = 0;
+    for (; q + 4 <= quads; q += 4)
+    {
+        __m128i base = _mm_set1_epi16((short)(first + q));
+        _mm_storeu_si128((__m128i *)(pOut + 0), _mm_add_epi16(base, p0));
+        _mm_storeu_si128((__m128i *)(pOut + 8), _mm_add_epi16(base, p1));
+        _mm_storeu_si128((__m128i *)(pOut + 16), _mm_add_epi16(base, p2));
+        pOut += 24;
+    }
+    return uvBandScalar(pOut, first + q, quads - q, stride);
+}
+
+static unsigned int *uvBandSSE2(unsigned int *pOut, unsigned int first, unsigned int quads, unsigned int stride)
+{
+    unsigned int pattern[24];
+    uvBandPattern(pattern, stride);
+    __m128i p[6];
+    for (int i = 0; i < 6; i++)
+        p[i] = _mm_loadu_si128((const __m128i *)&pattern[i * 4]);
+
+    unsigned int q = 0;
+    for (; q + 4 <= quads; q += 4)
+    {
+        __m128i base = _mm_set1_epi32((int)(first + q));
+        for (int i = 0; i < 6; i++)
+            _mm_storeu_si128((__m128i *)(pOut + i * 4), _mm_add_epi32(base, p[i]));
+        pOut += 24;
+    }
+    return uvBandScalar(pOut, first + q, quads - q, stride);
+}
+#endif
+
+template <typename INDEX>
+static void uvIndices(INDEX *pOut, unsigned int slices, unsigned int stacks, bool bSIMD)
+{
+    const unsigned int stride = slices + 1;
+    const unsigned int ringsPerJob = ringsPerSphereJob(slices);
+
+    // top cap, the pole row holds one vertex per slice
+    for (unsigned int c = 0; c < slices; c++)
+    {
+        *pOut++ = (INDEX)c;
+        *pOut++ = (INDEX)(stride + c + 1);
+        *pOut++ = (INDEX)(stride + c);
+    }
+
+    // bands between the inner rings, 6 * slices indices each
+    JobParallelFor(stacks - 2, ringsPerJob, [&](unsigned int firstBand, unsigned int lastBand)
+                   {
+        INDEX *pBand = pOut + (size_t)firstBand * 6 * slices;
+        for (unsigned int r = firstBand + 1; r <= lastBand; r++)
+        {
+#ifdef SPHERE_SSE2
+            if (bSIMD)
+            {
+                pBand = uvBandSSE2(pBand, r * stride, slices, stride);
+                continue;
+            }
+#endif
+            pBand = uvBandScalar(pBand, r * stride, slices, stride);
+        } });
+    pOut += (size_t)(stacks - 2) * 6 * slices;
+    (void)bSIMD;
+
+    // bottom cap
+    const unsigned int lastRing = (stacks - 1) * stride;
+    for (unsigned int c = 0; c < slices; c++)
+    {
+        *pOut++ = (INDEX)(lastRing + c);
+        *pOut++ = (INDEX)(lastRing + c + 1);
+        *pOut++ = (INDEX)(lastRing + stride + c);
+    }
+}
+
+// 16 bit indices while every vertex is addressable by one, vertexCount <= 65536
+static void allocateIndices(SphereMesh &mesh, unsigned long long vertexCount, unsigned int indexCount)
+{
+    mesh.indexCount = indexCount;
+    mesh.indexFormat = (vertexCount <= 65536) ? INDEX_FORMAT_UINT16 : INDEX_FORMAT_UINT32;
+    mesh.indices16.clear();
+    mesh.indices32.clear();
+    if (mesh.indexFormat == INDEX_FORMAT_UINT16)
+        mesh.indices16.resize(indexCount);
+    else
+        mesh.indices32.resize(indexCount);
+}
+
+static bool generateUVSphere(const SphereDesc &desc, SphereMesh &mesh)
+{
+    const unsigned int slices = desc.slices;
+    const unsigned int stacks = desc.stacks;
+    if (slices < 3 || stacks < 2)
+        return false;
+    unsigned long long vertexCount = (unsigned long long)(stacks + 1) * (slices + 1);
+    unsigned long long indexCount = 6ULL * slices * (stacks - 1);
+    if (vertexCount > 0xFFFFFFFFULL || indexCount > 0xFFFFFFFFULL)
+        return false;
+
+    bool bSIMD = (desc.flags & SPHERE_FLAG_SCALAR) == 0;
+
+    // per column terms, the seam column repeats column 0 exactly
+    std::vector<float> cosTheta(slices + 1);
+    std::vector<float> sinTheta(slices + 1);
+    std::vector<float> u(slices + 1);
+    for (unsigned int c = 0; c < slices; c++)
+    {
+        float theta = 2.0f * gPi * (float)c / (float)slices;
+        cosTheta[c] = cosf(theta);
+        sinTheta[c] = sinf(theta);
+        u[c] = (float)c / (float)slices;
+    }
+    cosTheta[slices] = cosTheta[0];
+    sinTheta[slices] = sinTheta[0];
+    u[slices] = 1.0f;
+
+    mesh.vertices.resize((size_t)vertexCount);
+    JobParallelFor(stacks + 1, ringsPerSphereJob(slices), [&](unsigned int firstRing, unsigned int lastRing)
+                   {
+        for (unsigned int r = firstRing; r < lastRing; r++)
+        {
+            float phi = gPi * (float)r / (float)stacks;
+            float sinPhi = sinf(phi);
+            float cosPhi = cosf(phi);
+            if (r == 0 || r == stacks)
+            {
+                // exact poles
+                sinPhi = 0.0f;
+                cosPhi = (r == 0) ? 1.0f : -1.0f;
+            }
+            float v = (float)r / (float)stacks;
+
+            SphereVertex *pRing = &mesh.vertices[(size_t)r * (slices + 1)];
+#ifdef SPHERE_SSE2
+            if (bSIMD)
+            {
+                uvRingSSE2(pRing, slices + 1, sinPhi, cosPhi, v, cosTheta.data(), sinTheta.data(), u.data(), desc.radius);
+                continue;
+            }
+#endif
+            uvRingScalar(pRing, 0, slices + 1, sinPhi, cosPhi, v, cosTheta.data(), sinTheta.data(), u.data(), desc.radius);
+        } });
+
+    allocateIndices(mesh, vertexCount, (unsigned int)indexCount);
+    if (mesh.indexFormat == INDEX_FORMAT_UINT16)
+        uvIndices(mesh.indices16.data(), slices, stacks, bSIMD);
+    else
+        uvIndices(mesh.indices32.data(), slices, stacks, bSIMD);
+    return true;
+}
+
+// Midpoints shared by two triangles, open addressing on the sorted vertex pair
+class EdgeMidpoints
+{
+private:
+    std::vector<unsigned long long> keys; // 0 = empty, pairs never are (a < b)
+    std::vector<unsigned int> values;
+    unsigned long long mask;
+
+public:
+    explicit EdgeMidpoints(unsigned long long edges) : mask(0)
+    {
+        unsigned long long capacity = 16;
+        while (capacity < edges * 2)
+            capacity <<= 1;
+        keys.assign((size_t)capacity, 0);
+        values.resize((size_t)capacity);
+        mask = capacity - 1;
+    }
+
+    // Index stored for the edge, or ~0u after inserting newIndex
+    unsigned int FindOrInsert(unsigned int a, unsigned int b, unsigned int newIndex)
+    {
+        unsigned long long key = (a < b) ? ((unsigned long long)a << 32 | b) : ((unsigned long long)b << 32 | a);
+        unsigned long long slot = (key * 0x9E3779B97F4A7C15ULL) >> 20 & mask;
+        for (;;)
+        {
+            if (keys[(size_t)slot] == key)
+                return values[(size_t)slot];
+            if (keys[(size_t)slot] == 0)
+            {
+                keys[(size_t)slot] = key;
+                values[(size_t)slot] = newIndex;
+                return ~0u;
+            }
+            slot = (slot + 1) & mask;
+        }
+    }
+};
+
+static unsigned int midpoint(std::vector<float> &positions, EdgeMidpoints &edges, unsigned int a, unsigned int b)
+{
+    unsigned int newIndex = (unsigned int)(positions.size() / 3);
+    unsigned int index = edges.FindOrInsert(a, b, newIndex);
+    if (index != ~0u)
+        return index;
+
+    float m[3];
+    for (int i = 0; i < 3; i++)
+        m[i] = positions[a * 3 + i] + positions[b * 3 + i];
+    float invLength = 1.0f / sqrtf(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+    for (int i = 0; i < 3; i++)
+        positions.push_back(m[i] * invLength);
+    return newIndex;
+}
+
+static bool generateIcosphere(const SphereDesc &desc, SphereMesh &mesh)
+{
+    // 10 * 4^n + 2 vertices, 20 * 4^n triangles
+    if (desc.subdivisions > 14)
+        return false;
+    unsigned long long vertexCount = 10ULL * (1ULL << (2 * desc.subdivisions)) + 2;
+    unsigned long long triangleCount = 20ULL * (1ULL << (2 * desc.subdivisions));
+    if (triangleCount * 3 > 0xFFFFFFFFULL)
+        return false;
+
+    // icosahedron on the unit sphere
+    const float t = (1.0f + sqrtf(5.0f)) / 2.0f;
+    const float s = 1.0f / sqrtf(1.0f + t * t);
+    const float corners[12][3] =
+        {
+            {-1, t, 0}, {1, t, 0}, {-1, -t, 0}, {1, -t, 0},
+            {0, -1, t}, {0, 1, t}, {0, -1, -t}, {0, 1, -t},
+            {t, 0, -1}, {t, 0, 1}, {-t, 0, -1}, {-t, 0, 1}};
+    const unsigned int faces[20][3] =
+        {
+            {0, 11, 5}, {0, 5, 1}, {0, 1, 7}, {0, 7, 10}, {0, 10, 11},
+            {1, 5, 9}, {5, 11, 4}, {11, 10, 2}, {10, 7, 6}, {7, 1, 8},
+            {3, 9, 4}, {3, 4, 2}, {3, 2, 6}, {3, 6, 8}, {3, 8, 9},
+            {4, 9, 5}, {2, 4, 11}, {6, 2, 10}, {8, 6, 7}, {9, 8, 1}};
+
+    std::vector<float> positions;
+    positions.reserve((size_t)vertexCount * 3);
+    for (int i = 0; i < 12; i++)
+        for (int j = 0; j < 3; j++)
+            positions.push_back(corners[i][j] * s);
+
+    std::vector<unsigned int> triangles(&faces[0][0], &faces[0][0] + 60);
+    std::vector<unsigned int> next;
+    for (unsigned int level = 0; level < desc.subdivisions; level++)
+    {
+        size_t count = triangles.size() / 3;
+        EdgeMidpoints edges(count * 3 / 2);
+        next.resize(count * 12);
+        unsigned int *pOut = next.data();
+        for (size_t i = 0; i < count; i++)
+        {
+            unsigned int a = triangles[i * 3 + 0];
+            unsigned int b = triangles[i * 3 + 1];
+            unsigned int c = triangles[i * 3 + 2];
+            unsigned int ab = midpoint(positions, edges, a, b);
+            unsigned int bc = midpoint(positions, edges, b, c);
+            unsigned int ca = midpoint(positions, edges, c, a);
+
+            // corners first, the middle triangle last, all with the parent's winding
+            const unsigned int split[12] = {a, ab, ca, ab, b, bc, ca, bc, c, ab, bc, ca};
+            memcpy(pOut, split, sizeof(split));
+            pOut += 12;
+        }
+        triangles.swap(next);
+    }
+
+    // interleave, u and v from the direction the same way the UV sphere lays them out
+    mesh.vertices.resize(positions.size() / 3);
+    for (size_t i = 0; i < mesh.vertices.size(); i++)
+    {
+        const float *n = &positions[i * 3];
+        float u = atan2f(n[2], n[0]) / (2.0f * gPi);
+        if (u < 0.0f)
+            u += 1.0f;
+        float y = n[1] < -1.0f ? -1.0f : (n[1] > 1.0f ? 1.0f : n[1]);
+        setVertex(mesh.vertices[i], n, desc.radius, u, acosf(y) / gPi);
+    }
+
+    allocateIndices(mesh, mesh.vertices.size(), (unsigned int)triangles.size());
+    if (mesh.indexFormat == INDEX_FORMAT_UINT16)
+    {
+        for (size_t i = 0; i < triangles.size(); i++)
+            mesh.indices16[i] = (unsigned short)triangles[i];
+    }
+    else
+    {
+        mesh.indices32.swap(triangles);
+    }
+    return true;
+}
+
+bool GenerateSphere(const SphereDesc &desc, SphereMesh &mesh)
+{
+    mesh.vertices.clear();
+    mesh.indices16.clear();
+    mesh.indices32.clear();
+    mesh.indexFormat = INDEX_FORMAT_UINT16;
+    mesh.indexCount = 0;
+
+    if (desc.type == SPHERE_TYPE_ICOSPHERE)
+        return generateIcosphere(desc, mesh);
+    return generateUVSphere(desc, mesh);
+}
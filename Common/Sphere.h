@@ -0,0 +1,64 @@
+#pragma once
+
+// Procedural sphere geometry used by 10-WhiteSphere .. 13-PerFragmentLighting
+// Two tessellations: a UV sphere of stacks x slices quads, and an icosphere
+// made by splitting each icosahedron triangle into four subdivisions times.
+// Vertices come out interleaved, indices are 16 bit while every vertex is
+// addressable with them and 32 bit beyond that. The UV sphere rings are
+// generated four vertices at a time with SSE2 where available, and large
+// spheres split their rings and index bands into JobSystem.h jobs.
+//
+// Winding matches the old Sphere.lib: front faces are clockwise seen from
+// outside, which is what CULL_MODE_BACK keeps.
+
+#include <vector>
+
+#include "Renderer.h"
+
+#define SPHERE_SLICES 20 // Tessellation of the samples, same as Sphere.lib
+#define SPHERE_STACKS 20
+#define SPHERE_RADIUS 0.5f
+
+#define SPHERE_FLAG_SCALAR 0x1 // Skip the SIMD path, for comparing the two
+
+enum SphereType
+{
+    SPHERE_TYPE_UV = 0,
+    SPHERE_TYPE_ICOSPHERE
+};
+
+struct SphereDesc
+{
+    SphereType type;
+    unsigned int slices;       // UV sphere, at least 3
+    unsigned int stacks;       // UV sphere, at least 2
+    unsigned int subdivisions; // Icosphere, 20 * 4^subdivisions triangles
+    float radius;
+    unsigned int flags;        // SPHERE_FLAG_*
+};
+
+// Interleaved vertex, matches a POSITION/NORMAL/TEXCOORD input layout at offsets 0, 12 and 24
+struct SphereVertex
+{
+    float position[3];
+    float normal[3];
+    float texcoord[2];
+};
+
+struct SphereMesh
+{
+    std::vector<SphereVertex> vertices;
+    std::vector<unsigned short> indices16; // Filled when indexFormat is INDEX_FORMAT_UINT16 ...
+    std::vector<unsigned int> indices32;   // ... this one otherwise
+    IndexFormat indexFormat;
+    unsigned int indexCount;
+
+    const void *GetIndexData() const;
+    unsigned int GetIndexDataSize() const; // Bytes
+};
+
+// Fill desc with the samples' 20 x 20 UV sphere of radius 0.5
+void GetDefaultSphereDesc(SphereDesc &desc);
+
+// false when the tessellation is out of range or needs more than 2^32 vertices
+bool GenerateSphere(const SphereDesc &desc, SphereMesh &mesh);
@@ -0,0 +1,208 @@
+// Batched TRS composition, see TransformBatch.h
+// The kernel is written once against the operations in SIMDLanes.h and
+// instantiated for plain floats and for the widest vector type compiled in.
+// Each iteration builds the 16 matrix elements of Width objects in 16
+// registers, one element per register and one object per lane, then
+// transposes them into Width row major matrices for the store.
+
+#include <math.h>
+#include <string.h>
+
+#include "SIMDLanes.h"
+#include "TransformBatch.h"
+
+// 2 pi split so that quotient * gTwoPiHigh is exact for any quotient below 2^16
+static const float gTwoPiHigh = 6.28125f;
+static const float gTwoPiLow = 0.0019353071795864769f;
+static const float gInverseTwoPi = 0.159154943f;
+static const float gPi = 3.141592654f;
+static const float gHalfPi = 1.570796327f;
+
+void TransformBatch::Resize(unsigned int objectCount)
+{
+    size_t padded = ((size_t)objectCount + TRANSFORM_BATCH_PADDING - 1) / TRANSFORM_BATCH_PADDING * TRANSFORM_BATCH_PADDING;
+    positionX.resize(padded, 0.0f);
+    positionY.resize(padded, 0.0f);
+    positionZ.resize(padded, 0.0f);
+    rotationX.resize(padded, 0.0f);
+    rotationY.resize(padded, 0.0f);
+    rotationZ.resize(padded, 0.0f);
+    scaleX.resize(padded, 1.0f);
+    scaleY.resize(padded, 1.0f);
+    scaleZ.resize(padded, 1.0f);
+
+    // Objects dropped and brought back by a later Resize() start from identity too
+    for (size_t i = objectCount; i < padded && i < count; i++)
+    {
+        positionX[i] = positionY[i] = positionZ[i] = 0.0f;
+        rotationX[i] = rotationY[i] = rotationZ[i] = 0.0f;
+        scaleX[i] = scaleY[i] = scaleZ[i] = 1.0f;
+    }
+    count = objectCount;
+}
+
+//
+// Kernel
+//
+
+// The 11 and 10 degree minimax polynomials XNAMath's XMScalarSinCos uses,
+// after reducing x to [-pi, pi] and reflecting it into [-pi/2, pi/2]
+template <typename LANES>
+static inline void sinCos(typename LANES::Float x, typename LANES::Float &s, typename LANES::Float &c)
+{
+    typedef typename LANES::Float Float;
+
+    Float quotient = LANES::Round(LANES::Mul(x, LANES::Set(gInverseTwoPi)));
+    Float y = LANES::Sub(LANES::Sub(x, LANES::Mul(quotient, LANES::Set(gTwoPiHigh))), LANES::Mul(quotient, LANES::Set(gTwoPiLow)));
+
+    // sin(pi - y) = sin(y), cos(pi - y) = -cos(y)
+    typename LANES::Mask bOutside = LANES::Greater(LANES::Abs(y), LANES::Set(gHalfPi));
+    Float reflected = LANES::Sub(LANES::Select(LANES::Greater(y, LANES::Set(0.0f)), LANES::Set(gPi), LANES::Set(-gPi)), y);
+    y = LANES::Select(bOutside, reflected, y);
+    Float sign = LANES::Select(bOutside, LANES::Set(-1.0f), LANES::Set(1.0f));
+    Float y2 = LANES::Mul(y, y);
+
+    Float p = LANES::MulAdd(LANES::Set(-2.3889859e-08f), y2, LANES::Set(2.7525562e-06f));
+    p = LANES::MulAdd(p, y2, LANES::Set(-0.00019840874f));
+    p = LANES::MulAdd(p, y2, LANES::Set(0.0083333310f));
+    p = LANES::MulAdd(p, y2, LANES::Set(-0.16666667f));
+    p = LANES::MulAdd(p, y2, LANES::Set(1.0f));
+    s = LANES::Mul(p, y);
+
+    p = LANES::MulAdd(LANES::Set(-2.6051615e-07f), y2, LANES::Set(2.4760495e-05f));
+    p = LANES::MulAdd(p, y2, LANES::Set(-0.0013888378f));
+    p = LANES::MulAdd(p, y2, LANES::Set(0.041666638f));
+    p = LANES::MulAdd(p, y2, LANES::Set(-0.5f));
+    p = LANES::MulAdd(p, y2, LANES::Set(1.0f));
+    c = LANES::Mul(p, sign);
+}
+
+// S * Rx * Ry * Rz * T for objects i .. i + Width - 1, element e of the matrices in m[e]
+template <typename LANES>
+static inline void composeWorld(const TransformBatch &batch, size_t i, typename LANES::Float m[16])
+{
+    typedef typename LANES::Float Float;
+
+    Float sx, cx, sy, cy, sz, cz;
+    sinCos<LANES>(LANES::Load(&batch.rotationX[i]), sx, cx);
+    sinCos<LANES>(LANES::Load(&batch.rotationY[i]), sy, cy);
+    sinCos<LANES>(LANES::Load(&batch.rotationZ[i]), sz, cz);
+
+    // Rx * Ry = | cy       0    -sy     |
+    //           | sx sy    cx    sx cy  |
+    //           | cx sy   -sx    cx cy  |, times Rz mixes the first two columns
+    Float sxsy = LANES::Mul(sx, sy);
+    Float cxsy = LANES::Mul(cx, sy);
+    Float scaleX = LANES::Load(&batch.scaleX[i]);
+    Float scaleY = LANES::Load(&batch.scaleY[i]);
+    Float scaleZ = LANES::Load(&batch.scaleZ[i]);
+    Float zero = LANES::Set(0.0f);
+
+    m[0] = LANES::Mul(LANES::Mul(cy, cz), scaleX);
+    m[1] = LANES::Mul(LANES::Mul(cy, sz), scaleX);
+    m[2] = LANES::Mul(LANES::Sub(zero, sy), scaleX);
+    m[3] = zero;
+    m[4] = LANES::Mul(LANES::Sub(LANES::Mul(sxsy, cz), LANES::Mul(cx, sz)), scaleY);
+    m[5] = LANES::Mul(LANES::Add(LANES::Mul(sxsy, sz), LANES::Mul(cx, cz)), scaleY);
+    m[6] = LANES::Mul(LANES::Mul(sx, cy), scaleY);
+    m[7] = zero;
+    m[8] = LANES::Mul(LANES::Add(LANES::Mul(cxsy, cz), LANES::Mul(sx, sz)), scaleZ);
+    m[9] = LANES::Mul(LANES::Sub(LANES::Mul(cxsy, sz), LANES::Mul(sx, cz)), scaleZ);
+    m[10] = LANES::Mul(LANES::Mul(cx, cy), scaleZ);
+    m[11] = zero;
+    m[12] = LANES::Load(&batch.positionX[i]);
+    m[13] = LANES::Load(&batch.positionY[i]);
+    m[14] = LANES::Load(&batch.positionZ[i]);
+    m[15] = LANES::Set(1.0f);
+}
+
+// world * viewProjection with the world's last column known to be (0, 0, 0, 1)
+template <typename LANES>
+static inline void multiplyViewProjection(const typename LANES::Float world[16], const XMMATRIX &viewProjection, typename LANES::Float m[16])
+{
+    for (int row = 0; row < 4; row++)
+    {
+        const typename LANES::Float *w = world + row * 4;
+        for (int column = 0; column < 4; column++)
+        {
+            typename LANES::Float sum = LANES::Mul(w[0], LANES::Set(viewProjection.m[0][column]));
+            sum = LANES::MulAdd(w[1], LANES::Set(viewProjection.m[1][column]), sum);
+            sum = LANES::MulAdd(w[2], LANES::Set(viewProjection.m[2][column]), sum);
+            if (row == 3)
+                sum = LANES::Add(sum, LANES::Set(viewProjection.m[3][column]));
+            m[row * 4 + column] = sum;
+        }
+    }
+}
+
+template <typename LANES>
+static void composeBatch(const TransformBatch &batch, const XMMATRIX *pViewProjection, XMMATRIX *pWorld, XMMATRIX *pWorldViewProjection)
+{
+    typename LANES::Float world[16];
+    typename LANES::Float worldViewProjection[16];
+    XMMATRIX tail[2][LANES::Width];
+
+    for (size_t i = 0; i < batch.count; i += LANES::Width)
+    {
+        composeWorld<LANES>(batch, i, world);
+        if (pViewProjection != NULL)
+            multiplyViewProjection<LANES>(world, *pViewProjection, worldViewProjection);
+
+        // The padding objects of the last group go to a scratch copy
+        size_t remaining = batch.count - i;
+        if (remaining >= LANES::Width)
+        {
+            if (pWorld != NULL)
+                LANES::StoreMatrices(world, pWorld + i);
+            if (pViewProjection != NULL)
+                LANES::StoreMatrices(worldViewProjection, pWorldViewProjection + i);
+        }
+        else
+        {
+            if (pWorld != NULL)
+            {
+                LANES::StoreMatrices(world, tail[0]);
+                memcpy(pWorld + i, tail[0], remaining * sizeof(XMMATRIX));
+            }
+            if (pViewProjection != NULL)
+            {
+                LANES::StoreMatrices(worldViewProjection, tail[1]);
+                memcpy(pWorldViewProjection + i, tail[1], remaining * sizeof(XMMATRIX));
+            }
+        }
+    }
+}
+
+static void compose(const TransformBatch &batch, const XMMATRIX *pViewProjection, XMMATRIX *pWorld, XMMATRIX *pWorldViewProjection, unsigned int flags)
+{
+#if defined(SIMD_LANES)
+    if ((flags & TRANSFORM_BATCH_FLAG_SCALAR) == 0)
+    {
+        composeBatch<SIMDLanes>(batch, pViewProjection, pWorld, pWorldViewProjection);
+        return;
+    }
+#else
+    (void)flags;
+#endif
+    composeBatch<ScalarLanes>(batch, pViewProjection, pWorld, pWorldViewProjection);
+}
+
+void ComposeWorldMatrices(const TransformBatch &batch, XMMATRIX *pWorld, unsigned int flags)
+{
+    compose(batch, NULL, pWorld, NULL, flags);
+}
+
+void ComposeWorldViewProjection(const TransformBatch &batch, CXMMATRIX viewProjection, XMMATRIX *pWorld,
+                                XMMATRIX *pWorldViewProjection, unsigned int flags)
+{
+    compose(batch, &viewProjection, pWorld, pWorldViewProjection, flags);
+}
+
+unsigned int GetTransformBatchWidth()
+{
+#if defined(SIMD_LANES)
+    return SIMDLanes::Width;
+#else
+    return 1;
+#endif
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+// Batched world and world * view * projection matrices for many objects
+// Positions, Euler angles and scales are kept as structure of arrays, one
+// array per component, and ComposeWorldMatrices() builds a whole batch of
+// XMMATRIX in one pass, several objects per iteration: 16 with AVX-512
+// (-mavx512f), 8 with AVX2 (-mavx2 -mfma), 4 with SSE2, one otherwise. The
+// world matrix is scale * rotation X * rotation Y * rotation Z * translation,
+// the order 06-Cube-3DRotation multiplies in, written out in closed form.
+// Sines and cosines come from a polynomial accurate to a few ulps instead of
+// sinf/cosf, so they vectorize too; the matrices therefore differ from the
+// XMMatrixRotation* product in the last bits.
+
+#include <vector>
+
+#include "XMath.h"
+
+#define TRANSFORM_BATCH_PADDING 16 // The arrays hold a multiple of this many objects
+
+#define TRANSFORM_BATCH_FLAG_SCALAR 0x1 // Skip the SIMD path, for comparing the two
+
+// Object i is element i of every array; angles are in radians
+struct TransformBatch
+{
+    std::vector<float> positionX;
+    std::vector<float> positionY;
+    std::vector<float> positionZ;
+    std::vector<float> rotationX;
+    std::vector<float> rotationY;
+    std::vector<float> rotationZ;
+    std::vector<float> scaleX;
+    std::vector<float> scaleY;
+    std::vector<float> scaleZ;
+    unsigned int count;
+
+    TransformBatch() : count(0) {}
+
+    // Keeps the first objects, new ones are identity transforms. The arrays
+    // are padded to TRANSFORM_BATCH_PADDING so kernels never read past them.
+    void Resize(unsigned int objectCount);
+};
+
+// pWorld receives batch.count matrices
+void ComposeWorldMatrices(const TransformBatch &batch, XMMATRIX *pWorld, unsigned int flags);
+
+// pWorldViewProjection receives world * viewProjection for batch.count
+// objects, pWorld the world matrices when it is not NULL
+void ComposeWorldViewProjection(const TransformBatch &batch, CXMMATRIX viewProjection, XMMATRIX *pWorld,
+                                XMMATRIX *pWorldViewProjection, unsigned int flags);
+
+// Objects per iteration of the SIMD path compiled in, 1 without one
+unsigned int GetTransformBatchWidth();
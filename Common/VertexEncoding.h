@@ -0,0 +1,132 @@
+#pragma once
+
+// Compact vertex attribute encodings, the CPU side of what the input
+// assembler expands: half floats (DXGI_FORMAT_R16G16B16A16_FLOAT), 16 bit
+// normalized integers (R16G16_UNORM / R16G16_SNORM) and octahedral unit
+// vectors, two snorm16 values the vertex shader turns back into a normal.
+// Header only so SoftwareRasterizer can decode without the renderer.
+
+#include <math.h>
+#include <string.h>
+
+// Round to nearest even, overflow goes to infinity, tiny values to denormals or zero
+static inline unsigned short FloatToHalf(float value)
+{
+    unsigned int bits;
+    memcpy(&bits, &value, sizeof(bits));
+    unsigned int sign = (bits >> 16) & 0x8000;
+    unsigned int absolute = bits & 0x7FFFFFFF;
+
+    if (absolute >= 0x7F800000) // Inf or NaN
+        return (unsigned short)(sign | 0x7C00 | (absolute > 0x7F800000 ? 0x200 : 0));
+    if (absolute >= 0x477FF000) // Rounds past the largest half
+        return (unsigned short)(sign | 0x7C00);
+    if (absolute < 0x38800000) // Below the smallest normal half
+    {
+        if (absolute < 0x33000000)
+            return (unsigned short)sign;
+        unsigned int exponent = absolute >> 23;
+        unsigned int mantissa = (absolute & 0x7FFFFF) | 0x800000;
+        unsigned int shift = 126 - exponent;
+        unsigned int half = mantissa >> shift;
+        unsigned int remainder = mantissa & ((1u << shift) - 1);
+        unsigned int halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (half & 1)))
+            half++;
+        return (unsigned short)(sign | half);
+    }
+
+    unsigned int half = ((absolute - 0x38000000) >> 13);
+    unsigned int remainder = absolute & 0x1FFF;
+    if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+        half++;
+    return (unsigned short)(sign | half);
+}
+
+static inline float HalfToFloat(unsigned short half)
+{
+    unsigned int sign = (unsigned int)(half & 0x8000) << 16;
+    unsigned int exponent = (half >> 10) & 0x1F;
+    unsigned int mantissa = half & 0x3FF;
+    unsigned int bits;
+
+    if (exponent == 0x1F)
+        bits = sign | 0x7F800000 | (mantissa << 13);
+    else if (exponent != 0)
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    else if (mantissa == 0)
+        bits = sign;
+    else
+    {
+        // denormal, normalize it
+        exponent = 113;
+        while ((mantissa & 0x400) == 0)
+        {
+            mantissa <<= 1;
+            exponent--;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+    }
+
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// [0, 1] <-> 0..65535
+static inline unsigned short FloatToUnorm16(float value)
+{
+    value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+    return (unsigned short)(value * 65535.0f + 0.5f);
+}
+
+static inline float Unorm16ToFloat(unsigned short value)
+{
+    return (float)value / 65535.0f;
+}
+
+// [-1, 1] <-> -32767..32767, -32768 also decodes to -1 like the IA does
+static inline short FloatToSnorm16(float value)
+{
+    value = value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value);
+    return (short)(value >= 0.0f ? value * 32767.0f + 0.5f : value * 32767.0f - 0.5f);
+}
+
+static inline float Snorm16ToFloat(short value)
+{
+    float result = (float)value / 32767.0f;
+    return result < -1.0f ? -1.0f : result;
+}
+
+// Unit vector to the octahedron |x| + |y| + |z| = 1, folded onto the z >= 0
+// half so it flattens to a square in [-1, 1]^2
+static inline void OctahedralEncode(const float n[3], float encoded[2])
+{
+    float length = fabsf(n[0]) + fabsf(n[1]) + fabsf(n[2]);
+    float x = (length > 0.0f) ? n[0] / length : 0.0f;
+    float y = (length > 0.0f) ? n[1] / length : 0.0f;
+    if (n[2] < 0.0f)
+    {
+        float foldedX = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        float foldedY = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = foldedX;
+        y = foldedY;
+    }
+    encoded[0] = x;
+    encoded[1] = y;
+}
+
+// Same steps as octahedralDecode() in the HLSL, the result is normalized
+static inline void OctahedralDecode(const float encoded[2], float n[3])
+{
+    n[0] = encoded[0];
+    n[1] = encoded[1];
+    n[2] = 1.0f - fabsf(encoded[0]) - fabsf(encoded[1]);
+    float t = n[2] < 0.0f ? -n[2] : 0.0f;
+    n[0] += (n[0] >= 0.0f) ? -t : t;
+    n[1] += (n[1] >= 0.0f) ? -t : t;
+    float invLength = 1.0f / sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+    n[0] *= invLength;
+    n[1] *= invLength;
+    n[2] *= invLength;
+}
@@ -0,0 +1,81 @@
+#include <string.h>
+
+#include "VertexLayout.h"
+#include "VertexEncoding.h"
+
+// Input assembler format and size in bytes of every encoding
+static const VertexFormat gEncodingFormats[] = {VERTEX_FORMAT_FLOAT2, VERTEX_FORMAT_FLOAT3, VERTEX_FORMAT_FLOAT4,
+                                                VERTEX_FORMAT_HALF4, VERTEX_FORMAT_SNORM16X2, VERTEX_FORMAT_UNORM16X2};
+static const unsigned int gEncodingSizes[] = {8, 12, 16, 8, 4, 4};
+
+VertexLayout::VertexLayout(unsigned int inputSlot) : inputSlot(inputSlot),
+                                                     numElements(0),
+                                                     stride(0)
+{
+    memset(elements, 0, sizeof(elements));
+    memset(encodings, 0, sizeof(encodings));
+}
+
+bool VertexLayout::Add(const char *semanticName, unsigned int semanticIndex, VertexEncoding encoding)
+{
+    if (numElements >= VERTEX_LAYOUT_MAX_ATTRIBUTES)
+        return false;
+
+    VertexElement &element = elements[numElements];
+    element.semanticName = semanticName;
+    element.semanticIndex = semanticIndex;
+    element.format = gEncodingFormats[encoding];
+    element.inputSlot = inputSlot;
+    element.alignedByteOffset = stride;
+    encodings[numElements] = encoding;
+
+    numElements++;
+    stride += gEncodingSizes[encoding];
+    return true;
+}
+
+void VertexLayout::Pack(const void *const *pSources, const unsigned int *sourceStrides, unsigned int vertexCount, void *pOut) const
+{
+    unsigned char *pVertex = (unsigned char *)pOut;
+    for (unsigned int v = 0; v < vertexCount; v++, pVertex += stride)
+    {
+        for (unsigned int i = 0; i < numElements; i++)
+        {
+            const float *pSource = (const float *)((const unsigned char *)pSources[i] + (size_t)v * sourceStrides[i]);
+            unsigned char *pElement = pVertex + elements[i].alignedByteOffset;
+            switch (encodings[i])
+            {
+            case VERTEX_ENCODING_HALF:
+            {
+                unsigned short half[4] = {FloatToHalf(pSource[0]), FloatToHalf(pSource[1]), FloatToHalf(pSource[2]), FloatToHalf(1.0f)};
+                memcpy(pElement, half, sizeof(half));
+                break;
+            }
+            case VERTEX_ENCODING_OCTAHEDRAL:
+            {
+                float encoded[2];
+                OctahedralEncode(pSource, encoded);
+                short snorm[2] = {FloatToSnorm16(encoded[0]), FloatToSnorm16(encoded[1])};
+                memcpy(pElement, snorm, sizeof(snorm));
+                break;
+            }
+            case VERTEX_ENCODING_UNORM16:
+            {
+                unsigned short unorm[2] = {FloatToUnorm16(pSource[0]), FloatToUnorm16(pSource[1])};
+                memcpy(pElement, unorm, sizeof(unorm));
+                break;
+            }
+            default:
+                memcpy(pElement, pSource, gEncodingSizes[encodings[i]]);
+                break;
+            }
+        }
+    }
+}
+
+void VertexLayout::Pack(const void *const *pSources, const unsigned int *sourceStrides, unsigned int vertexCount, std::vector<unsigned char> &out) const
+{
+    out.resize((size_t)vertexCount * stride);
+    if (vertexCount)
+        Pack(pSources, sourceStrides, vertexCount, out.data());
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+// Builds an interleaved vertex format one attribute at a time. Offsets and the
+// stride follow from the order and encoding of the attributes, GetElements()
+// is the VertexElement list for ShaderDesc (the D3D11 backend turns it into
+// D3D11_INPUT_ELEMENT_DESCs) and Pack() writes float source data in the
+// chosen encodings into one buffer for the layout's input slot.
+//
+//   VertexLayout layout;
+//   layout.Add("POSITION", 0, VERTEX_ENCODING_HALF);
+//   layout.Add("NORMAL", 0, VERTEX_ENCODING_OCTAHEDRAL);
+
+#include <vector>
+
+#include "Renderer.h"
+
+#define VERTEX_LAYOUT_MAX_ATTRIBUTES 8
+
+enum VertexEncoding
+{
+    VERTEX_ENCODING_FLOAT2 = 0, // 8 bytes
+    VERTEX_ENCODING_FLOAT3,     // 12 bytes
+    VERTEX_ENCODING_FLOAT4,     // 16 bytes
+    VERTEX_ENCODING_HALF,       // 8 bytes, 3 source floats as xyz with w = 1
+    VERTEX_ENCODING_OCTAHEDRAL, // 4 bytes, unit vector, the shader calls octahedralDecode()
+    VERTEX_ENCODING_UNORM16     // 4 bytes, 2 source floats in [0, 1]
+};
+
+class VertexLayout
+{
+private:
+    VertexElement elements[VERTEX_LAYOUT_MAX_ATTRIBUTES];
+    VertexEncoding encodings[VERTEX_LAYOUT_MAX_ATTRIBUTES];
+    unsigned int inputSlot;
+    unsigned int numElements;
+    unsigned int stride;
+
+public:
+    explicit VertexLayout(unsigned int inputSlot = 0); // Slot every element is read from
+
+    // false when the layout is full
+    bool Add(const char *semanticName, unsigned int semanticIndex, VertexEncoding encoding);
+
+    const VertexElement *GetElements() const { return elements; }
+    unsigned int GetElementCount() const { return numElements; }
+    unsigned int GetStride() const { return stride; }
+
+    // Encode vertexCount vertices into pOut, GetStride() bytes each. pSources[i]
+    // is the first float of attribute i, sourceStrides[i] the bytes between
+    // two vertices in it, so interleaved and separate arrays both work.
+    void Pack(const void *const *pSources, const unsigned int *sourceStrides, unsigned int vertexCount, void *pOut) const;
+    void Pack(const void *const *pSources, const unsigned int *sourceStrides, unsigned int vertexCount, std::vector<unsigned char> &out) const;
+};
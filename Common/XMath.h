@@ -0,0 +1,615 @@
+#pragma once
+
+// Math used by the samples
+// A portable replacement for the XNAMath 2.04 subset the samples call, with
+// the same names, argument order and memory layout (row major matrices, row
+// vector * matrix), so constant buffer structs stay byte compatible. One
+// implementation is picked at compile time, with the DirectXMath macro names:
+//   _XM_AVX2_INTRINSICS_       AVX2 and FMA3 (-mavx2 -mfma, /arch:AVX2)
+//   _XM_SSE4_INTRINSICS_       SSE4.1 (-msse4.1, /arch:AVX)
+//   _XM_SSE_INTRINSICS_        SSE2, the x64 baseline
+//   _XM_ARM_NEON_INTRINSICS_   NEON (ARMv7 with NEON, AArch64)
+//   _XM_NO_INTRINSICS_         plain floats, everything else
+// Define _XM_NO_INTRINSICS_ to force the scalar path. Each level includes the
+// one below it. Products are summed in the same order as the scalar path, so
+// every path gives bit-identical matrices except AVX2, whose fused
+// multiply-adds round once instead of twice.
+
+#include <math.h>
+
+#if !defined(_XM_NO_INTRINSICS_) && !defined(_XM_SSE_INTRINSICS_) && !defined(_XM_ARM_NEON_INTRINSICS_)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define _XM_SSE_INTRINSICS_
+#elif defined(__ARM_NEON) || defined(_M_ARM64) || defined(_M_ARM)
+#define _XM_ARM_NEON_INTRINSICS_
+#else
+#define _XM_NO_INTRINSICS_
+#endif
+#endif
+
+#if defined(_XM_SSE_INTRINSICS_) && !defined(_XM_SSE4_INTRINSICS_) && (defined(__SSE4_1__) || defined(__AVX__))
+#define _XM_SSE4_INTRINSICS_
+#endif
+#if defined(_XM_SSE4_INTRINSICS_) && !defined(_XM_AVX2_INTRINSICS_) && defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define _XM_AVX2_INTRINSICS_
+#endif
+
+#if defined(_XM_AVX2_INTRINSICS_)
+#include <immintrin.h>
+#elif defined(_XM_SSE4_INTRINSICS_)
+#include <smmintrin.h>
+#elif defined(_XM_SSE_INTRINSICS_)
+#include <emmintrin.h>
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+#include <arm_neon.h>
+#endif
+
+#define XM_PI 3.141592654f
+#define XM_2PI 6.283185307f
+#define XM_PIDIV2 1.570796327f
+
+#if defined(_XM_SSE_INTRINSICS_)
+typedef __m128 XMVECTOR;
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+typedef float32x4_t XMVECTOR;
+#else
+struct alignas(16) XMVECTOR
+{
+    float v[4];
+};
+#endif
+
+// Vectors go in registers when the platform has them, matrices by reference
+#if defined(_XM_NO_INTRINSICS_)
+typedef const XMVECTOR &FXMVECTOR;
+#else
+typedef const XMVECTOR FXMVECTOR;
+#endif
+typedef const XMVECTOR &CXMVECTOR;
+
+struct alignas(16) XMMATRIX
+{
+    union
+    {
+        XMVECTOR r[4];
+        float m[4][4];
+    };
+
+    XMMATRIX operator*(const XMMATRIX &M) const;
+    XMMATRIX &operator*=(const XMMATRIX &M);
+};
+
+typedef const XMMATRIX &CXMMATRIX;
+
+// Unaligned storage types for the Load/Store functions
+struct XMFLOAT3
+{
+    float x;
+    float y;
+    float z;
+};
+
+struct XMFLOAT4
+{
+    float x;
+    float y;
+    float z;
+    float w;
+};
+
+struct XMFLOAT4X4
+{
+    float m[4][4];
+};
+
+inline float XMConvertToRadians(float fDegrees)
+{
+    return fDegrees * (XM_PI / 180.0f);
+}
+
+inline float XMConvertToDegrees(float fRadians)
+{
+    return fRadians * (180.0f / XM_PI);
+}
+
+inline void XMScalarSinCos(float *pSin, float *pCos, float value)
+{
+    *pSin = sinf(value);
+    *pCos = cosf(value);
+}
+
+//
+// Vectors
+//
+
+inline XMVECTOR XMVectorSet(float x, float y, float z, float w)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_set_ps(w, z, y, x);
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    float values[4] = {x, y, z, w};
+    return vld1q_f32(values);
+#else
+    XMVECTOR V = {{x, y, z, w}};
+    return V;
+#endif
+}
+
+inline XMVECTOR XMVectorZero()
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_setzero_ps();
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    return vdupq_n_f32(0.0f);
+#else
+    return XMVectorSet(0.0f, 0.0f, 0.0f, 0.0f);
+#endif
+}
+
+inline XMVECTOR XMVectorReplicate(float value)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_set1_ps(value);
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    return vdupq_n_f32(value);
+#else
+    return XMVectorSet(value, value, value, value);
+#endif
+}
+
+// Component i of V in all four
+#if defined(_XM_SSE_INTRINSICS_)
+#define XM_SPLAT(V, i) _mm_shuffle_ps((V), (V), _MM_SHUFFLE(i, i, i, i))
+#endif
+
+inline float XMVectorGetX(FXMVECTOR V)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_cvtss_f32(V);
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    return vgetq_lane_f32(V, 0);
+#else
+    return V.v[0];
+#endif
+}
+
+inline float XMVectorGetY(FXMVECTOR V)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_cvtss_f32(XM_SPLAT(V, 1));
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    return vgetq_lane_f32(V, 1);
+#else
+    return V.v[1];
+#endif
+}
+
+inline float XMVectorGetZ(FXMVECTOR V)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_cvtss_f32(XM_SPLAT(V, 2));
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    return vgetq_lane_f32(V, 2);
+#else
+    return V.v[2];
+#endif
+}
+
+inline float XMVectorGetW(FXMVECTOR V)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_cvtss_f32(XM_SPLAT(V, 3));
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    return vgetq_lane_f32(V, 3);
+#else
+    return V.v[3];
+#endif
+}
+
+inline XMVECTOR XMLoadFloat4(const XMFLOAT4 *pSource)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_loadu_ps(&pSource->x);
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    return vld1q_f32(&pSource->x);
+#else
+    return XMVectorSet(pSource->x, pSource->y, pSource->z, pSource->w);
+#endif
+}
+
+inline XMVECTOR XMLoadFloat3(const XMFLOAT3 *pSource)
+{
+    return XMVectorSet(pSource->x, pSource->y, pSource->z, 0.0f);
+}
+
+inline void XMStoreFloat4(XMFLOAT4 *pDestination, FXMVECTOR V)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    _mm_storeu_ps(&pDestination->x, V);
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    vst1q_f32(&pDestination->x, V);
+#else
+    pDestination->x = V.v[0];
+    pDestination->y = V.v[1];
+    pDestination->z = V.v[2];
+    pDestination->w = V.v[3];
+#endif
+}
+
+inline void XMStoreFloat3(XMFLOAT3 *pDestination, FXMVECTOR V)
+{
+    pDestination->x = XMVectorGetX(V);
+    pDestination->y = XMVectorGetY(V);
+    pDestination->z = XMVectorGetZ(V);
+}
+
+inline XMVECTOR XMVectorAdd(FXMVECTOR V1, FXMVECTOR V2)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_add_ps(V1, V2);
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    return vaddq_f32(V1, V2);
+#else
+    return XMVectorSet(V1.v[0] + V2.v[0], V1.v[1] + V2.v[1], V1.v[2] + V2.v[2], V1.v[3] + V2.v[3]);
+#endif
+}
+
+inline XMVECTOR XMVectorSubtract(FXMVECTOR V1, FXMVECTOR V2)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_sub_ps(V1, V2);
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    return vsubq_f32(V1, V2);
+#else
+    return XMVectorSet(V1.v[0] - V2.v[0], V1.v[1] - V2.v[1], V1.v[2] - V2.v[2], V1.v[3] - V2.v[3]);
+#endif
+}
+
+inline XMVECTOR XMVectorMultiply(FXMVECTOR V1, FXMVECTOR V2)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_mul_ps(V1, V2);
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    return vmulq_f32(V1, V2);
+#else
+    return XMVectorSet(V1.v[0] * V2.v[0], V1.v[1] * V2.v[1], V1.v[2] * V2.v[2], V1.v[3] * V2.v[3]);
+#endif
+}
+
+// V1 * V2 + V3, fused with AVX2
+inline XMVECTOR XMVectorMultiplyAdd(FXMVECTOR V1, FXMVECTOR V2, FXMVECTOR V3)
+{
+#if defined(_XM_AVX2_INTRINSICS_)
+    return _mm_fmadd_ps(V1, V2, V3);
+#elif defined(_XM_SSE_INTRINSICS_)
+    return _mm_add_ps(_mm_mul_ps(V1, V2), V3);
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    return vaddq_f32(vmulq_f32(V1, V2), V3);
+#else
+    return XMVectorAdd(XMVectorMultiply(V1, V2), V3);
+#endif
+}
+
+inline XMVECTOR XMVectorScale(FXMVECTOR V, float scale)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_mul_ps(V, _mm_set1_ps(scale));
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    return vmulq_n_f32(V, scale);
+#else
+    return XMVectorSet(V.v[0] * scale, V.v[1] * scale, V.v[2] * scale, V.v[3] * scale);
+#endif
+}
+
+inline XMVECTOR XMVectorNegate(FXMVECTOR V)
+{
+    return XMVectorSubtract(XMVectorZero(), V);
+}
+
+// Dot products are replicated into all four components
+inline XMVECTOR XMVector4Dot(FXMVECTOR V1, FXMVECTOR V2)
+{
+#if defined(_XM_SSE4_INTRINSICS_)
+    return _mm_dp_ps(V1, V2, 0xFF);
+#elif defined(_XM_SSE_INTRINSICS_)
+    __m128 product = _mm_mul_ps(V1, V2);
+    __m128 sum = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1))); // xy+yx, zw+wz
+    return _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    float32x4_t product = vmulq_f32(V1, V2);
+    float32x2_t sum = vadd_f32(vget_low_f32(product), vget_high_f32(product));
+    sum = vpadd_f32(sum, sum);
+    return vcombine_f32(sum, sum);
+#else
+    return XMVectorReplicate(V1.v[0] * V2.v[0] + V1.v[1] * V2.v[1] + V1.v[2] * V2.v[2] + V1.v[3] * V2.v[3]);
+#endif
+}
+
+inline XMVECTOR XMVector3Dot(FXMVECTOR V1, FXMVECTOR V2)
+{
+#if defined(_XM_SSE4_INTRINSICS_)
+    return _mm_dp_ps(V1, V2, 0x7F);
+#elif defined(_XM_SSE_INTRINSICS_)
+    __m128 product = _mm_mul_ps(V1, V2);
+    __m128 sum = _mm_add_ss(product, XM_SPLAT(product, 1));
+    sum = _mm_add_ss(sum, XM_SPLAT(product, 2));
+    return XM_SPLAT(sum, 0);
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    float32x4_t product = vsetq_lane_f32(0.0f, vmulq_f32(V1, V2), 3);
+    float32x2_t sum = vadd_f32(vget_low_f32(product), vget_high_f32(product));
+    sum = vpadd_f32(sum, sum);
+    return vcombine_f32(sum, sum);
+#else
+    return XMVectorReplicate(V1.v[0] * V2.v[0] + V1.v[1] * V2.v[1] + V1.v[2] * V2.v[2]);
+#endif
+}
+
+// W of the result is 0
+inline XMVECTOR XMVector3Cross(FXMVECTOR V1, FXMVECTOR V2)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    __m128 yzx1 = _mm_shuffle_ps(V1, V1, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 zxy2 = _mm_shuffle_ps(V2, V2, _MM_SHUFFLE(3, 1, 0, 2));
+    __m128 zxy1 = _mm_shuffle_ps(V1, V1, _MM_SHUFFLE(3, 1, 0, 2));
+    __m128 yzx2 = _mm_shuffle_ps(V2, V2, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 cross = _mm_sub_ps(_mm_mul_ps(yzx1, zxy2), _mm_mul_ps(zxy1, yzx2));
+    return _mm_and_ps(cross, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+#else
+    float x1 = XMVectorGetX(V1), y1 = XMVectorGetY(V1), z1 = XMVectorGetZ(V1);
+    float x2 = XMVectorGetX(V2), y2 = XMVectorGetY(V2), z2 = XMVectorGetZ(V2);
+    return XMVectorSet(y1 * z2 - z1 * y2, z1 * x2 - x1 * z2, x1 * y2 - y1 * x2, 0.0f);
+#endif
+}
+
+inline XMVECTOR XMVector3LengthSq(FXMVECTOR V)
+{
+    return XMVector3Dot(V, V);
+}
+
+inline XMVECTOR XMVector3Length(FXMVECTOR V)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_sqrt_ps(XMVector3Dot(V, V));
+#else
+    return XMVectorReplicate(sqrtf(XMVectorGetX(XMVector3Dot(V, V))));
+#endif
+}
+
+// A zero vector stays zero
+inline XMVECTOR XMVector3Normalize(FXMVECTOR V)
+{
+    float length = XMVectorGetX(XMVector3Length(V));
+    if (length == 0.0f)
+        return V;
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_div_ps(V, _mm_set1_ps(length));
+#else
+    float reciprocal = 1.0f / length;
+    return XMVectorSet(XMVectorGetX(V) * reciprocal, XMVectorGetY(V) * reciprocal,
+                       XMVectorGetZ(V) * reciprocal, XMVectorGetW(V) * reciprocal);
+#endif
+}
+
+// Row vector V times M, x * r[0] + y * r[1] + z * r[2] + w * r[3] summed in that order
+inline XMVECTOR XMVector4Transform(FXMVECTOR V, CXMMATRIX M)
+{
+#if defined(_XM_AVX2_INTRINSICS_)
+    __m128 result = _mm_mul_ps(XM_SPLAT(V, 0), M.r[0]);
+    result = _mm_fmadd_ps(XM_SPLAT(V, 1), M.r[1], result);
+    result = _mm_fmadd_ps(XM_SPLAT(V, 2), M.r[2], result);
+    return _mm_fmadd_ps(XM_SPLAT(V, 3), M.r[3], result);
+#elif defined(_XM_SSE_INTRINSICS_)
+    __m128 result = _mm_mul_ps(XM_SPLAT(V, 0), M.r[0]);
+    result = _mm_add_ps(result, _mm_mul_ps(XM_SPLAT(V, 1), M.r[1]));
+    result = _mm_add_ps(result, _mm_mul_ps(XM_SPLAT(V, 2), M.r[2]));
+    return _mm_add_ps(result, _mm_mul_ps(XM_SPLAT(V, 3), M.r[3]));
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    float32x4_t result = vmulq_n_f32(M.r[0], vgetq_lane_f32(V, 0));
+    result = vaddq_f32(result, vmulq_n_f32(M.r[1], vgetq_lane_f32(V, 1)));
+    result = vaddq_f32(result, vmulq_n_f32(M.r[2], vgetq_lane_f32(V, 2)));
+    return vaddq_f32(result, vmulq_n_f32(M.r[3], vgetq_lane_f32(V, 3)));
+#else
+    XMVECTOR result;
+    for (int j = 0; j < 4; j++)
+        result.v[j] = V.v[0] * M.m[0][j] + V.v[1] * M.m[1][j] + V.v[2] * M.m[2][j] + V.v[3] * M.m[3][j];
+    return result;
+#endif
+}
+
+// (x, y, z, 1) * M divided by its w
+inline XMVECTOR XMVector3TransformCoord(FXMVECTOR V, CXMMATRIX M)
+{
+    XMVECTOR result = XMVector4Transform(XMVectorSet(XMVectorGetX(V), XMVectorGetY(V), XMVectorGetZ(V), 1.0f), M);
+    float w = XMVectorGetW(result);
+#if defined(_XM_SSE_INTRINSICS_)
+    return _mm_div_ps(result, _mm_set1_ps(w));
+#else
+    return XMVectorSet(XMVectorGetX(result) / w, XMVectorGetY(result) / w, XMVectorGetZ(result) / w, 1.0f);
+#endif
+}
+
+//
+// Matrices
+//
+
+inline XMMATRIX XMMatrixSet(float m00, float m01, float m02, float m03,
+                            float m10, float m11, float m12, float m13,
+                            float m20, float m21, float m22, float m23,
+                            float m30, float m31, float m32, float m33)
+{
+    XMMATRIX M;
+    M.r[0] = XMVectorSet(m00, m01, m02, m03);
+    M.r[1] = XMVectorSet(m10, m11, m12, m13);
+    M.r[2] = XMVectorSet(m20, m21, m22, m23);
+    M.r[3] = XMVectorSet(m30, m31, m32, m33);
+    return M;
+}
+
+inline XMMATRIX XMMatrixIdentity()
+{
+    return XMMatrixSet(1.0f, 0.0f, 0.0f, 0.0f,
+                       0.0f, 1.0f, 0.0f, 0.0f,
+                       0.0f, 0.0f, 1.0f, 0.0f,
+                       0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+inline XMMATRIX XMLoadFloat4x4(const XMFLOAT4X4 *pSource)
+{
+    XMMATRIX M;
+    for (int i = 0; i < 4; i++)
+        M.r[i] = XMLoadFloat4((const XMFLOAT4 *)pSource->m[i]);
+    return M;
+}
+
+inline void XMStoreFloat4x4(XMFLOAT4X4 *pDestination, CXMMATRIX M)
+{
+    for (int i = 0; i < 4; i++)
+        XMStoreFloat4((XMFLOAT4 *)pDestination->m[i], M.r[i]);
+}
+
+// Every row of the result is that row of M1 transformed by M2
+inline XMMATRIX XMMatrixMultiply(CXMMATRIX M1, CXMMATRIX M2)
+{
+    XMMATRIX result;
+#if defined(_XM_AVX2_INTRINSICS_)
+    // Two rows at a time: both halves hold the same row of M2
+    __m256 row0 = _mm256_broadcast_ps(&M2.r[0]);
+    __m256 row1 = _mm256_broadcast_ps(&M2.r[1]);
+    __m256 row2 = _mm256_broadcast_ps(&M2.r[2]);
+    __m256 row3 = _mm256_broadcast_ps(&M2.r[3]);
+    for (int i = 0; i < 4; i += 2)
+    {
+        __m256 rows = _mm256_loadu_ps(M1.m[i]);
+        __m256 product = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+        product = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), row1, product);
+        product = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), row2, product);
+        product = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), row3, product);
+        _mm256_storeu_ps(result.m[i], product);
+    }
+#else
+    for (int i = 0; i < 4; i++)
+        result.r[i] = XMVector4Transform(M1.r[i], M2);
+#endif
+    return result;
+}
+
+inline XMMATRIX XMMATRIX::operator*(const XMMATRIX &M) const
+{
+    return XMMatrixMultiply(*this, M);
+}
+
+inline XMMATRIX &XMMATRIX::operator*=(const XMMATRIX &M)
+{
+    *this = XMMatrixMultiply(*this, M);
+    return *this;
+}
+
+inline XMMATRIX XMMatrixTranspose(CXMMATRIX M)
+{
+    XMMATRIX result;
+#if defined(_XM_SSE_INTRINSICS_)
+    result = M;
+    _MM_TRANSPOSE4_PS(result.r[0], result.r[1], result.r[2], result.r[3]);
+#elif defined(_XM_ARM_NEON_INTRINSICS_)
+    float32x4x2_t rows02 = vzipq_f32(M.r[0], M.r[2]); // x0 x2 y0 y2, z0 z2 w0 w2
+    float32x4x2_t rows13 = vzipq_f32(M.r[1], M.r[3]);
+    float32x4x2_t columnsXY = vzipq_f32(rows02.val[0], rows13.val[0]);
+    float32x4x2_t columnsZW = vzipq_f32(rows02.val[1], rows13.val[1]);
+    result.r[0] = columnsXY.val[0];
+    result.r[1] = columnsXY.val[1];
+    result.r[2] = columnsZW.val[0];
+    result.r[3] = columnsZW.val[1];
+#else
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 4; j++)
+            result.m[i][j] = M.m[j][i];
+    }
+#endif
+    return result;
+}
+
+inline XMMATRIX XMMatrixTranslation(float offsetX, float offsetY, float offsetZ)
+{
+    return XMMatrixSet(1.0f, 0.0f, 0.0f, 0.0f,
+                       0.0f, 1.0f, 0.0f, 0.0f,
+                       0.0f, 0.0f, 1.0f, 0.0f,
+                       offsetX, offsetY, offsetZ, 1.0f);
+}
+
+inline XMMATRIX XMMatrixScaling(float scaleX, float scaleY, float scaleZ)
+{
+    return XMMatrixSet(scaleX, 0.0f, 0.0f, 0.0f,
+                       0.0f, scaleY, 0.0f, 0.0f,
+                       0.0f, 0.0f, scaleZ, 0.0f,
+                       0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+inline XMMATRIX XMMatrixRotationX(float angle)
+{
+    float s, c;
+    XMScalarSinCos(&s, &c, angle);
+    return XMMatrixSet(1.0f, 0.0f, 0.0f, 0.0f,
+                       0.0f, c, s, 0.0f,
+                       0.0f, -s, c, 0.0f,
+                       0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+inline XMMATRIX XMMatrixRotationY(float angle)
+{
+    float s, c;
+    XMScalarSinCos(&s, &c, angle);
+    return XMMatrixSet(c, 0.0f, -s, 0.0f,
+                       0.0f, 1.0f, 0.0f, 0.0f,
+                       s, 0.0f, c, 0.0f,
+                       0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+inline XMMATRIX XMMatrixRotationZ(float angle)
+{
+    float s, c;
+    XMScalarSinCos(&s, &c, angle);
+    return XMMatrixSet(c, s, 0.0f, 0.0f,
+                       -s, c, 0.0f, 0.0f,
+                       0.0f, 0.0f, 1.0f, 0.0f,
+                       0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+inline XMMATRIX XMMatrixPerspectiveFovLH(float fovAngleY, float aspectRatio, float nearZ, float farZ)
+{
+    float height = 1.0f / tanf(fovAngleY * 0.5f);
+    float width = height / aspectRatio;
+    float range = farZ / (farZ - nearZ);
+    return XMMatrixSet(width, 0.0f, 0.0f, 0.0f,
+                       0.0f, height, 0.0f, 0.0f,
+                       0.0f, 0.0f, range, 1.0f,
+                       0.0f, 0.0f, -range * nearZ, 0.0f);
+}
+
+inline XMMATRIX XMMatrixOrthographicOffCenterLH(float viewLeft, float viewRight, float viewBottom, float viewTop, float nearZ, float farZ)
+{
+    float reciprocalWidth = 1.0f / (viewRight - viewLeft);
+    float reciprocalHeight = 1.0f / (viewTop - viewBottom);
+    float range = 1.0f / (farZ - nearZ);
+    return XMMatrixSet(reciprocalWidth + reciprocalWidth, 0.0f, 0.0f, 0.0f,
+                       0.0f, reciprocalHeight + reciprocalHeight, 0.0f, 0.0f,
+                       0.0f, 0.0f, range, 0.0f,
+                       -(viewLeft + viewRight) * reciprocalWidth, -(viewTop + viewBottom) * reciprocalHeight, -range * nearZ, 1.0f);
+}
+
+// View matrix of a camera at eyePosition looking at focusPosition
+inline XMMATRIX XMMatrixLookAtLH(FXMVECTOR eyePosition, FXMVECTOR focusPosition, FXMVECTOR upDirection)
+{
+    XMVECTOR zAxis = XMVector3Normalize(XMVectorSubtract(focusPosition, eyePosition));
+    XMVECTOR xAxis = XMVector3Normalize(XMVector3Cross(upDirection, zAxis));
+    XMVECTOR yAxis = XMVector3Cross(zAxis, xAxis);
+    XMVECTOR negativeEye = XMVectorNegate(eyePosition);
+
+    XMMATRIX M;
+    M.r[0] = XMVectorSet(XMVectorGetX(xAxis), XMVectorGetX(yAxis), XMVectorGetX(zAxis), 0.0f);
+    M.r[1] = XMVectorSet(XMVectorGetY(xAxis), XMVectorGetY(yAxis), XMVectorGetY(zAxis), 0.0f);
+    M.r[2] = XMVectorSet(XMVectorGetZ(xAxis), XMVectorGetZ(yAxis), XMVectorGetZ(zAxis), 0.0f);
+    M.r[3] = XMVectorSet(XMVectorGetX(XMVector3Dot(xAxis, negativeEye)), XMVectorGetX(XMVector3Dot(yAxis, negativeEye)),
+                         XMVectorGetX(XMVector3Dot(zAxis, negativeEye)), 1.0f);
+    return M;
+}
@@ -0,0 +1,118 @@
+#!/bin/sh
+# Golden image tests
+# Builds every sample (or the ones named) for the headless loop, renders a
+# fixed number of frames at a fixed size with the software backend and
+# compares the last one against Golden/<sample>.bmp with the ImageDiff tool;
+# 11-13 are also rendered lit (--lit) and 13 with an instanced field.
+# The simulation runs on its fixed step, so a frame is the same on every run
+# and any change in it comes from the code.
+#
+#   Tools/GoldenImages.sh update [sample directory ...]   Renders the golden images
+#   Tools/GoldenImages.sh check [sample directory ...]    Renders and compares, exits 1 on a failure
+#
+# Options go before the samples: [--frames 30] [--width 160] [--height 120]
+# [--build-dir dir] [--golden-dir dir] and, for check, the ImageDiff thresholds
+# [--tolerance N] [--max-pixels N] [--psnr dB] [--flip mean] [--flip-max max].
+# Failures leave
+# the frame and a heat map of the error in the build directory.
+# The golden images are committed in Golden/ at 160x120, small enough to keep
+# in the tree, so check compares against the last commit that updated them;
+# run update and commit the images with a change that is meant to alter a
+# frame. Samples are built by Tools/SampleBuild.sh.
+
+set -e
+
+[ $# -gt 0 ] || { echo "Usage: $0 update|check [options] [sample directory ...]" >&2; exit 2; }
+mode=$1
+shift
+case $mode in
+update|check) ;;
+*) echo "Unknown mode $mode" >&2; exit 2 ;;
+esac
+
+frames=30
+width=160
+height=120
+root=$(cd "$(dirname "$0")/.." && pwd)
+. "$root/Tools/SampleBuild.sh"
+buildDir=${TMPDIR:-/tmp}/GoldenImages
+goldenDir=$root/Golden
+thresholds=
+
+while [ $# -gt 0 ]; do
+    case $1 in
+    --frames) frames=$2; shift 2 ;;
+    --width) width=$2; shift 2 ;;
+    --height) height=$2; shift 2 ;;
+    --build-dir) buildDir=$2; shift 2 ;;
+    --golden-dir) goldenDir=$2; shift 2 ;;
+    --tolerance|--max-pixels|--psnr|--flip|--flip-max) thresholds="$thresholds $1 $2"; shift 2 ;;
+    --*) echo "Unknown option $1" >&2; exit 2 ;;
+    *) break ;;
+    esac
+done
+
+if [ $# -eq 0 ]; then
+    set -- "$root"/[0-9][0-9]-*/
+fi
+
+mkdir -p "$goldenDir"
+sampleBuildCommon "$root" "$buildDir"
+${CXX:-g++} $sampleFlags -I"$root/Common" "$root/Tools/ImageDiff.cpp" "$buildDir/Common/ImageDiff.o" "$buildDir/Common/Image.o" \
+    "$buildDir/Common/ImageDecoder.o" "$buildDir/Common/Inflate.o" -o "$buildDir/ImageDiff"
+
+failures=0
+for sampleDir in "$@"; do
+    sampleDir=$(cd "$sampleDir" && pwd)
+    sample=$(basename "$sampleDir")
+    [ -f "$sampleDir/D3D.cpp" ] || continue
+
+    sampleBuild "$root" "$buildDir" "$sampleDir"
+
+    # Every sample as it starts. The lighting samples also lit, where normal
+    # encodings and lighting shaders show, and 13 draws a lit field of 100
+    # spheres instanced and with one draw per sphere, both against one golden
+    variants=default
+    case $sample in
+    11-* | 12-* | 13-*) variants="$variants lit" ;;
+    esac
+    case $sample in
+    13-*) variants="$variants instanced draws" ;;
+    esac
+
+    for variant in $variants; do
+        case $variant in
+        default) name=$sample; golden=$name; options= ;;
+        lit) name=$sample-lit; golden=$name; options=--lit ;;
+        instanced) name=$sample-instanced; golden=$name; options="--lit --instances 100" ;;
+        draws) name=$sample-draws; golden=$sample-instanced; options="--lit --instances 100 --no-instancing" ;;
+        esac
+
+        if [ "$mode" = update ]; then
+            [ "$name" = "$golden" ] || continue # Compared with another variant's golden
+            output=$goldenDir/$golden.bmp
+        else
+            output=$buildDir/$name.bmp
+        fi
+        sampleRun "$buildDir" "$sampleDir" "$name" --renderer software --frames "$frames" --width "$width" --height "$height" \
+            --output "$output" $options
+
+        if [ "$mode" = update ]; then
+            echo "$name: updated"
+        elif [ ! -f "$goldenDir/$golden.bmp" ]; then
+            echo "$name: no golden image, run update first"
+            failures=$((failures + 1))
+        elif "$buildDir/ImageDiff" "$goldenDir/$golden.bmp" "$output" $thresholds > "$buildDir/$name.diff"; then
+            echo "$name: $(cat "$buildDir/$name.diff")"
+        else
+            echo "$name: $(cat "$buildDir/$name.diff")"
+            "$buildDir/ImageDiff" "$goldenDir/$golden.bmp" "$output" --flip 1 --heatmap "$buildDir/$name.heatmap.bmp" > /dev/null || true
+            failures=$((failures + 1))
+        fi
+    done
+done
+
+if [ "$mode" = check ]; then
+    echo "$failures failed"
+    [ $failures -eq 0 ]
+fi
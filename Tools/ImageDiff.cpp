@@ -0,0 +1,131 @@
+// Golden image comparison
+// Compares a rendered frame against its golden image and exits with 0 when it
+// passes every given threshold, 1 when it does not and 2 when the images
+// cannot be read or differ in size. Without thresholds the images must match
+// exactly. One line of results goes to stdout for the test log:
+//   ImageDiff reference.bmp test.bmp [--tolerance N] [--max-pixels N] [--psnr dB]
+//             [--flip mean] [--flip-max max] [--ppd N] [--heatmap out.bmp]
+//
+//   --tolerance N    Channel differences up to N count as equal, default 0
+//   --max-pixels N   Pixels allowed over the tolerance, default 0
+//   --psnr dB        Pass on a PSNR of at least dB instead of the pixel count
+//   --flip mean      Pass on a mean perceptual error of at most mean instead
+//   --flip-max max   And on no pixel's perceptual error above max
+//   --ppd N          Pixels per degree of the perceptual error, default 67
+//   --heatmap file   Writes the per pixel error, black to yellow
+//
+// Build (it needs none of the renderer):
+//   g++ -O2 -I../Common ../Tools/ImageDiff.cpp ../Common/ImageDiff.cpp ../Common/Image.cpp ../Common/ImageDecoder.cpp ../Common/Inflate.cpp -o ImageDiff
+//   cl /O2 /EHsc /I..\Common ..\Tools\ImageDiff.cpp ..\Common\ImageDiff.cpp ..\Common\Image.cpp ..\Common\ImageDecoder.cpp ..\Common\Inflate.cpp
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#include "ImageDiff.h"
+
+// Black through red to yellow, most of the range spent on small errors
+static unsigned int heatColor(float error)
+{
+    float t = sqrtf(std::min(std::max(error, 0.0f), 1.0f));
+    unsigned int r = (unsigned int)(std::min(t * 2.0f, 1.0f) * 255.0f);
+    unsigned int g = (unsigned int)(std::max(t * 2.0f - 1.0f, 0.0f) * 255.0f);
+    return r | (g << 8) | 0xFF000000;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "Usage: %s reference.bmp test.bmp [--tolerance N] [--max-pixels N] [--psnr dB] [--flip mean] [--flip-max max] [--ppd N] [--heatmap out.bmp]\n", argv[0]);
+        return 2;
+    }
+
+    const char *referenceFile = argv[1];
+    const char *testFile = argv[2];
+    ImageDiffOptions options;
+    options.bPerceptual = false;
+    unsigned int maxPixels = 0;
+    double minPsnr = -1.0;
+    double meanPerceptual = -1.0;
+    double maxPerceptual = -1.0;
+    const char *heatmapFile = NULL;
+
+    for (int i = 3; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc)
+            options.tolerance = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--max-pixels") == 0 && i + 1 < argc)
+            maxPixels = (unsigned int)atoi(argv[++i]);
+        else if (strcmp(argv[i], "--psnr") == 0 && i + 1 < argc)
+            minPsnr = atof(argv[++i]);
+        else if (strcmp(argv[i], "--flip") == 0 && i + 1 < argc)
+            meanPerceptual = atof(argv[++i]);
+        else if (strcmp(argv[i], "--flip-max") == 0 && i + 1 < argc)
+            maxPerceptual = atof(argv[++i]);
+        else if (strcmp(argv[i], "--ppd") == 0 && i + 1 < argc)
+            options.pixelsPerDegree = atof(argv[++i]);
+        else if (strcmp(argv[i], "--heatmap") == 0 && i + 1 < argc)
+            heatmapFile = argv[++i];
+        else
+        {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+    options.bPerceptual = meanPerceptual >= 0.0 || maxPerceptual >= 0.0 || heatmapFile != NULL;
+
+    Image reference, test;
+    if (!ImageLoad(referenceFile, reference))
+    {
+        fprintf(stderr, "Cannot read %s\n", referenceFile);
+        return 2;
+    }
+    if (!ImageLoad(testFile, test))
+    {
+        fprintf(stderr, "Cannot read %s\n", testFile);
+        return 2;
+    }
+
+    ImageDiffResult result;
+    std::vector<float> errors;
+    if (!ImageDiff(reference, test, options, result, heatmapFile ? &errors : NULL))
+    {
+        fprintf(stderr, "%s is %dx%d, %s is %dx%d\n", referenceFile, reference.width, reference.height,
+                testFile, test.width, test.height);
+        return 2;
+    }
+
+    // The pixel count decides unless a PSNR or perceptual threshold is given
+    bool bPass;
+    if (minPsnr >= 0.0 || meanPerceptual >= 0.0 || maxPerceptual >= 0.0)
+        bPass = (minPsnr < 0.0 || result.psnr >= minPsnr) &&
+                (meanPerceptual < 0.0 || result.perceptualMean <= meanPerceptual) &&
+                (maxPerceptual < 0.0 || result.perceptualMax <= maxPerceptual);
+    else
+        bPass = result.differingPixels <= maxPixels;
+
+    printf("%s: %u of %u pixels over %d, max %d, PSNR %.2f dB",
+           bPass ? "pass" : "FAIL", result.differingPixels, result.pixels, options.tolerance,
+           result.maxDifference, result.psnr);
+    if (options.bPerceptual)
+        printf(", perceptual mean %.5f max %.3f", result.perceptualMean, result.perceptualMax);
+    printf("\n");
+
+    if (heatmapFile)
+    {
+        Image heatmap;
+        heatmap.width = reference.width;
+        heatmap.height = reference.height;
+        heatmap.pixels.resize(errors.size());
+        for (size_t i = 0; i < errors.size(); i++)
+            heatmap.pixels[i] = heatColor(errors[i]);
+        if (!ImageSaveBMP(heatmapFile, heatmap))
+            fprintf(stderr, "Cannot write %s\n", heatmapFile);
+    }
+
+    return bPass ? 0 : 1;
+}
@@ -0,0 +1,40 @@
+# Sample build helpers
+# Sourced by Benchmarks/RunSamples.sh and Tools/GoldenImages.sh so both build
+# the samples with the same flags and objects: Common once, then every sample
+# linked against it, each run from its own directory where its textures and
+# ShaderCache/ live. The compiler is $CXX, g++ by default.
+#
+#   sampleBuildCommon root buildDir                Compile root/Common/*.cpp into buildDir/Common
+#   sampleBuild root buildDir sampleDir            Link buildDir/<sample>
+#   sampleRun buildDir sampleDir name [option ...] Run it, stdout to buildDir/name.txt, Log.txt to buildDir/name.log
+
+sampleFlags="-O2 -std=c++11 -pthread"
+
+sampleBuildCommon()
+{
+    rm -rf "$2/Common"
+    mkdir -p "$2/Common"
+
+    # Common once, every sample links the same objects
+    echo "Common: building" >&2
+    for source in "$1"/Common/*.cpp; do
+        ${CXX:-g++} $sampleFlags -I"$1/Common" -c "$source" -o "$2/Common/$(basename "$source" .cpp).o"
+    done
+}
+
+sampleBuild()
+{
+    sample=$(basename "$3")
+    echo "$sample: building" >&2
+    ${CXX:-g++} $sampleFlags -I"$1/Common" "$3/D3D.cpp" "$2"/Common/*.o -o "$2/$sample"
+}
+
+sampleRun()
+{
+    runBuildDir=$1
+    runSampleDir=$2
+    runName=$3
+    shift 3
+    (cd "$runSampleDir" && "$runBuildDir/$(basename "$runSampleDir")" "$@" > "$runBuildDir/$runName.txt")
+    mv "$runSampleDir/Log.txt" "$runBuildDir/$runName.log" 2>/dev/null || true
+}
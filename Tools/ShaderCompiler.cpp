@@ -0,0 +1,84 @@
+// Offline shader compiler
+// Build-time step that fills a sample's ShaderCache/ directory, so even the
+// first launch finds its bytecode and skips D3DCompile. It goes through the
+// same ShaderCacheCompile() as D3D11Renderer::CreateShader, so keys and blobs
+// are identical to what the runtime would have produced.
+//
+// Run from the sample directory:
+//   ShaderCompiler vertexShader.hlsl vs_5_0 pixelShader.hlsl ps_5_0
+//   ShaderCompiler -D NAME=VALUE ... file target ...   Defines apply to the files after them
+
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "ShaderCache.h"
+#include "Log.h"
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "Usage: %s [-D NAME=VALUE ...] file.hlsl vs_5_0|ps_5_0 [...]\n", argv[0]);
+        return 1;
+    }
+
+    LogInitialize("ShaderCompiler.txt");
+
+    std::vector<std::string> defineStrings;
+    int failures = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-D") == 0 && i + 1 < argc)
+        {
+            defineStrings.push_back(argv[++i]);
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            fprintf(stderr, "Missing target profile for %s\n", argv[i]);
+            failures++;
+            break;
+        }
+
+        // NAME=VALUE pairs, a bare NAME is defined as 1
+        std::vector<std::string> names(defineStrings.size());
+        std::vector<std::string> values(defineStrings.size());
+        std::vector<ShaderDefine> defines(defineStrings.size());
+        for (size_t d = 0; d < defineStrings.size(); d++)
+        {
+            size_t equals = defineStrings[d].find('=');
+            names[d] = defineStrings[d].substr(0, equals);
+            values[d] = (equals == std::string::npos) ? "1" : defineStrings[d].substr(equals + 1);
+            defines[d].name = names[d].c_str();
+            defines[d].value = values[d].c_str();
+        }
+
+        ShaderCompileDesc compileDesc;
+        ZeroMemory((void *)&compileDesc, sizeof(ShaderCompileDesc));
+        compileDesc.filePath = argv[i];
+        compileDesc.pDefines = defines.empty() ? NULL : defines.data();
+        compileDesc.numDefines = (unsigned int)defines.size();
+        compileDesc.entryPoint = "main";
+        compileDesc.target = argv[i + 1];
+        compileDesc.flags = SHADER_CACHE_COMPILE_FLAGS;
+
+        std::vector<unsigned char> bytecode;
+        if (ShaderCacheCompile(compileDesc, bytecode))
+            printf("%s %s: %u bytes\n", argv[i], argv[i + 1], (unsigned int)bytecode.size());
+        else
+        {
+            fprintf(stderr, "%s %s: compile failed, see ShaderCompiler.txt\n", argv[i], argv[i + 1]);
+            failures++;
+        }
+        i++;
+    }
+
+    ShaderCacheStats stats = ShaderCacheGetStats();
+    printf("%u compiled in %.1f ms, %u already cached\n", stats.misses, stats.compileMilliseconds, stats.hits);
+
+    LogCleanup();
+    return failures ? 1 : 0;
+}